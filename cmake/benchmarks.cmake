@@ -0,0 +1,16 @@
+# Compilation of benchmarks, which are not part of the tests
+
+option(OGDF_BENCHMARKS "Whether to add the target benchmarks for building the programs in test/benchmark." OFF)
+
+if(OGDF_BENCHMARKS)
+  file(GLOB_RECURSE benchmark_sources test/benchmark/*.cpp)
+  group_files(benchmark_sources "benchmarks")
+  add_custom_target(benchmarks)
+  foreach(source ${benchmark_sources})
+    get_filename_component(target ${source} NAME_WE)
+    add_executable(bench-${target} EXCLUDE_FROM_ALL ${source})
+    add_dependencies(benchmarks bench-${target})
+    set_property(TARGET bench-${target} PROPERTY RUNTIME_OUTPUT_DIRECTORY "${PROJECT_BINARY_DIR}/test/benchmark")
+    make_user_target(bench-${target})
+  endforeach()
+endif()
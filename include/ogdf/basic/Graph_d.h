@@ -1180,6 +1180,87 @@ public:
 		return e;
 	}
 
+	//! Creates a new edge for every pair of node indices in [\p begin, \p end).
+	/**
+	 * For every pair \a p in the range, an edge from \p indexToNode[\a p.first] to
+	 * \p indexToNode[\a p.second] is added at the end of the list of edges and of the adjacency
+	 * lists of its end nodes, just as by newEdge(node, node, int).
+	 *
+	 * In contrast to calling newEdge() repeatedly, all registered arrays are resized at
+	 * most once and the GraphObserver instances are notified only after all edges have
+	 * been created.
+	 *
+	 * @tparam NODES a random-access container of nodes, e.g. Array<node> or std::vector<node>.
+	 * @tparam ITERATOR a forward iterator over pairs of integers, e.g. std::pair<int, int>.
+	 * @param indexToNode is the container used for mapping indices to nodes.
+	 * @param begin is an iterator to the first pair.
+	 * @param end   is an iterator one past the last pair.
+	 * @return the number of created edges.
+	 */
+	template<typename NODES, typename ITERATOR>
+	int insertEdges(const NODES& indexToNode, ITERATOR begin, ITERATOR end) {
+		edge first = nullptr;
+		int count = 0;
+		for (auto it = begin; it != end; ++it) {
+			node src = indexToNode[it->first];
+			node tgt = indexToNode[it->second];
+			edge e = pureNewEdge(src, tgt, -1);
+			src->adjEntries.pushBack(e->m_adjSrc);
+			tgt->adjEntries.pushBack(e->m_adjTgt);
+			if (first == nullptr) {
+				first = e;
+			}
+			++count;
+		}
+
+		if (first != nullptr) {
+			if (m_regEdgeArrays.maxKeyIndex() >= m_regEdgeArrays.getArraySize()) {
+				m_regEdgeArrays.resizeArrays();
+			}
+			if (m_regAdjArrays.maxKeyIndex() >= m_regAdjArrays.getArraySize()) {
+				m_regAdjArrays.resizeArrays();
+			}
+			for (edge e = first; e != nullptr; e = e->succ()) {
+				m_regEdgeArrays.keyAdded(e);
+				m_regAdjArrays.keyAdded(e->adjSource());
+				m_regAdjArrays.keyAdded(e->adjTarget());
+				for (GraphObserver* obs : getObservers()) {
+					obs->edgeAdded(e);
+				}
+			}
+		}
+
+#ifdef OGDF_HEAVY_DEBUG
+		consistencyCheck();
+#endif
+		return count;
+	}
+
+	//! Makes room for \p n additional nodes in all registered node arrays.
+	/**
+	 * Use this before creating many nodes to avoid repeatedly resizing the registered
+	 * NodeArray instances (including those of attached GraphAttributes).
+	 * Arrays registered later on are also created with the reserved size.
+	 */
+	void reserveNodes(int n) {
+		if (m_regNodeArrays.calculateArraySize(n) > m_regNodeArrays.getArraySize()) {
+			m_regNodeArrays.reserveSpace(n);
+		}
+	}
+
+	//! Makes room for \p m additional edges in all registered edge and adjEntry arrays.
+	/**
+	 * @copydetails reserveNodes()
+	 */
+	void reserveEdges(int m) {
+		if (m_regEdgeArrays.calculateArraySize(m) > m_regEdgeArrays.getArraySize()) {
+			m_regEdgeArrays.reserveSpace(m);
+		}
+		if (m_regAdjArrays.calculateArraySize(m) > m_regAdjArrays.getArraySize()) {
+			m_regAdjArrays.reserveSpace(m); // registry adds factor 2 in calculateArraySize
+		}
+	}
+
 	//! @}
 	/**
 	 * @name Removing nodes and edges
@@ -37,6 +37,8 @@
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/geometry.h>
 
+#include <cstdint>
+
 namespace ogdf {
 class GraphAttributes;
 
@@ -93,6 +95,27 @@ public:
 	static ArrayBuffer<int> numberOfCrossings(const GraphAttributes& ga);
 
 
+	//! Computes the total number of edge crossings in the layout \p ga.
+	/**
+	 * Unlike #numberOfCrossings, this neither builds the intersection graph
+	 * nor allocates per-edge values. Edge segments are distributed over a
+	 * uniform grid and only segments sharing a grid cell are tested against
+	 * each other, using up to \p numThreads threads.
+	 *
+	 * Two segments of distinct edges that intersect in a single point count
+	 * as one crossing, unless the point is the position of a node both edges
+	 * are incident to. Overlapping segments are not counted. For drawings in
+	 * general position, the result equals half the sum of the values returned
+	 * by #numberOfCrossings.
+	 *
+	 * \param ga         Input layout. If it contains bend points, each segment of an edge's polyline is considered as a line segment.
+	 *                   Otherwise, a straight-line drawing is assumed.
+	 * \param numThreads Maximal number of threads to use.
+	 * \return           The number of crossings.
+	 */
+	static int64_t totalNumberOfCrossings(const GraphAttributes& ga, unsigned int numThreads = 1);
+
+
 	//! Computes the number of crossings through a non-incident node for each
 	//! edge in the layout \p ga.
 	/**
@@ -109,6 +132,20 @@ public:
 	static ArrayBuffer<int> numberOfNodeCrossings(const GraphAttributes& ga);
 
 
+	//! Computes the total number of crossings through a non-incident node in the layout \p ga.
+	/**
+	 * Equals the sum of the values returned by #numberOfNodeCrossings, but does
+	 * not allocate per-edge values and uses up to \p numThreads threads.
+	 *
+	 * \param ga         Input layout. If it contains bend points, each segment of an edge's polyline is considered as a line segment.
+	 *                   Otherwise, a straight-line drawing is assumed.
+	 * \param numThreads Maximal number of threads to use.
+	 * \return           The number of node crossings.
+	 */
+	static int64_t totalNumberOfNodeCrossings(const GraphAttributes& ga,
+			unsigned int numThreads = 1);
+
+
 	//! Computes the number of node overlaps for each node in the layout \p ga.
 	/**
 	 * Each node is treated as if it had the shape of the rectangle with the
@@ -0,0 +1,152 @@
+/** \file
+ * \brief Declaration and implementation of ogdf::NodeMatrix, a dense
+ *        matrix indexed by pairs of nodes.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ogdf {
+
+//! Dense matrix indexed by pairs of nodes.
+/**
+ * @ingroup graph-containers
+ *
+ * In contrast to NodeArray<NodeArray<T>>, a NodeMatrix consists of a single
+ * contiguous row-major allocation and is not registered with its graph.
+ * This makes it the container of choice for all-pairs data such as distance
+ * matrices, but it is not resized when nodes are added to the graph:
+ * only nodes with an index up to Graph::maxNodeIndex() at the time of
+ * init() may be used.
+ *
+ * If \p Symmetric is true, only the lower triangle is stored, i.e.,
+ * <tt>M(v, w)</tt> and <tt>M(w, v)</tt> refer to the same entry and the
+ * matrix needs roughly half of the memory.
+ *
+ * @tparam T is the element type. Note that bool is not supported.
+ * @tparam Symmetric enables half-symmetric storage.
+ */
+template<typename T, bool Symmetric = false>
+class NodeMatrix {
+public:
+	using value_type = T;
+
+	//! Whether only the lower triangle of the matrix is stored.
+	static constexpr bool symmetric = Symmetric;
+
+	//! Creates a matrix that is not associated with any graph.
+	NodeMatrix() = default;
+
+	//! Creates a matrix for all pairs of nodes of \p G and initializes all entries with \p x.
+	explicit NodeMatrix(const Graph& G, const T& x = T()) { init(G, x); }
+
+	//! Reinitializes the matrix to an empty matrix that is not associated with any graph.
+	void init() {
+		m_graph = nullptr;
+		m_dim = 0;
+		m_data.clear();
+		m_data.shrink_to_fit();
+	}
+
+	//! Reinitializes the matrix for all pairs of nodes of \p G and initializes all entries with \p x.
+	void init(const Graph& G, const T& x = T()) {
+		m_graph = &G;
+		m_dim = G.maxNodeIndex() + 1;
+		m_data.assign(Symmetric ? std::size_t(m_dim) * (m_dim + 1) / 2 : std::size_t(m_dim) * m_dim,
+				x);
+	}
+
+	//! Returns a pointer to the associated graph.
+	const Graph* graphOf() const { return m_graph; }
+
+	//! Returns true iff the matrix is associated with a graph.
+	bool valid() const { return m_graph != nullptr; }
+
+	//! Returns the number of stored entries.
+	std::size_t size() const { return m_data.size(); }
+
+	//! Returns a reference to the entry for the pair (\p v, \p w).
+	T& operator()(node v, node w) { return m_data[position(v, w)]; }
+
+	//! Returns a reference to the entry for the pair (\p v, \p w).
+	const T& operator()(node v, node w) const { return m_data[position(v, w)]; }
+
+	//! Returns a pointer to the first entry of the row of \p v, which is indexed by node indices.
+	/**
+	 * Only available if \p Symmetric is false.
+	 */
+	T* row(node v) {
+		static_assert(!Symmetric, "rows of symmetric matrices are not contiguous");
+		OGDF_ASSERT(v->graphOf() == m_graph);
+		return m_data.data() + std::size_t(v->index()) * m_dim;
+	}
+
+	//! Returns a pointer to the first entry of the row of \p v, which is indexed by node indices.
+	const T* row(node v) const {
+		static_assert(!Symmetric, "rows of symmetric matrices are not contiguous");
+		OGDF_ASSERT(v->graphOf() == m_graph);
+		return m_data.data() + std::size_t(v->index()) * m_dim;
+	}
+
+	//! Sets all entries to \p x.
+	void fill(const T& x) { std::fill(m_data.begin(), m_data.end(), x); }
+
+private:
+	const Graph* m_graph = nullptr; //!< The associated graph.
+	int m_dim = 0; //!< The number of rows (and columns).
+	std::vector<T> m_data; //!< The entries in row-major order.
+
+	std::size_t position(node v, node w) const {
+		OGDF_ASSERT(v->graphOf() == m_graph);
+		OGDF_ASSERT(w->graphOf() == m_graph);
+		return position(v->index(), w->index());
+	}
+
+	std::size_t position(int i, int j) const {
+		OGDF_ASSERT(0 <= i);
+		OGDF_ASSERT(i < m_dim);
+		OGDF_ASSERT(0 <= j);
+		OGDF_ASSERT(j < m_dim);
+		if (Symmetric) {
+			if (i < j) {
+				std::swap(i, j);
+			}
+			return std::size_t(i) * (i + 1) / 2 + j;
+		}
+		return std::size_t(i) * m_dim + j;
+	}
+};
+
+}
@@ -0,0 +1,145 @@
+/** \file
+ * \brief Declaration of ogdf::StaticGraphView, an immutable
+ *        compressed sparse row snapshot of a Graph.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+
+#include <vector>
+
+namespace ogdf {
+
+//! Immutable snapshot of a Graph in compressed sparse row (CSR) format.
+/**
+ * @ingroup graphs
+ *
+ * A StaticGraphView freezes the structure of a Graph into a few contiguous
+ * arrays. Nodes and edges are renumbered densely by 0, ..., n-1 and
+ * 0, ..., m-1 (in the order of Graph::nodes and Graph::edges, respectively),
+ * so algorithms can use plain vectors instead of NodeArray / EdgeArray and
+ * traverse adjacencies without chasing the pointers of the adjacency lists.
+ *
+ * Every node \a v owns the consecutive adjacency slots
+ * [adjBegin(v), adjEnd(v)), which correspond to the adjacency entries of \a v.
+ * The slots of outgoing edges come first (up to outEnd(v)), followed by the
+ * slots of incoming edges; within both groups, the order of
+ * NodeElement::adjEntries is preserved.
+ * A self-loop thus occupies one outgoing and one incoming slot.
+ *
+ * The view is not updated when the underlying graph changes; call init()
+ * again to take a new snapshot.
+ */
+class OGDF_EXPORT StaticGraphView {
+public:
+	//! Creates an empty view that is not associated with any graph.
+	StaticGraphView() = default;
+
+	//! Creates a snapshot of \p G in time O(n + m).
+	explicit StaticGraphView(const Graph& G) { init(G); }
+
+	//! Replaces the current snapshot by a snapshot of \p G.
+	void init(const Graph& G);
+
+	//! Returns the graph this view is a snapshot of (or nullptr).
+	const Graph* graphOf() const { return m_graph; }
+
+	//! Returns the number of nodes.
+	int numberOfNodes() const { return static_cast<int>(m_node.size()); }
+
+	//! Returns the number of edges.
+	int numberOfEdges() const { return static_cast<int>(m_edge.size()); }
+
+	//! Returns the dense index of node \p v.
+	int index(node v) const {
+		OGDF_ASSERT(v->graphOf() == m_graph);
+		return m_nodeIndex[v->index()];
+	}
+
+	//! Returns the dense index of edge \p e.
+	int index(edge e) const {
+		OGDF_ASSERT(e->graphOf() == m_graph);
+		return m_edgeIndex[e->index()];
+	}
+
+	//! Returns the node with dense index \p v.
+	node nodeOf(int v) const { return m_node[v]; }
+
+	//! Returns the edge with dense index \p e.
+	edge edgeOf(int e) const { return m_edge[e]; }
+
+	//! Returns the dense index of the source of edge \p e.
+	int source(int e) const { return m_source[e]; }
+
+	//! Returns the dense index of the target of edge \p e.
+	int target(int e) const { return m_target[e]; }
+
+	//! Returns the first adjacency slot of node \p v.
+	int adjBegin(int v) const { return m_offset[v]; }
+
+	//! Returns the slot after the last outgoing adjacency slot of node \p v.
+	int outEnd(int v) const { return m_outEnd[v]; }
+
+	//! Returns the slot after the last adjacency slot of node \p v.
+	int adjEnd(int v) const { return m_offset[v + 1]; }
+
+	//! Returns the degree of node \p v.
+	int degree(int v) const { return m_offset[v + 1] - m_offset[v]; }
+
+	//! Returns the outdegree of node \p v.
+	int outdeg(int v) const { return m_outEnd[v] - m_offset[v]; }
+
+	//! Returns the indegree of node \p v.
+	int indeg(int v) const { return m_offset[v + 1] - m_outEnd[v]; }
+
+	//! Returns the dense index of the node opposite to the owner of slot \p i.
+	int twinNode(int i) const { return m_adjNode[i]; }
+
+	//! Returns the dense index of the edge of slot \p i.
+	int adjEdge(int i) const { return m_adjEdge[i]; }
+
+private:
+	const Graph* m_graph = nullptr;
+
+	std::vector<node> m_node; //!< dense node index -> node
+	std::vector<edge> m_edge; //!< dense edge index -> edge
+	std::vector<int> m_nodeIndex; //!< node index -> dense node index
+	std::vector<int> m_edgeIndex; //!< edge index -> dense edge index
+
+	std::vector<int> m_source; //!< dense source of each edge
+	std::vector<int> m_target; //!< dense target of each edge
+
+	std::vector<int> m_offset; //!< first adjacency slot of each node (n+1 entries)
+	std::vector<int> m_outEnd; //!< end of the outgoing adjacency slots of each node
+	std::vector<int> m_adjNode; //!< opposite node of each adjacency slot
+	std::vector<int> m_adjEdge; //!< edge of each adjacency slot
+};
+
+}
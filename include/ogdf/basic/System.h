@@ -86,7 +86,11 @@ enum class CPUFeature {
 	VMX, //!< Virtual Machine Extensions
 	SMX, //!< Safer Mode Extensions
 	EST, //!< Enhanced Intel SpeedStep Technology
-	MONITOR //!< Processor supports MONITOR/MWAIT instructions
+	MONITOR, //!< Processor supports MONITOR/MWAIT instructions
+	AVX, //!< Advanced Vector Extensions (AVX)
+	FMA, //!< Fused multiply-add (FMA3)
+	AVX2, //!< Advanced Vector Extensions 2 (AVX2)
+	AVX512F //!< AVX-512 Foundation
 };
 
 //! Bit mask for CPU features.
@@ -104,7 +108,11 @@ enum class CPUFeatureMask : unsigned int {
 	VMX = 1 << static_cast<int>(CPUFeature::VMX), //!< Virtual Machine Extensions
 	SMX = 1 << static_cast<int>(CPUFeature::SMX), //!< Safer Mode Extensions
 	EST = 1 << static_cast<int>(CPUFeature::EST), //!< Enhanced Intel SpeedStep Technology
-	MONITOR = 1 << static_cast<int>(CPUFeature::MONITOR) //!< Processor supports MONITOR/MWAIT instructions
+	MONITOR = 1 << static_cast<int>(CPUFeature::MONITOR), //!< Processor supports MONITOR/MWAIT instructions
+	AVX = 1 << static_cast<int>(CPUFeature::AVX), //!< Advanced Vector Extensions (AVX)
+	FMA = 1 << static_cast<int>(CPUFeature::FMA), //!< Fused multiply-add (FMA3)
+	AVX2 = 1 << static_cast<int>(CPUFeature::AVX2), //!< Advanced Vector Extensions 2 (AVX2)
+	AVX512F = 1 << static_cast<int>(CPUFeature::AVX512F) //!< AVX-512 Foundation
 };
 
 OGDF_EXPORT unsigned int operator|=(unsigned int& i, CPUFeatureMask fm);
@@ -0,0 +1,237 @@
+/** \file
+ * \brief Declaration of a process-wide work-stealing executor.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/basic.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ogdf {
+
+//! Work-stealing executor shared by OGDF's multithreaded algorithms.
+/**
+ * @ingroup threads
+ *
+ * The pool owns a fixed number of worker threads, each of them with its own
+ * queue of jobs. A worker executes the most recent job of its own queue and,
+ * if that is empty, steals the oldest job from another worker's queue. Jobs
+ * submitted from a worker end up in the worker's own queue.
+ *
+ * The number of workers plus one (for the thread waiting for the results)
+ * is the global concurrency cap #maxThreads(). Algorithms do not submit jobs
+ * directly but use a TaskGroup, which additionally limits the number of
+ * threads working on the group's tasks (the per-call thread budget).
+ *
+ * Workers are started on the first submitted job. If OGDF uses a memory pool
+ * that is not thread-safe (\c OGDF_MEMORY_POOL_NTS), there are no workers
+ * and all tasks are executed by the thread waiting for them.
+ */
+class OGDF_EXPORT ThreadPool {
+public:
+	class TaskGroup;
+
+	//! The type of jobs executed by the pool.
+	using Job = std::function<void()>;
+
+	//! Creates a pool with \p numWorkers worker threads.
+	explicit ThreadPool(unsigned int numWorkers);
+
+	//! Finishes all pending jobs and joins the worker threads.
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	//! Returns the process-wide pool.
+	/**
+	 * It has System::numberOfProcessors() - 1 workers unless changed by
+	 * #setNumberOfWorkers().
+	 */
+	static ThreadPool& global();
+
+	//! Returns the number of worker threads.
+	unsigned int numberOfWorkers() const { return m_numWorkers; }
+
+	//! Sets the number of worker threads to \p numWorkers.
+	/**
+	 * Pending jobs are finished before the workers are replaced.
+	 *
+	 * \pre No job is submitted while the number of workers is changed.
+	 */
+	void setNumberOfWorkers(unsigned int numWorkers);
+
+	//! Returns the maximal number of threads executing jobs of this pool concurrently.
+	unsigned int maxThreads() const { return m_numWorkers + 1; }
+
+	//! Returns the number of threads a call requesting \p numThreads threads may use.
+	/**
+	 * This is \p numThreads restricted to the interval [1, #maxThreads()].
+	 */
+	unsigned int threadBudget(unsigned int numThreads) const;
+
+	//! Submits \p job for execution by some worker.
+	/**
+	 * The job must not throw. If there are no workers, \p job is executed
+	 * immediately. Use TaskGroup for waiting on jobs and handling exceptions.
+	 */
+	void submit(Job job);
+
+	//! Calls \p func(i) for every \a i in [\p first, \p last) using at most \p numThreads threads.
+	/**
+	 * The range is split into contiguous chunks of at least \p minChunkSize
+	 * indices, one per thread; the first chunk is processed by the calling
+	 * thread. Small ranges are processed sequentially without involving the
+	 * pool at all.
+	 */
+	template<typename Func>
+	void parallelFor(int first, int last, unsigned int numThreads, Func&& func,
+			int minChunkSize = 1);
+
+private:
+	struct WorkerQueue {
+		std::mutex mutex;
+		std::deque<Job> jobs;
+	};
+
+	unsigned int m_numWorkers;
+	std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+	std::vector<std::thread> m_workers;
+
+	std::mutex m_startMutex; //!< Guards starting and stopping the workers.
+	std::mutex m_mutex; //!< Guards #m_queued and #m_stop.
+	std::condition_variable m_wakeUp;
+	long m_queued = 0; //!< Number of submitted jobs not yet taken by a worker.
+	bool m_stop = false;
+
+	std::atomic<bool> m_running {false}; //!< Whether the workers have been started.
+	std::atomic<unsigned int> m_nextQueue {0};
+
+	void start();
+	void stop();
+	bool tryPop(unsigned int index, Job& job);
+	void workerLoop(unsigned int index);
+};
+
+//! A set of tasks executed by a ThreadPool with a thread budget.
+/**
+ * At most #budget() threads, including the thread calling #wait(), execute
+ * tasks of the group at the same time. Since #wait() itself executes tasks
+ * that have not been started yet, groups may be nested inside of tasks and
+ * tasks must not rely on running concurrently with other tasks (e.g., by
+ * synchronizing on a Barrier).
+ *
+ * \code
+ * ThreadPool::TaskGroup tasks(numThreads);
+ * for (int i = 0; i < n; ++i) {
+ *   tasks.run([&, i] { work(i); });
+ * }
+ * tasks.wait();
+ * \endcode
+ */
+class OGDF_EXPORT ThreadPool::TaskGroup {
+public:
+	//! Creates a group running on \p pool using at most \p numThreads threads.
+	/**
+	 * \p numThreads is restricted by ThreadPool::threadBudget(); 0 requests
+	 * all threads of the pool.
+	 */
+	explicit TaskGroup(unsigned int numThreads = 0, ThreadPool& pool = ThreadPool::global());
+
+	//! Waits for all tasks, discarding their exceptions.
+	~TaskGroup();
+
+	TaskGroup(const TaskGroup&) = delete;
+	TaskGroup& operator=(const TaskGroup&) = delete;
+
+	//! Returns the maximal number of threads executing tasks of this group.
+	unsigned int budget() const { return m_budget; }
+
+	//! Adds \p task to the group.
+	/**
+	 * The task may be executed by a worker immediately or by #wait().
+	 */
+	void run(Job task);
+
+	//! Executes pending tasks and blocks until all tasks are finished.
+	/**
+	 * If a task threw an exception, the first such exception is rethrown.
+	 */
+	void wait();
+
+private:
+	struct State;
+
+	ThreadPool& m_pool;
+	unsigned int m_budget;
+	std::shared_ptr<State> m_state;
+
+	static void drain(State& state, bool isHelper);
+};
+
+template<typename Func>
+void ThreadPool::parallelFor(int first, int last, unsigned int numThreads, Func&& func,
+		int minChunkSize) {
+	const int n = last - first;
+	const int numChunks = static_cast<int>(
+			std::min<long>(threadBudget(numThreads), std::max(n / std::max(minChunkSize, 1), 1)));
+
+	if (numChunks <= 1) {
+		for (int i = first; i < last; ++i) {
+			func(i);
+		}
+		return;
+	}
+
+	auto bound = [first, n, numChunks](int chunk) {
+		return first + static_cast<int>(static_cast<long long>(n) * chunk / numChunks);
+	};
+	auto processChunk = [&func, &bound](int chunk) {
+		for (int i = bound(chunk), end = bound(chunk + 1); i < end; ++i) {
+			func(i);
+		}
+	};
+
+	TaskGroup tasks(numChunks, *this);
+	for (int chunk = 1; chunk < numChunks; ++chunk) {
+		tasks.run([&processChunk, chunk] { processChunk(chunk); });
+	}
+	processChunk(0);
+	tasks.wait();
+}
+
+}
@@ -0,0 +1,334 @@
+/** \file
+ * \brief Implementation of a monotone radix heap supporting decrease-key.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/heap/HeapBase.h>
+
+#include <array>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace ogdf {
+
+namespace monotone_radix_heap {
+
+//! Returns the key of an integral value.
+template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+T key(const T& value) {
+	return value;
+}
+
+//! Returns the key of a prioritized value (as stored by ogdf::PrioritizedQueue).
+template<typename T>
+auto key(const T& value) -> typename std::decay<decltype(value.priority())>::type {
+	return value.priority();
+}
+
+}
+
+//! Monotone radix heap node.
+template<typename T>
+struct MonotoneRadixHeapNode {
+	template<typename, typename>
+	friend class MonotoneRadixHeap;
+
+protected:
+	T value; //!< Value contained in the node.
+
+	MonotoneRadixHeapNode<T>* prev; //!< Previous node in the same bucket.
+	MonotoneRadixHeapNode<T>* next; //!< Next node in the same bucket.
+	int bucket; //!< Index of the bucket containing the node.
+
+	//! Creates heap node with a given \p valueOfNode.
+	explicit MonotoneRadixHeapNode(const T& valueOfNode)
+		: value(valueOfNode), prev(nullptr), next(nullptr), bucket(0) { }
+};
+
+//! Monotone radix heap implementation.
+/**
+ * @ingroup containers
+ *
+ * A radix heap (Ahuja, Mehlhorn, Orlin and Tarjan: "Faster algorithms for the
+ * shortest path problem") for non-negative integer keys. Values are either integers
+ * themselves or provide their key via \c priority(), so the heap can be plugged into
+ * ogdf::PrioritizedQueue and hence into algorithms like ogdf::Dijkstra.
+ *
+ * The heap is \a monotone: a pushed or decreased key must not be smaller than the key
+ * of the last topmost value. This holds for %Dijkstra's algorithm with non-negative
+ * edge weights. In return, all operations take amortized time logarithmic in the
+ * range of the keys, independent of the number of values.
+ *
+ * @tparam T Denotes value type of inserted elements.
+ * @tparam C Denotes comparison functor. It is not used; values are always
+ *         ordered by increasing key, i.e., it has to be equivalent to \c std::less.
+ */
+template<typename T, typename C>
+class MonotoneRadixHeap
+	: public HeapBase<MonotoneRadixHeap<T, C>, MonotoneRadixHeapNode<T>, T, C> {
+	using base_type = HeapBase<MonotoneRadixHeap<T, C>, MonotoneRadixHeapNode<T>, T, C>;
+	using Node = MonotoneRadixHeapNode<T>;
+	using Key = typename std::make_unsigned<decltype(monotone_radix_heap::key(
+			std::declval<T>()))>::type;
+
+	static constexpr int BITS = std::numeric_limits<Key>::digits;
+	static_assert(BITS <= 64, "keys of a MonotoneRadixHeap must not have more than 64 bits");
+
+public:
+	/**
+	 * Creates empty monotone radix heap.
+	 *
+	 * @param cmp Comparison functor (see class description).
+	 * @param initialSize ignored by this implementation.
+	 */
+	explicit MonotoneRadixHeap(const C& cmp = C(), int initialSize = -1);
+
+	/**
+	 * Destructs the heap.
+	 *
+	 * If the heap is not empty, destructors of contained elements are called
+	 * and used storage is deallocated.
+	 */
+	virtual ~MonotoneRadixHeap();
+
+	//! Returns reference to the top element in the heap.
+	const T& top() const override;
+
+	/**
+	 * Inserts a new node with given \p value into a heap.
+	 *
+	 * @param value A value to be inserted; its key must not be smaller than the one of top().
+	 * @return Handle to the inserted node.
+	 */
+	Node* push(const T& value) override;
+
+	/**
+	 * Removes the top element from the heap.
+	 *
+	 * Behaviour of this function is undefined if the heap is empty.
+	 */
+	void pop() override;
+
+	/**
+	 * Decreases value of the given \p heapNode to \p value.
+	 *
+	 * Behaviour of this function is undefined if node does not belong to the
+	 * heap, the new value is greater than the old one or its key is smaller than
+	 * the one of top().
+	 *
+	 * @param heapNode A node for which the value is to be decreased.
+	 * @param value A new value for the node.
+	 */
+	void decrease(Node* heapNode, const T& value) override;
+
+	/**
+	 * Returns the value of the node
+	 *
+	 * @param heapNode The nodes handle
+	 * @return the value of the node
+	 */
+	const T& value(Node* heapNode) const override { return heapNode->value; }
+
+private:
+	//! Buckets of nodes; bucket \a i contains the nodes whose key first differs from
+	//! #m_minimum in bit \a i-1 (counted from the least significant one).
+	mutable std::array<Node*, BITS + 1> m_buckets;
+	//! Bit \a i-1 is set iff bucket \a i (for \a i > 0) is non-empty.
+	mutable Key m_bucketMask;
+	//! The key of the last extracted minimum; no smaller key may be inserted.
+	mutable Key m_minimum;
+
+	//! Returns the key of \p value.
+	static Key keyOf(const T& value) {
+		const auto key = monotone_radix_heap::key(value);
+		if constexpr (std::is_signed<decltype(key)>::value) {
+			OGDF_ASSERT(key >= 0);
+		}
+		return static_cast<Key>(key);
+	}
+
+	//! Returns the 1-based position of the highest set bit of \p x, or 0 if \p x is 0.
+	static int highestBit(Key x) {
+#if defined(__GNUC__) || defined(__clang__)
+		return x == 0 ? 0 : 64 - __builtin_clzll(static_cast<unsigned long long>(x));
+#else
+		int i = 0;
+		for (; x != 0; x >>= 1) {
+			i++;
+		}
+		return i;
+#endif
+	}
+
+	//! Returns the 1-based position of the lowest set bit of \p x, which must not be 0.
+	static int lowestBit(Key x) {
+		OGDF_ASSERT(x != 0);
+#if defined(__GNUC__) || defined(__clang__)
+		return 1 + __builtin_ctzll(static_cast<unsigned long long>(x));
+#else
+		int i = 1;
+		for (; (x & 1) == 0; x >>= 1) {
+			i++;
+		}
+		return i;
+#endif
+	}
+
+	//! Inserts \p heapNode into the bucket given by its key.
+	void insert(Node* heapNode) const;
+
+	//! Removes \p heapNode from its bucket.
+	void unlink(Node* heapNode) const;
+
+	//! Makes sure that bucket 0 contains the minimum if the heap is not empty.
+	void normalize() const;
+
+	//! Releases memory occupied by the list of nodes starting at \p heapNode.
+	static void release(Node* heapNode);
+};
+
+template<typename T, typename C>
+MonotoneRadixHeap<T, C>::MonotoneRadixHeap(const C& cmp, int /* unused parameter */)
+	: base_type(cmp), m_bucketMask(0), m_minimum(0) {
+	m_buckets.fill(nullptr);
+}
+
+template<typename T, typename C>
+MonotoneRadixHeap<T, C>::~MonotoneRadixHeap() {
+	for (Node* bucket : m_buckets) {
+		release(bucket);
+	}
+}
+
+template<typename T, typename C>
+const T& MonotoneRadixHeap<T, C>::top() const {
+	normalize();
+	OGDF_ASSERT(m_buckets[0] != nullptr);
+	return m_buckets[0]->value;
+}
+
+template<typename T, typename C>
+MonotoneRadixHeapNode<T>* MonotoneRadixHeap<T, C>::push(const T& value) {
+	Node* heapNode = new Node(value);
+	insert(heapNode);
+	return heapNode;
+}
+
+template<typename T, typename C>
+void MonotoneRadixHeap<T, C>::pop() {
+	normalize();
+	Node* heapNode = m_buckets[0];
+	OGDF_ASSERT(heapNode != nullptr);
+	unlink(heapNode);
+	delete heapNode;
+}
+
+template<typename T, typename C>
+void MonotoneRadixHeap<T, C>::decrease(Node* heapNode, const T& value) {
+	unlink(heapNode);
+	heapNode->value = value;
+	insert(heapNode);
+}
+
+template<typename T, typename C>
+void MonotoneRadixHeap<T, C>::insert(Node* heapNode) const {
+	const Key key = keyOf(heapNode->value);
+	OGDF_ASSERT(key >= m_minimum);
+
+	const int index = highestBit(key ^ m_minimum);
+	heapNode->bucket = index;
+	heapNode->prev = nullptr;
+	heapNode->next = m_buckets[index];
+	if (heapNode->next != nullptr) {
+		heapNode->next->prev = heapNode;
+	}
+	m_buckets[index] = heapNode;
+
+	if (index != 0) {
+		m_bucketMask |= Key(1) << (index - 1);
+	}
+}
+
+template<typename T, typename C>
+void MonotoneRadixHeap<T, C>::unlink(Node* heapNode) const {
+	const int index = heapNode->bucket;
+	if (heapNode->prev != nullptr) {
+		heapNode->prev->next = heapNode->next;
+	} else {
+		m_buckets[index] = heapNode->next;
+	}
+	if (heapNode->next != nullptr) {
+		heapNode->next->prev = heapNode->prev;
+	}
+
+	if (index != 0 && m_buckets[index] == nullptr) {
+		m_bucketMask &= ~(Key(1) << (index - 1));
+	}
+}
+
+template<typename T, typename C>
+void MonotoneRadixHeap<T, C>::normalize() const {
+	if (m_buckets[0] != nullptr || m_bucketMask == 0) {
+		return;
+	}
+
+	// Redistribute the lowest non-empty bucket around its minimum. Every node of
+	// that bucket moves to a lower one and all other buckets stay valid.
+	const int index = lowestBit(m_bucketMask);
+	Node* bucket = m_buckets[index];
+	m_buckets[index] = nullptr;
+	m_bucketMask &= ~(Key(1) << (index - 1));
+
+	m_minimum = keyOf(bucket->value);
+	for (Node* it = bucket->next; it != nullptr; it = it->next) {
+		const Key key = keyOf(it->value);
+		if (key < m_minimum) {
+			m_minimum = key;
+		}
+	}
+
+	while (bucket != nullptr) {
+		Node* next = bucket->next;
+		insert(bucket);
+		bucket = next;
+	}
+}
+
+template<typename T, typename C>
+void MonotoneRadixHeap<T, C>::release(Node* heapNode) {
+	while (heapNode != nullptr) {
+		Node* next = heapNode->next;
+		delete heapNode;
+		heapNode = next;
+	}
+}
+
+}
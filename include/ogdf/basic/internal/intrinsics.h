@@ -39,3 +39,22 @@
 #ifdef OGDF_SSE3_EXTENSIONS
 #	include OGDF_SSE3_EXTENSIONS // IWYU pragma: export
 #endif
+
+// AVX2 and AVX-512 code is compiled for its instruction set only and selected at
+// runtime. Functions using these intrinsics must be marked with OGDF_AVX2_TARGET or
+// OGDF_AVX512_TARGET, respectively, and may only be called if
+// System::cpuSupports() the corresponding CPUFeature.
+#if (defined(__x86_64__) || defined(__i386__)) \
+		&& (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 7))
+#	include <immintrin.h> // IWYU pragma: export
+#	define OGDF_AVX2_EXTENSIONS
+#	define OGDF_AVX512_EXTENSIONS
+#	define OGDF_AVX2_TARGET __attribute__((target("avx2,fma")))
+#	define OGDF_AVX512_TARGET __attribute__((target("avx512f")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#	include <immintrin.h> // IWYU pragma: export
+#	define OGDF_AVX2_EXTENSIONS
+#	define OGDF_AVX512_EXTENSIONS
+#	define OGDF_AVX2_TARGET
+#	define OGDF_AVX512_TARGET
+#endif
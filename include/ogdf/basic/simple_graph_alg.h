@@ -37,12 +37,14 @@
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/SList.h>
+#include <ogdf/basic/StaticGraphView.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/internal/graph_iterators.h>
 #include <ogdf/basic/internal/list_templates.h>
 #include <ogdf/basic/tuples.h>
 
 #include <functional>
+#include <vector>
 
 namespace ogdf {
 
@@ -1030,6 +1032,73 @@ inline bool isBipartite(const Graph& G) {
 	return isBipartite(G, color);
 }
 
+//! \name Methods on static graph views
+//! These overloads run on an immutable StaticGraphView snapshot instead of a Graph.
+//! Per-node and per-edge results are indexed by the dense indices of the view.
+//! @{
+
+//! Returns true iff \p G contains no self-loop.
+/**
+ * @ingroup ga-multi
+ */
+OGDF_EXPORT bool isLoopFree(const StaticGraphView& G);
+
+//! Returns true iff \p G contains no (directed) parallel edges.
+/**
+ * @ingroup ga-multi
+ *
+ * In contrast to isParallelFree(const Graph&), this needs no sorting and
+ * runs in time O(n + m).
+ */
+OGDF_EXPORT bool isParallelFree(const StaticGraphView& G);
+
+//! Returns true iff \p G is connected.
+/**
+ * @ingroup ga-connectivity
+ */
+OGDF_EXPORT bool isConnected(const StaticGraphView& G);
+
+//! Computes the connected components of \p G.
+/**
+ * @ingroup ga-connectivity
+ *
+ * Assigns component numbers (0, 1, ...) to the nodes of \p G.
+ *
+ * @param G         is the input graph view.
+ * @param component is assigned the component number of each (dense) node index.
+ * @return the number of connected components.
+ */
+OGDF_EXPORT int connectedComponents(const StaticGraphView& G, std::vector<int>& component);
+
+//! Computes the amount of connected components of \p G.
+/**
+ * @ingroup ga-connectivity
+ */
+inline int connectedComponents(const StaticGraphView& G) {
+	std::vector<int> component;
+	return connectedComponents(G, component);
+}
+
+//! Returns true iff the digraph \p G is acyclic.
+/**
+ * @ingroup ga-digraph
+ */
+OGDF_EXPORT bool isAcyclic(const StaticGraphView& G);
+
+//! Returns true iff the undirected graph \p G is acyclic.
+/**
+ * @ingroup ga-digraph
+ */
+OGDF_EXPORT bool isAcyclicUndirected(const StaticGraphView& G);
+
+//! Checks whether \p G is bipartite.
+/**
+ * @ingroup graph-algs
+ */
+OGDF_EXPORT bool isBipartite(const StaticGraphView& G);
+
+//! @}
+
 /**
  * Fills \p dist with the distribution given by a function \p func
  * in graph \p G.
@@ -31,6 +31,7 @@
 
 #pragma once
 
+#include <ogdf/basic/ArrayBuffer.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/basic.h>
@@ -38,6 +39,8 @@
 #include <ogdf/decomposition/DynamicSkeleton.h>
 #include <ogdf/decomposition/SPQRTree.h>
 
+#include <utility>
+
 namespace ogdf {
 class PertinentGraph;
 class Skeleton;
@@ -221,17 +224,32 @@ protected:
 	DynamicSkeleton& createSkeleton(node vT) const;
 
 	/**
-	 * \brief Recursively performs the task of adding edges (and nodes)
+	 * \brief Performs the task of adding edges (and nodes)
 	 * to the pertinent graph \p Gp for each involved skeleton graph.
+	 *
+	 * The subtree rooted at \p v is traversed in depth-first order using an explicit stack.
 	 */
 	void cpRec(node v, PertinentGraph& Gp) const override {
+		ArrayBuffer<std::pair<node, ListConstIterator<edge>>> stack;
 		v = findSPQR(v);
-		for (ListConstIterator<edge> i = m_tNode_hEdges[v]->begin(); i.valid(); ++i) {
-			edge e = m_hEdge_gEdge[*i];
+		stack.push(std::make_pair(v, m_tNode_hEdges[v]->begin()));
+
+		while (!stack.empty()) {
+			v = stack.top().first;
+			ListConstIterator<edge>& i = stack.top().second;
+			if (!i.valid()) {
+				stack.pop();
+				continue;
+			}
+			edge h = *i;
+			++i;
+
+			edge e = m_hEdge_gEdge[h];
 			if (e) {
 				cpAddEdge(e, Gp);
-			} else if (*i != m_tNode_hRefEdge[v]) {
-				cpRec(spqrproper(*i), Gp);
+			} else if (h != m_tNode_hRefEdge[v]) {
+				node w = spqrproper(m_hEdge_twinEdge[h]);
+				stack.push(std::make_pair(w, m_tNode_hEdges[w]->begin()));
 			}
 		}
 	}
@@ -31,6 +31,7 @@
 
 #pragma once
 
+#include <ogdf/basic/ArrayBuffer.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/List.h>
@@ -204,27 +205,36 @@ protected:
 	//! Initialization (called by constructor).
 	void init(edge eRef, Triconnectivity& tricComp);
 
-	//! Recursively performs rooting of tree.
+	//! Roots the subtree at \p v, where \p ef leads to the parent of \p v (uses an explicit stack).
 	void rootRec(node v, edge ef);
 
 	/**
-	 * \brief Recursively performs the task of adding edges (and nodes)
+	 * \brief Performs the task of adding edges (and nodes)
 	 * to the pertinent graph \p Gp for each involved skeleton graph.
+	 *
+	 * The subtree rooted at \p v is traversed in preorder using an explicit stack.
 	 */
 	void cpRec(node v, PertinentGraph& Gp) const override {
-		const Skeleton& S = skeleton(v);
-
-		for (edge e : S.getGraph().edges) {
-			edge eOrig = S.realEdge(e);
-			if (eOrig != nullptr) {
-				cpAddEdge(eOrig, Gp);
+		ArrayBuffer<node> stack;
+		stack.push(v);
+
+		while (!stack.empty()) {
+			v = stack.popRet();
+			const Skeleton& S = skeleton(v);
+
+			for (edge e : S.getGraph().edges) {
+				edge eOrig = S.realEdge(e);
+				if (eOrig != nullptr) {
+					cpAddEdge(eOrig, Gp);
+				}
 			}
-		}
 
-		for (adjEntry adj : v->adjEntries) {
-			node w = adj->theEdge()->target();
-			if (w != v) {
-				cpRec(w, Gp);
+			// push the children in reverse order so that they are visited in order
+			for (adjEntry adj = v->lastAdj(); adj != nullptr; adj = adj->pred()) {
+				node w = adj->theEdge()->target();
+				if (w != v) {
+					stack.push(w);
+				}
 			}
 		}
 	}
@@ -231,6 +231,9 @@ class List;
  *   </tr><tr>
  *     <td><i>nmPrecision</i><td>int<td>4
  *     <td>The precision \a p for the <i>p</i>-term multipole expansions.
+ *   </tr><tr>
+ *     <td><i>maxThreads</i><td>int<td>1
+ *     <td>The maximal number of threads used by the New Multipole Method.
  *   </tr>
  * </table>
  *
@@ -713,6 +716,23 @@ public:
 	//! Sets the precision for the multipole expansions to \p p.
 	void nmPrecision(int p) { m_NMPrecision = ((p >= 1) ? p : 1); }
 
+	//! Returns the maximal number of threads used by the New Multipole Method.
+	/**
+	 * The multipole expansions of the leaves, the local expansions of independent
+	 * subtrees of the quadtree and the forces of the nodes in different leaves are
+	 * computed in parallel. The layout only depends on randSeed() and the number of
+	 * threads (unless nodes share their position, which is resolved randomly), which is
+	 * why the default is a single thread rather than the number of available processors.
+	 */
+	unsigned int maxThreads() const { return m_maxThreads; }
+
+	//! Sets the maximal number of threads used by the New Multipole Method to \p n.
+	void maxThreads(unsigned int n) {
+#ifndef OGDF_MEMORY_POOL_NTS
+		m_maxThreads = ((n >= 1) ? n : 1);
+#endif
+	}
+
 	//! @}
 
 private:
@@ -781,6 +801,7 @@ private:
 	FMMMOptions::SmallestCellFinding m_NMSmallCell; //!< The option for how to calculate smallest quadtratic cells.
 	int m_NMParticlesInLeaves; //!< The maximal number of particles in a leaf.
 	int m_NMPrecision; //!< The precision for multipole expansions.
+	unsigned int m_maxThreads; //!< The maximal number of threads used by NMM.
 
 	//other variables
 	double max_integer_position; //!< The maximum value for an integer position.
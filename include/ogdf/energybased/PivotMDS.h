@@ -98,6 +98,19 @@ public:
 
 	bool useEdgeCostsAttribute() const { return m_hasEdgeCostsAttribute; }
 
+	//! Computes the pivot distance matrix based on the maxmin strategy
+	/**
+	 * Row \a i of \p pivDistMatrix contains the graph distances from the \a i-th
+	 * pivot to all nodes of \p GA in the order of Graph::nodes.
+	 * Unreachable nodes have distance std::numeric_limits<double>::infinity().
+	 *
+	 * @param GA is the input graph (with edge costs if useEdgeCostsAttribute() is set).
+	 * @param pivDistMatrix is assigned the pivot distance matrix.
+	 * @param pivots if non-null, is assigned the selected pivots.
+	 */
+	void getPivotDistanceMatrix(const GraphAttributes& GA, Array<Array<double>>& pivDistMatrix,
+			Array<node>* pivots = nullptr);
+
 private:
 	//! Convergence factor used for power iteration.
 	const static double EPSILON;
@@ -142,9 +155,6 @@ private:
 	void eigenValueDecomposition(Array<Array<double>>& K, Array<Array<double>>& eVecs,
 			Array<double>& eValues);
 
-	//! Computes the pivot distance matrix based on the maxmin strategy
-	void getPivotDistanceMatrix(const GraphAttributes& GA, Array<Array<double>>& pivDistMatrix);
-
 	//! Checks whether the given graph is a path or not.
 	node getRootedPath(const Graph& G);
 
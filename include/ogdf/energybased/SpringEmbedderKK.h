@@ -33,6 +33,7 @@
 
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/LayoutModule.h>
+#include <ogdf/basic/NodeMatrix.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/tuples.h>
 
@@ -225,21 +226,21 @@ protected:
 
 	//! Computes contribution of node u to the first partial
 	//! derivatives (dE/dx_m, dE/dy_m) (for node m) (eq. 7 and 8 in paper)
-	dpair computeParDer(node m, node u, GraphAttributes& GA, NodeArray<NodeArray<double>>& ss,
-			NodeArray<NodeArray<double>>& dist);
+	dpair computeParDer(node m, node u, GraphAttributes& GA, NodeMatrix<double>& ss,
+			NodeMatrix<double>& dist);
 
 	//! Compute partial derivative for v
-	dpair computeParDers(node v, GraphAttributes& GA, NodeArray<NodeArray<double>>& ss,
-			NodeArray<NodeArray<double>>& dist);
+	dpair computeParDers(node v, GraphAttributes& GA, NodeMatrix<double>& ss,
+			NodeMatrix<double>& dist);
 
 	//! Does the necessary initialization work for the call functions
 	void initialize(GraphAttributes& GA, NodeArray<dpair>& partialDer,
-			const EdgeArray<double>& eLength, NodeArray<NodeArray<double>>& oLength,
-			NodeArray<NodeArray<double>>& sstrength, bool simpleBFS);
+			const EdgeArray<double>& eLength, NodeMatrix<double>& oLength,
+			NodeMatrix<double>& sstrength, bool simpleBFS);
 
 	//! Main computation loop, nodes are moved here
 	void mainStep(GraphAttributes& GA, NodeArray<dpair>& partialDer,
-			NodeArray<NodeArray<double>>& oLength, NodeArray<NodeArray<double>>& sstrength);
+			NodeMatrix<double>& oLength, NodeMatrix<double>& sstrength);
 
 	//! Does the scaling if no edge lengths are given but node sizes
 	//! are respected
@@ -268,9 +269,9 @@ private:
 	static const double desMinLength; //!< Defines minimum desired edge length. Smaller values are treated as zero
 	static const int maxVal; //!< defines infinite upper bound for iteration number
 
-	double allpairsspBFS(const Graph& G, NodeArray<NodeArray<double>>& distance);
+	double allpairsspBFS(const Graph& G, NodeMatrix<double>& distance);
 	double allpairssp(const Graph& G, const EdgeArray<double>& eLengths,
-			NodeArray<NodeArray<double>>& distance,
+			NodeMatrix<double>& distance,
 			const double threshold = std::numeric_limits<double>::max());
 };
 
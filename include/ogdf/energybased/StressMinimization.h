@@ -37,6 +37,8 @@
 
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/LayoutModule.h>
+#include <ogdf/basic/NodeMatrix.h>
+#include <ogdf/basic/ThreadPool.h>
 #include <ogdf/basic/basic.h>
 
 namespace ogdf {
@@ -63,7 +65,10 @@ public:
 		, m_fixYCoords(false)
 		, m_fixZCoords(false)
 		, m_forcing2DLayout(false)
-		, m_use3D(false) { }
+		, m_use3D(false)
+		, m_maxThreads(ThreadPool::global().maxThreads())
+		, m_sparseStress(false)
+		, m_numberOfSparsePivots(DEFAULT_NUMBER_OF_SPARSE_PIVOTS) { }
 
 	//! Destructor.
 	~StressMinimization() { }
@@ -111,6 +116,31 @@ public:
 	 */
 	inline void setForcing2DLayout(bool forcing2DLayout);
 
+	//! Sets whether the sparse stress model is used instead of the full one.
+	/**
+	 * The sparse model (Ortmann, Klimenta, Brandes: A Sparse Stress Model, 2016)
+	 * only considers the stress of adjacent pairs of nodes and of pairs consisting of
+	 * a node and one of the pivots selected as in PivotMDS, where the latter are
+	 * weighted by the number of nodes the pivot represents.
+	 * Hence, neither all-pairs shortest paths nor a quadratic distance matrix are computed
+	 * and each iteration runs in time O(k·n + m) for k pivots.
+	 */
+	inline void useSparseStress(bool sparseStress);
+
+	//! Sets the number of pivots used by the sparse stress model. If the new value is
+	//! smaller or equal 0 the default value (200) is used.
+	inline void setNumberOfSparsePivots(int numberOfPivots);
+
+	//! Returns the maximal number of threads used for computing all-pairs shortest paths.
+	unsigned int maxThreads() const { return m_maxThreads; }
+
+	//! Sets the maximal number of threads used for computing all-pairs shortest paths to \p n.
+	/**
+	 * The threads are taken from ThreadPool::global(), so at most its ThreadPool::maxThreads()
+	 * are used. The default is ThreadPool::maxThreads().
+	 */
+	void maxThreads(unsigned int n) { m_maxThreads = n; }
+
 private:
 	//! Convergence constant.
 	const static double EPSILON;
@@ -118,6 +148,9 @@ private:
 	//! Default number of pivots used for the initial Pivot-MDS layout
 	const static int DEFAULT_NUMBER_OF_PIVOTS;
 
+	//! Default number of pivots used by the sparse stress model
+	const static int DEFAULT_NUMBER_OF_SPARSE_PIVOTS;
+
 	//! Tells whether the stress minimization is based on uniform edge costs or a
 	//! edge costs attribute
 	bool m_hasEdgeCostsAttribute;
@@ -157,17 +190,29 @@ private:
 	//! Indicates whether a 3D-layout is computed.
 	bool m_use3D;
 
+	//! The maximal number of threads used for computing all-pairs shortest paths.
+	unsigned int m_maxThreads;
+
+	//! Indicates whether the sparse stress model is used.
+	bool m_sparseStress;
+
+	//! The number of pivots used by the sparse stress model.
+	int m_numberOfSparsePivots;
+
+	//! Computes the layout with the sparse stress model.
+	void callSparse(GraphAttributes& GA);
+
 	//! Calculates the stress for the given layout
-	double calcStress(const GraphAttributes& GA, NodeArray<NodeArray<double>>& shortestPathMatrix,
-			NodeArray<NodeArray<double>>& weightMatrix);
+	double calcStress(const GraphAttributes& GA, NodeMatrix<double, true>& shortestPathMatrix,
+			NodeMatrix<double, true>& weightMatrix);
 
 	//! Runs the stress for a given Graph, shortest path and weight matrix.
-	void call(GraphAttributes& GA, NodeArray<NodeArray<double>>& shortestPathMatrix,
-			NodeArray<NodeArray<double>>& weightMatrix);
+	void call(GraphAttributes& GA, NodeMatrix<double, true>& shortestPathMatrix,
+			NodeMatrix<double, true>& weightMatrix);
 
 	//! Calculates the weight matrix of the shortest path matrix. This is done by w_ij = s_ij^{-2}
-	void calcWeights(const Graph& G, NodeArray<NodeArray<double>>& shortestPathMatrix,
-			NodeArray<NodeArray<double>>& weightMatrix);
+	void calcWeights(const Graph& G, NodeMatrix<double, true>& shortestPathMatrix,
+			NodeMatrix<double, true>& weightMatrix);
 
 	//! Calculates the intial layout of the graph if necessary.
 	void computeInitialLayout(GraphAttributes& GA);
@@ -185,22 +230,18 @@ private:
 			NodeArray<double>& prevXCoords, NodeArray<double>& prevYCoords, const double prevStress,
 			const double curStress);
 
-	//! Convenience method to initialize the matrices.
-	void initMatrices(const Graph& G, NodeArray<NodeArray<double>>& shortestPathMatrix,
-			NodeArray<NodeArray<double>>& weightMatrix);
-
 	//! Minimizes the stress for each component separately given
 	//! the shortest path matrix and the weight matrix.
-	void minimizeStress(GraphAttributes& GA, NodeArray<NodeArray<double>>& shortestPathMatrix,
-			NodeArray<NodeArray<double>>& weightMatrix);
+	void minimizeStress(GraphAttributes& GA, NodeMatrix<double, true>& shortestPathMatrix,
+			NodeMatrix<double, true>& weightMatrix);
 
 	//! Runs the next iteration of the stress minimization process. Note that serial update
 	//! is used.
-	void nextIteration(GraphAttributes& GA, NodeArray<NodeArray<double>>& shortestPathMatrix,
-			NodeArray<NodeArray<double>>& weightMatrix);
+	void nextIteration(GraphAttributes& GA, NodeMatrix<double, true>& shortestPathMatrix,
+			NodeMatrix<double, true>& weightMatrix);
 
 	//! Replaces infinite distances to the given value
-	void replaceInfinityDistances(NodeArray<NodeArray<double>>& shortestPathMatrix, double newVal);
+	void replaceInfinityDistances(NodeMatrix<double, true>& shortestPathMatrix, double newVal);
 };
 
 void StressMinimization::fixXCoordinates(bool fix) { m_fixXCoords = fix; }
@@ -233,4 +274,10 @@ void StressMinimization::setForcing2DLayout(bool forcing2DLayout) {
 	m_forcing2DLayout = forcing2DLayout;
 }
 
+void StressMinimization::useSparseStress(bool sparseStress) { m_sparseStress = sparseStress; }
+
+void StressMinimization::setNumberOfSparsePivots(int numberOfPivots) {
+	m_numberOfSparsePivots = (numberOfPivots > 0) ? numberOfPivots : DEFAULT_NUMBER_OF_SPARSE_PIVOTS;
+}
+
 }
@@ -32,7 +32,9 @@
 #pragma once
 
 #include <ogdf/basic/Math.h>
+#include <ogdf/basic/System.h>
 #include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/intrinsics.h> // IWYU pragma: keep
 #include <ogdf/energybased/fast_multipole_embedder/ArrayGraph.h>
 #include <ogdf/energybased/fast_multipole_embedder/EdgeChain.h>
 #include <ogdf/energybased/fast_multipole_embedder/FMEThread.h>
@@ -158,15 +160,41 @@ inline void eval_direct(float* x1, float* y1, float* s1, float* fx1, float* fy1,
 }
 
 
+#ifdef OGDF_AVX2_EXTENSIONS
+//! AVX2 version of eval_direct(); may only be called if the CPU supports AVX2 and FMA
+void eval_direct_avx2(float* x, float* y, float* s, float* fx, float* fy, size_t n);
+
+//! AVX2 version of eval_direct(); may only be called if the CPU supports AVX2 and FMA
+void eval_direct_avx2(float* x1, float* y1, float* s1, float* fx1, float* fy1, size_t n1,
+		float* x2, float* y2, float* s2, float* fx2, float* fy2, size_t n2);
+
+//! returns true if eval_direct_avx2() can be used on this CPU
+inline bool eval_direct_use_avx2() {
+	return System::cpuSupports(CPUFeature::AVX2) && System::cpuSupports(CPUFeature::FMA);
+}
+#endif
+
 #ifndef OGDF_FME_KERNEL_USE_SSE_DIRECT
 //! kernel function to evaluate forces between n points with coords x, y directly. result is stored in fx, fy
 inline void eval_direct_fast(float* x, float* y, float* s, float* fx, float* fy, size_t n) {
+#	ifdef OGDF_AVX2_EXTENSIONS
+	if (eval_direct_use_avx2()) {
+		eval_direct_avx2(x, y, s, fx, fy, n);
+		return;
+	}
+#	endif
 	eval_direct(x, y, s, fx, fy, n);
 }
 
 //! kernel function to evaluate forces between two sets of points with coords x1, y1 (x2, y2) directly. result is stored in fx1, fy1 (fx2, fy2
 inline void eval_direct_fast(float* x1, float* y1, float* s1, float* fx1, float* fy1, size_t n1,
 		float* x2, float* y2, float* s2, float* fx2, float* fy2, size_t n2) {
+#	ifdef OGDF_AVX2_EXTENSIONS
+	if (eval_direct_use_avx2()) {
+		eval_direct_avx2(x1, y1, s1, fx1, fy1, n1, x2, y2, s2, fx2, fy2, n2);
+		return;
+	}
+#	endif
 	eval_direct(x1, y1, s1, fx1, fy1, n1, x2, y2, s2, fx2, fy2, n2);
 }
 
@@ -80,6 +80,9 @@ public:
 	//! the quadtree
 	const LinearQuadtree& tree() { return m_tree; }
 
+	//! uses the scalar kernels even if the CPU supports AVX2 or AVX-512, e.g., to compare results
+	void useScalarKernels();
+
 private:
 	//! allocates the space for the coeffs
 	void allocate();
@@ -87,6 +90,12 @@ private:
 	//! releases the memory for the coeffs
 	void deallocate();
 
+	//! precomputes the binomial weights used by M2M, L2L and M2L
+	void initWeights();
+
+	//! selects the kernels for the instruction sets supported by the CPU
+	void initKernels();
+
 	//! the Quadtree reference
 	const LinearQuadtree& m_tree;
 
@@ -105,6 +114,31 @@ public:
 	uint32_t m_numCoeff;
 
 	BinCoeff<double> binCoef;
+
+private:
+	//! Adds the sum of w[2i] * x_i for i in [0, n) to the complex number res,
+	//! where x is an array of complex coefficients.
+	using WeightedSum = void (*)(const double* w, const double* x, uint32_t n, double* res);
+
+	//! Adds the sum of w[2i] * x_i * y_i for i in [0, n) to the complex number res,
+	//! where x and y are arrays of complex coefficients.
+	using WeightedProductSum = void (*)(const double* w, const double* x, const double* y,
+			uint32_t n, double* res);
+
+	//! weights of M2M: row j holds binom(j-1, i-1) for i = 1..j
+	double* m_m2mWeights;
+
+	//! weights of L2L: row j holds binom(k, j) for k = j..numCoeff-1
+	double* m_l2lWeights;
+
+	//! weights of M2L: row j holds binom(j+k-1, k-1) for k = 1..numCoeff-1
+	double* m_m2lWeights;
+
+	//! kernel computing weighted sums (scalar, AVX2 or AVX-512)
+	WeightedSum m_weightedSum;
+
+	//! kernel computing weighted sums of products (scalar, AVX2 or AVX-512)
+	WeightedProductSum m_weightedProductSum;
 };
 
 }
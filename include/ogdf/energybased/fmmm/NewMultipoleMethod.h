@@ -73,6 +73,12 @@ public:
 	//! Import updated information of the drawing area.
 	void update_boxlength_and_cornercoordinate(double b_l, DPoint d_l_c);
 
+	//! Returns the maximal number of threads used for the force calculation.
+	unsigned int max_threads() const { return _max_threads; }
+
+	//! Sets the maximal number of threads used for the force calculation to \p t.
+	void max_threads(unsigned int t) { _max_threads = ((t >= 1) ? t : 1); }
+
 private:
 	//! The minimum number of nodes for which the forces are
 	//! calculated using NMM (for lower values the exact
@@ -87,6 +93,7 @@ private:
 	FMMMOptions::SmallestCellFinding _find_small_cell;
 	int _particles_in_leaves; //!< max. number of particles for leaves of the quadtree
 	int _precision; //!< precision for p-term multipole expansion
+	unsigned int _max_threads; //!< max. number of threads used for force calculation
 
 	double boxlength; //!< length of drawing box
 	DPoint down_left_corner; //!< down left corner of drawing box
@@ -313,6 +320,16 @@ private:
 	void form_multipole_expansion_of_subtree(NodeArray<NodeAttributes>& A, QuadTreeNM& T,
 			List<QuadTreeNodeNM*>& quad_tree_leaves);
 
+	//! The Lists ME and LE are initialized and the centers are set for all nodes of the
+	//! subtree rooted at act_ptr in the same order as in
+	//! form_multipole_expansion_of_subtree(); its leaves are appended to quad_tree_leaves.
+	void init_expansions_and_centers_of_subtree(QuadTreeNodeNM* act_ptr,
+			List<QuadTreeNodeNM*>& quad_tree_leaves);
+
+	//! The shifted ME Lists are added bottom-up for all inner nodes of the subtree rooted
+	//! at act_ptr; precondition: the ME Lists of all leaves are calculated.
+	void add_shifted_expansions_of_subtree(QuadTreeNodeNM* act_ptr);
+
 	//! The Lists ME and LE are both initialized to zero entries for *act_ptr.
 	void init_expansion_Lists(QuadTreeNodeNM* act_ptr);
 
@@ -332,6 +349,17 @@ private:
 	void calculate_local_expansions_and_WSPRLS(NodeArray<NodeAttributes>& A,
 			QuadTreeNodeNM* act_node_ptr);
 
+	//! The lists D1, D2, M and LE are calculated for act_node_ptr only; precondition: they
+	//! have already been calculated for all ancestors of act_node_ptr.
+	void calculate_local_expansions_and_WSPRLS_of_node(NodeArray<NodeAttributes>& A,
+			QuadTreeNodeNM* act_node_ptr);
+
+	//! Like calculate_local_expansions_and_WSPRLS(), but the upper levels of T are
+	//! traversed until enough independent subtrees are found, which are then processed
+	//! by up to max_threads() threads.
+	void calculate_local_expansions_and_WSPRLS_in_parallel(NodeArray<NodeAttributes>& A,
+			QuadTreeNodeNM* root_ptr);
+
 	//! If the small cell of ptr_1 and ptr_2 are well separated true is returned (else
 	//! false).
 	bool well_separated(QuadTreeNodeNM* ptr_1, QuadTreeNodeNM* ptr_2);
@@ -353,6 +381,33 @@ private:
 	void add_local_expansion_of_leaf(NodeArray<NodeAttributes>& A, QuadTreeNodeNM* leaf_ptr,
 			QuadTreeNodeNM* act_ptr);
 
+	//! The force contribution defined by leaf_ptr->get_local_exp() is calculated
+	//! for all nodes contained in the leaf *leaf_ptr and stored in F_local_exp.
+	void transform_local_exp_to_forces_of_leaf(NodeArray<NodeAttributes>& A,
+			const QuadTreeNodeNM* leaf_ptr, NodeArray<DPoint>& F_local_exp);
+
+	//! The force contribution defined by all nodes in leaf_ptr->get_M() is calculated
+	//! for all nodes contained in the leaf *leaf_ptr and added to F_multipole_exp.
+	void transform_multipole_exp_to_forces_of_leaf(NodeArray<NodeAttributes>& A,
+			const QuadTreeNodeNM* leaf_ptr, NodeArray<DPoint>& F_multipole_exp);
+
+	//! The force contributions from all leaves in leaf_ptr->get_D1() and
+	//! leaf_ptr->get_D2() are calculated for the leaf *leaf_ptr and added to F_direct.
+	void calculate_neighbourcell_forces_of_leaf(NodeArray<NodeAttributes>& A,
+			const QuadTreeNodeNM* leaf_ptr, NodeArray<DPoint>& F_direct);
+
+	//! The forces F_local_exp, F_multipole_exp and F_direct are calculated for all
+	//! leaves in quad_tree_leaves by up to max_threads() threads.
+	/**
+	 * The leaves are split into contiguous chunks, one per thread. Since the direct
+	 * forces between neighbouring leaves are also added to nodes of other chunks, each
+	 * thread accumulates them in its own array and the arrays are summed up in a fixed
+	 * order afterwards. Thus, the result only depends on the number of threads.
+	 */
+	void calculate_leaf_forces_in_parallel(const Graph& G, NodeArray<NodeAttributes>& A,
+			List<QuadTreeNodeNM*>& quad_tree_leaves, NodeArray<DPoint>& F_direct,
+			NodeArray<DPoint>& F_multipole_exp, NodeArray<DPoint>& F_local_exp);
+
 	//! For each leaf v in quad_tree_leaves the force contribution defined by
 	//! v.get_local_exp() is calculated and stored in F_local_exp.
 	void transform_local_exp_to_forces(NodeArray<NodeAttributes>& A,
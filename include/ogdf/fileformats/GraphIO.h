@@ -102,6 +102,7 @@ public:
 		ClusterAttrReaderFunc cluster_attr_reader_func;
 		ClusterAttrReaderFunc auto_cluster_attr_reader_func;
 		ClusterAttrWriterFunc cluster_attr_writer_func;
+		bool binary; //!< whether files of this type have to be opened in binary mode
 
 		explicit FileType(std::vector<std::string> extensions, ReaderFunc readerFunc = nullptr,
 				WriterFunc writerFunc = nullptr, AttrReaderFunc attrReaderFunc = nullptr,
@@ -115,6 +116,9 @@ public:
 				AttrReaderFunc attrReaderFunc = nullptr,
 				ClusterReaderFunc clusterReaderFunc = nullptr,
 				ClusterAttrReaderFunc clusterAttrReaderFunc = nullptr);
+
+		//! Marks files of this type as binary files.
+		FileType& markBinary();
 	};
 
 	static const OGDF_EXPORT std::vector<FileType> FILE_TYPES;
@@ -294,6 +298,14 @@ public:
 	 * 	<td>.mtx
 	 * 	<td>X<td> <td> <td> <td> <td> <td> <td>
 	 * <tr>
+	 * 	<td>EdgeList
+	 * 	<td>.edgelist, .edges
+	 * 	<td>X<td>X<td> <td> <td> <td> <td> <td>
+	 * <tr>
+	 * 	<td>Binary
+	 * 	<td>.ogdfbin
+	 * 	<td>X<td>X<td>X<td>X<td> <td> <td> <td>
+	 * <tr>
 	 * 	<td>TikZ
 	 * 	<td>.tex
 	 * 	<td> <td> <td> <td>X<td> <td> <td> <td>X
@@ -895,6 +907,157 @@ public:
 
 	//! @}
 
+#pragma mark EdgeList
+	/**
+	 * @name EdgeList
+	 *
+	 * Plain edge lists as used, e.g., by the Stanford Large Network Dataset Collection (SNAP).
+	 * Every line either describes an edge by the indices of its source and target node
+	 * (non-negative integers separated by whitespace or a comma; further values such as weights are
+	 * ignored), is empty, or is a comment starting with \c # or \c %.
+	 * The nodes are numbered 0, ..., n-1, where n is one more than the largest index
+	 * occurring in the file, unless a comment of the form <tt># Nodes: n</tt> specifies
+	 * a larger number of nodes.
+	 *
+	 * Since all nodes up to the largest index are created, reading fails if n would
+	 * exceed maxEdgeListNodes(). This keeps a corrupt line such as <tt>0 2000000000</tt>
+	 * from exhausting the memory.
+	 */
+	//! @{
+
+	//! Returns the maximal number of nodes of a graph read from an edge list.
+	static int maxEdgeListNodes() { return s_maxEdgeListNodes; }
+
+	//! Sets the maximal number of nodes of a graph read from an edge list to \p n.
+	/**
+	 * The default is 100,000,000.
+	 */
+	static void setMaxEdgeListNodes(int n) {
+		if (n >= 0) {
+			s_maxEdgeListNodes = n;
+		}
+	}
+
+	//! Reads graph \p G as an edge list from input stream \p is.
+	/**
+	 * The stream is processed line by line and every edge is added to \p G as soon
+	 * as it has been parsed.
+	 * Use readEdgeList(Graph&, const string&, unsigned int) for large files.
+	 *
+	 * \sa writeEdgeList(const Graph &G, std::ostream &os)
+	 *
+	 * @param G   is assigned the read graph.
+	 * @param is  is the input stream to be read.
+	 * @return true if successful, false otherwise.
+	 */
+	static OGDF_EXPORT bool readEdgeList(Graph& G, std::istream& is);
+
+	//! Reads graph \p G as an edge list from the file \p filename.
+	/**
+	 * The file is memory-mapped (if supported by the system) and parsed in place.
+	 * With a single thread, every edge is added to \p G as soon as it has been parsed.
+	 * Otherwise, the file is split into \p numThreads ranges of lines that are parsed
+	 * in parallel, after which the edges are added to \p G in the order of the file.
+	 * The ranges are parsed by ThreadPool::global() within its thread budget.
+	 *
+	 * @param G          is assigned the read graph.
+	 * @param filename   is the name of the file to be read.
+	 * @param numThreads is the maximal number of threads used for parsing.
+	 * @return true if successful, false otherwise.
+	 */
+	static OGDF_EXPORT bool readEdgeList(Graph& G, const string& filename,
+			unsigned int numThreads = 1);
+
+	//! Writes graph \p G as an edge list to output stream \p os.
+	/**
+	 * The edge list is preceded by a comment stating the number of nodes and edges,
+	 * so isolated nodes are preserved when reading it with readEdgeList().
+	 *
+	 * \sa readEdgeList(Graph &G, std::istream &is)
+	 *
+	 * @param G   is the graph to be written.
+	 * @param os  is the output stream to which the graph will be written.
+	 * @return true if successful, false otherwise.
+	 */
+	static OGDF_EXPORT bool writeEdgeList(const Graph& G, std::ostream& os);
+
+	//! @}
+
+#pragma mark Binary
+	/**
+	 * @name Binary
+	 *
+	 * Compact, versioned binary format of OGDF intended for quickly storing and loading
+	 * (large) graphs together with their layout, e.g., for caching.
+	 *
+	 * A file starts with a 40 byte header consisting of the signature
+	 * <tt>\\x89OGDF\\r\\n\\x1a</tt>, the 32 bit integers 0x01020304 (to detect the
+	 * byte order), version, flags (bit 0: GraphAttributes::directed()) and 0, followed by
+	 * the 64 bit numbers of nodes and edges.
+	 * Afterwards, a sequence of blocks follows, each consisting of a 32 bit block type,
+	 * 32 zero bits, the 64 bit length of the payload and the payload itself, padded
+	 * with zeros to a multiple of 8 bytes; a block of type 0 ends the file.
+	 * Nodes and edges are numbered 0, 1, ... in the order of Graph::nodes and Graph::edges,
+	 * and all values are stored as plain arrays in the byte order of the writing machine,
+	 * so each block is suitably aligned for being memory-mapped.
+	 *
+	 * Besides the edges, the format stores the following GraphAttributes (if enabled):
+	 * coordinates (including GraphAttributes::threeD), sizes and shapes of nodes (all
+	 * GraphAttributes::nodeGraphics), GraphAttributes::edgeGraphics (bend points),
+	 * GraphAttributes::nodeWeight, GraphAttributes::edgeIntWeight,
+	 * GraphAttributes::edgeDoubleWeight, GraphAttributes::nodeLabel and GraphAttributes::edgeLabel.
+	 * Blocks of unknown type or of attributes that are not enabled are skipped when reading.
+	 *
+	 * \warning Streams have to be opened in binary mode (\c std::ios::binary).
+	 */
+	//! @{
+
+	//! Reads graph \p G in OGDF's binary format from input stream \p is.
+	/**
+	 * \sa writeBinary(const Graph &G, std::ostream &os)
+	 *
+	 * @param G   is assigned the read graph.
+	 * @param is  is the input stream to be read.
+	 * @return true if successful, false otherwise.
+	 */
+	static OGDF_EXPORT bool readBinary(Graph& G, std::istream& is);
+
+	//! Reads graph \p G with attributes \p GA in OGDF's binary format from input stream \p is.
+	/**
+	 * Only the attributes enabled in \p GA are read.
+	 *
+	 * \pre \p G is the graph associated with attributes \p GA.
+	 * \sa writeBinary(const GraphAttributes &GA, std::ostream &os)
+	 *
+	 * @param GA  is assigned the graph's attributes.
+	 * @param G   is assigned the read graph.
+	 * @param is  is the input stream to be read.
+	 * @return true if successful, false otherwise.
+	 */
+	static OGDF_EXPORT bool readBinary(GraphAttributes& GA, Graph& G, std::istream& is);
+
+	//! Writes graph \p G in OGDF's binary format to output stream \p os.
+	/**
+	 * \sa readBinary(Graph &G, std::istream &is)
+	 *
+	 * @param G   is the graph to be written.
+	 * @param os  is the output stream to which the graph will be written.
+	 * @return true if successful, false otherwise.
+	 */
+	static OGDF_EXPORT bool writeBinary(const Graph& G, std::ostream& os);
+
+	//! Writes graph with attributes \p GA in OGDF's binary format to output stream \p os.
+	/**
+	 * \sa readBinary(GraphAttributes &GA, Graph &G, std::istream &is)
+	 *
+	 * @param GA  specifies the graph and its attributes to be written.
+	 * @param os  is the output stream to which the graph will be written.
+	 * @return true if successful, false otherwise.
+	 */
+	static OGDF_EXPORT bool writeBinary(const GraphAttributes& GA, std::ostream& os);
+
+	//! @}
+
 #pragma mark Rudy
 	/**
 	 * @name Rudy
@@ -1942,6 +2105,7 @@ public:
 private:
 	static OGDF_EXPORT char s_indentChar; //!< Character used for indentation.
 	static OGDF_EXPORT int s_indentWidth; //!< Number of indent characters used for indentation.
+	static OGDF_EXPORT int s_maxEdgeListNodes; //!< Maximal number of nodes read from an edge list.
 };
 
 }
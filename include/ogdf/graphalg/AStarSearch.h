@@ -35,6 +35,7 @@
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/PriorityQueue.h>
 #include <ogdf/basic/basic.h>
+#include <ogdf/basic/heap/PairingHeap.h>
 
 #include <functional>
 
@@ -50,13 +51,16 @@ namespace ogdf {
  * The algorithm can also be used to compute approximate solutions at a faster pace.
  *
  * @tparam T The type of edge cost
+ * @tparam H The heap used as priority queue. A monotone heap like ogdf::MonotoneRadixHeap
+ *           may only be used for integral edge costs and a consistent heuristic with a
+ *           maximal gap of 1 (e.g. the default heuristic).
  *
  * @ingroup ga-sp
  */
-template<typename T>
+template<typename T, template<typename P, class C> class H = PairingHeap>
 class AStarSearch {
 private:
-	using NodeQueue = PrioritizedMapQueue<node, T>;
+	using NodeQueue = PrioritizedMapQueue<node, T, std::less<T>, H>;
 
 	bool m_directed;
 	double m_maxGap;
@@ -0,0 +1,246 @@
+/** \file
+ * \brief Reusable workspace for repeated runs of Dijkstra's algorithm on the same graph
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/ArrayBuffer.h>
+#include <ogdf/basic/EpsilonTest.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/List.h>
+#include <ogdf/basic/PriorityQueue.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/heap/PairingHeap.h>
+
+#include <functional>
+#include <limits>
+
+namespace ogdf {
+
+/*!
+ * \brief Workspace for many runs of %Dijkstra's algorithm on the same graph.
+ *
+ * @ingroup ga-sp
+ *
+ * Algorithms that start a shortest path search from many nodes of the same graph
+ * (e.g. Steiner tree preprocessing) spend much of their time in allocating and
+ * initializing the node arrays and the priority queue of Dijkstra. This class keeps
+ * these data structures alive between runs. All node data is tagged with the number of
+ * the run that wrote it, so starting a new run takes constant time and a run only costs
+ * time proportional to the part of the graph it actually explores.
+ *
+ * A run may additionally be given a set of target nodes; it terminates as soon as the
+ * shortest paths to all of them are known.
+ *
+ * The workspace stays valid when nodes or edges are added to or removed from the graph
+ * between runs.
+ */
+template<typename T, template<typename P, class C> class H = PairingHeap>
+class DijkstraWorkspace {
+	using Queue = PrioritizedQueue<node, T, std::less<T>, H>;
+
+public:
+	//! Creates an empty workspace; call init() before the first run.
+	DijkstraWorkspace() = default;
+
+	//! Creates a workspace for \p G.
+	explicit DijkstraWorkspace(const Graph& G) { init(G); }
+
+	//! Prepares the workspace for runs on \p G. Takes time linear in the size of \p G.
+	void init(const Graph& G) {
+		m_graph = &G;
+		m_distance.init(G);
+		m_predecessor.init(G);
+		m_handle.init(G);
+		m_reachedStamp.init(G, 0);
+		m_settledStamp.init(G, 0);
+		m_targetStamp.init(G, 0);
+		m_stamp = 1;
+		m_reached.clear();
+		m_queue.clear();
+	}
+
+	//! Computes shortest paths from \p sources in the graph passed to init().
+	/**
+	 * @param weight The (non-negative) edge weights
+	 * @param sources A list of distinct source nodes
+	 * @param targets The run terminates once the distances to all these nodes are known.
+	 *        If empty, the search is not terminated early.
+	 * @param directed True iff the graph should be interpreted as a directed graph
+	 * @param arcsReversed True if the arcs should be followed in reverse. It has only
+	 * an effect when setting \p directed to true
+	 * @param maxLength Upper bound on path length
+	 */
+	void call(const EdgeArray<T>& weight, const List<node>& sources, const List<node>& targets,
+			bool directed = false, bool arcsReversed = false,
+			T maxLength = std::numeric_limits<T>::max()) {
+		OGDF_ASSERT(m_graph != nullptr);
+		nextStamp();
+
+		int remainingTargets = 0;
+		for (node t : targets) {
+			if (m_targetStamp[t] != m_stamp) {
+				m_targetStamp[t] = m_stamp;
+				++remainingTargets;
+			}
+		}
+		for (node s : sources) {
+			OGDF_ASSERT(!reached(s));
+			reach(s, 0, nullptr);
+		}
+
+		while (!m_queue.empty()) {
+			node v = m_queue.topElement();
+			m_queue.pop();
+			m_settledStamp[v] = m_stamp;
+
+			if (m_targetStamp[v] == m_stamp && --remainingTargets == 0) {
+				break;
+			}
+
+			for (adjEntry adj : v->adjEntries) {
+				edge e = adj->theEdge();
+				node w = adj->twinNode();
+				if (directed
+						&& ((!arcsReversed && e->target() == v)
+								|| (arcsReversed && e->target() != v))) {
+					continue;
+				}
+				OGDF_ASSERT(weight[e] >= 0);
+
+				const T newDistance = m_distance[v] + weight[e];
+				if (m_eps.greater(newDistance, maxLength)) {
+					// using this edge would result in a path length greater than our upper bound
+					continue;
+				}
+				if (!reached(w)) {
+					reach(w, newDistance, e);
+				} else if (!settled(w) && m_eps.greater(m_distance[w], newDistance)) {
+					OGDF_ASSERT(std::numeric_limits<T>::max() - weight[e] >= m_distance[v]);
+					m_queue.decrease(m_handle[w], (m_distance[w] = newDistance));
+					m_predecessor[w] = e;
+				}
+			}
+		}
+
+		// only nodes whose distance is not final remain; this is bounded by the touched part
+		m_queue.clear();
+	}
+
+	//! Computes shortest paths from \p sources without terminating early at target nodes.
+	//! @copydetails call(const EdgeArray<T>&, const List<node>&, const List<node>&, bool, bool, T)
+	void call(const EdgeArray<T>& weight, const List<node>& sources, bool directed = false,
+			bool arcsReversed = false, T maxLength = std::numeric_limits<T>::max()) {
+		call(weight, sources, List<node>(), directed, arcsReversed, maxLength);
+	}
+
+	//! Computes shortest paths from \p source, terminating once \p target is settled
+	//! (if not \c nullptr).
+	void call(const EdgeArray<T>& weight, node source, node target = nullptr,
+			bool directed = false, bool arcsReversed = false,
+			T maxLength = std::numeric_limits<T>::max()) {
+		List<node> sources, targets;
+		sources.pushBack(source);
+		if (target != nullptr) {
+			targets.pushBack(target);
+		}
+		call(weight, sources, targets, directed, arcsReversed, maxLength);
+	}
+
+	//! Returns whether \p v has been reached by the last run.
+	bool reached(node v) const { return m_reachedStamp[v] == m_stamp; }
+
+	//! Returns whether the distance of \p v computed by the last run is final.
+	/**
+	 * Every reached node is settled unless the run terminated early at its targets,
+	 * in which case distance() is only an upper bound for unsettled nodes.
+	 */
+	bool settled(node v) const { return m_settledStamp[v] == m_stamp; }
+
+	//! Returns the distance of \p v from the sources, or the maximum value of \a T if
+	//! \p v has not been reached.
+	T distance(node v) const {
+		return reached(v) ? m_distance[v] : std::numeric_limits<T>::max();
+	}
+
+	//! Returns the last edge on the shortest path to \p v, or \c nullptr if \p v is
+	//! a source or has not been reached.
+	edge predecessor(node v) const { return reached(v) ? m_predecessor[v] : nullptr; }
+
+	//! Returns the nodes reached by the last run in the order in which they were reached.
+	const ArrayBuffer<node>& reachedNodes() const { return m_reached; }
+
+	//! Copies the result of the last run into arrays as filled by Dijkstra::call().
+	//! Takes time linear in the number of nodes.
+	void copyTo(NodeArray<edge>& predecessor, NodeArray<T>& distance) const {
+		predecessor.init(*m_graph, nullptr);
+		distance.init(*m_graph, std::numeric_limits<T>::max());
+		for (node v : m_reached) {
+			predecessor[v] = m_predecessor[v];
+			distance[v] = m_distance[v];
+		}
+	}
+
+private:
+	const Graph* m_graph = nullptr; //!< The graph the workspace was initialized for
+	EpsilonTest m_eps; //!< For floating point comparisons (if floating point is used)
+
+	NodeArray<T> m_distance; //!< Distances, valid for reached nodes only
+	NodeArray<edge> m_predecessor; //!< Predecessors, valid for reached nodes only
+	NodeArray<typename Queue::Handle> m_handle; //!< Queue handles, valid for reached nodes only
+	NodeArray<unsigned int> m_reachedStamp; //!< Number of the last run that reached a node
+	NodeArray<unsigned int> m_settledStamp; //!< Number of the last run that settled a node
+	NodeArray<unsigned int> m_targetStamp; //!< Number of the last run a node was a target of
+	unsigned int m_stamp = 1; //!< Number of the current run (node stamps start below it)
+
+	ArrayBuffer<node> m_reached; //!< Nodes reached by the current run
+	Queue m_queue; //!< Nodes reached but not yet settled
+
+	//! Starts a new run, invalidating all node data of the previous one.
+	void nextStamp() {
+		if (m_stamp == std::numeric_limits<unsigned int>::max()) {
+			m_reachedStamp.fill(0);
+			m_settledStamp.fill(0);
+			m_targetStamp.fill(0);
+			m_stamp = 1;
+		}
+		++m_stamp;
+		m_reached.clear();
+	}
+
+	//! Marks \p v as reached with distance \p d via edge \p e.
+	void reach(node v, T d, edge e) {
+		m_reachedStamp[v] = m_stamp;
+		m_distance[v] = d;
+		m_predecessor[v] = e;
+		m_handle[v] = m_queue.push(v, d);
+		m_reached.push(v);
+	}
+};
+
+}
@@ -40,6 +40,7 @@
 #include <ogdf/graphalg/MaxFlowModule.h>
 
 #include <algorithm>
+#include <limits>
 
 //#define OGDF_GT_USE_GAP_RELABEL_HEURISTIC
 #define OGDF_GT_USE_MAX_ACTIVE_LABEL
@@ -55,6 +56,9 @@ namespace ogdf {
 //! Computes a max flow via Preflow-Push (global relabeling and gap relabeling heuristic).
 /**
  * @ingroup ga-flow
+ *
+ * The frequency of the global relabeling heuristic can be set with
+ * globalRelabelFrequency(double).
  */
 template<typename TCap>
 class MaxFlowGoldbergTarjan : public MaxFlowModule<TCap> {
@@ -73,6 +77,8 @@ class MaxFlowGoldbergTarjan : public MaxFlowModule<TCap> {
 	mutable List<node> m_cutNodes;
 	mutable List<edge> m_cutEdges;
 
+	double m_globalRelabelFrequency = 1.0;
+
 	inline TCap getCap(const edge e) const {
 		return e->target() == *this->m_s ? 0 : (*this->m_cap)[e];
 	}
@@ -240,6 +246,20 @@ class MaxFlowGoldbergTarjan : public MaxFlowModule<TCap> {
 	}
 
 public:
+	//! Returns how often a global relabeling is performed.
+	double globalRelabelFrequency() const { return m_globalRelabelFrequency; }
+
+	//! Sets how often a global relabeling is performed.
+	/**
+	 * A global relabeling is done whenever the number of relabel operations since
+	 * the last one reaches the number of nodes divided by \p f. If \p f is 0, only
+	 * the initial global relabeling is done.
+	 */
+	void globalRelabelFrequency(double f) {
+		OGDF_ASSERT(f >= 0);
+		m_globalRelabelFrequency = f;
+	}
+
 	// first stage: push excess towards sink
 	TCap computeValue(const EdgeArray<TCap>& cap, const node& s, const node& t) {
 		// TODO: init this stuff in the module?
@@ -282,6 +302,11 @@ public:
 		globalRelabel(); // initialize distance labels
 
 		int relCount = 0; // counts the relabel operations for the global relabeling heuristic
+		const int relThreshold = max(1,
+				static_cast<int>(m_globalRelabelFrequency > 0
+								? min<double>(this->m_G->numberOfNodes() / m_globalRelabelFrequency,
+										  std::numeric_limits<int>::max())
+								: std::numeric_limits<int>::max()));
 #ifdef OGDF_GT_USE_MAX_ACTIVE_LABEL
 		while (m_maxLabel != 0) {
 			OGDF_ASSERT(!m_activeLabelList[m_maxLabel].empty());
@@ -334,7 +359,7 @@ public:
 							++relCount;
 #ifdef OGDF_GT_USE_GAP_RELABEL_HEURISTIC
 							// only gapRelabel if we do not do a globalRelabel directly afterwards
-							if (relCount != this->m_G->numberOfNodes()
+							if (relCount != relThreshold
 #	if (OGDF_GT_GRH_STEPS > 1)
 									&& relCount % OGDF_GT_GRH_STEPS
 											== 0 // obey frequency of gap relabel heuristic
@@ -347,7 +372,7 @@ public:
 						}
 					}
 				}
-				if (relCount == this->m_G->numberOfNodes()) {
+				if (relCount == relThreshold) {
 					relCount = 0;
 					globalRelabel();
 				}
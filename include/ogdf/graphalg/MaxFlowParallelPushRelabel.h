@@ -0,0 +1,381 @@
+/** \file
+ * \brief Declaration and implementation of a multithreaded synchronous
+ *        push-relabel max-flow algorithm
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/Thread.h>
+#include <ogdf/basic/ThreadPool.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/graphalg/MaxFlowModule.h>
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+namespace ogdf {
+
+//! Computes a max flow via a multithreaded, synchronous variant of Preflow-Push.
+/**
+ * @ingroup ga-flow
+ *
+ * The algorithm works in rounds. In each round, all active nodes are discharged
+ * in parallel along admissible edges with respect to the labels of the previous
+ * round, so no edge is used by two threads at the same time; the pushed excess is
+ * accumulated with atomic additions. Afterwards, all active nodes without
+ * admissible edges are relabeled in parallel. A global relabeling (a parallel
+ * breadth-first search from the sink) is done initially and whenever the number
+ * of relabel operations since the last one reaches the number of nodes divided
+ * by globalRelabelFrequency().
+ *
+ * The second stage, which returns the excess that cannot reach the sink to the
+ * source, uses the same scheme with the roles of source and sink exchanged.
+ *
+ * The threads are taken from ThreadPool::global().
+ */
+template<typename TCap>
+class MaxFlowParallelPushRelabel : public MaxFlowModule<TCap> {
+public:
+	using MaxFlowModule<TCap>::MaxFlowModule;
+
+	//! Returns the maximal number of threads.
+	unsigned int maxThreads() const { return m_maxThreads; }
+
+	//! Sets the maximal number of threads to \p n.
+	void maxThreads(unsigned int n) {
+#ifndef OGDF_MEMORY_POOL_NTS
+		m_maxThreads = max(1u, n);
+#endif
+	}
+
+	//! Returns how often a global relabeling is performed.
+	double globalRelabelFrequency() const { return m_globalRelabelFrequency; }
+
+	//! Sets how often a global relabeling is performed.
+	/**
+	 * A global relabeling is done whenever the number of relabel operations since
+	 * the last one reaches the number of nodes divided by \p f. If \p f is 0, only
+	 * the initial global relabeling is done.
+	 */
+	void globalRelabelFrequency(double f) {
+		OGDF_ASSERT(f >= 0);
+		m_globalRelabelFrequency = f;
+	}
+
+	// first stage: push excess towards sink
+	TCap computeValue(const EdgeArray<TCap>& cap, const node& s, const node& t) override {
+		this->m_s = &s;
+		this->m_t = &t;
+		this->m_cap = &cap;
+		this->m_flow->init(*this->m_G, (TCap)0);
+		OGDF_ASSERT(this->isFeasibleInstance());
+
+		const int size = this->m_G->maxNodeIndex() + 1;
+		m_label.init(*this->m_G, 0);
+		m_newLabel.init(*this->m_G, 0);
+		m_ex.init(*this->m_G, 0);
+		m_addedEx = std::vector<std::atomic<TCap>>(size);
+		m_isCandidate = std::vector<std::atomic<bool>>(size);
+		m_dist = std::vector<std::atomic<int>>(size);
+		for (int i = 0; i < size; ++i) {
+			m_addedEx[i].store(0, std::memory_order_relaxed);
+			m_isCandidate[i].store(false, std::memory_order_relaxed);
+		}
+		m_discovered.resize(size);
+		m_frontier.resize(size);
+
+		if (t == s) {
+			return (TCap)0;
+		}
+
+		// initialize residual graph for first preflow
+		for (edge e : this->m_G->edges) {
+			if (e->source() == s && e->target() != s) { // ignore loops
+				(*this->m_flow)[e] = getCap(e);
+				m_ex[e->target()] += getCap(e); // "+" needed for the case of multigraphs
+			}
+		}
+
+		const int n = this->m_G->numberOfNodes();
+		run(t, s, n);
+
+		TCap result = 0;
+		for (adjEntry adj : t->adjEntries) {
+			edge e = adj->theEdge();
+			if (e->target() == t) {
+				result += (*this->m_flow)[e];
+			} else {
+				result -= (*this->m_flow)[e];
+			}
+		}
+		return result;
+	}
+
+	// second stage: push excess that has not reached the sink back towards source
+	void computeFlowAfterValue() override {
+		if (*this->m_s == *this->m_t) {
+			return;
+		}
+
+		// every node with excess has a residual path to the source that avoids the sink
+		const int n = this->m_G->numberOfNodes();
+		run(*this->m_s, *this->m_t, 2 * n);
+	}
+
+	using MaxFlowModule<TCap>::useEpsilonTest;
+	using MaxFlowModule<TCap>::init;
+	using MaxFlowModule<TCap>::computeFlow;
+	using MaxFlowModule<TCap>::computeFlowAfterValue;
+
+private:
+	//! Nodes processed by a single task of parallelFor().
+	static constexpr int CHUNK_SIZE = 256;
+
+#ifdef OGDF_MEMORY_POOL_NTS
+	unsigned int m_maxThreads = 1u;
+#else
+	unsigned int m_maxThreads = max(1u, Thread::hardware_concurrency());
+#endif
+	double m_globalRelabelFrequency = 1.0;
+
+	node m_target = nullptr; //!< The sink of the current stage
+	node m_blocked = nullptr; //!< Neither sends nor receives excess in the current stage
+	int m_labelLimit = 0; //!< Nodes with at least this label are not active
+
+	NodeArray<int> m_label; //!< Labels of the last round
+	NodeArray<int> m_newLabel; //!< Labels computed in the current round
+	NodeArray<TCap> m_ex; //!< Excess, only modified by the node itself
+	std::vector<std::atomic<TCap>> m_addedEx; //!< Excess received in the current round
+	//! Whether a node is in #m_workingSet or #m_discovered
+	std::vector<std::atomic<bool>> m_isCandidate;
+	std::vector<std::atomic<int>> m_dist; //!< Distances of the global relabeling
+
+	std::vector<node> m_workingSet; //!< Active nodes of the current round
+	std::vector<node> m_discovered; //!< Nodes that became candidates in the current round
+	std::atomic<int> m_numDiscovered {0};
+	std::vector<node> m_frontier; //!< Frontier of the global relabeling
+	std::atomic<int> m_numRelabels {0};
+
+	inline TCap getCap(const edge e) const {
+		return e->target() == *this->m_s ? 0 : (*this->m_cap)[e];
+	}
+
+	//! Returns the residual capacity of the edge of \p adj in direction from its node.
+	inline TCap residual(const adjEntry adj) const {
+		const edge e = adj->theEdge();
+		if (adj->theNode() == e->source()) {
+			return getCap(e) - (*this->m_flow)[e];
+		}
+		return (*this->m_flow)[e];
+	}
+
+	inline bool isResidualEdge(const adjEntry adj) const {
+		return this->m_et->greater(residual(adj), (TCap)0);
+	}
+
+	inline bool isActive(const node v) const {
+		return v != m_target && v != m_blocked && this->m_et->greater(m_ex[v], (TCap)0)
+				&& m_label[v] < m_labelLimit;
+	}
+
+	static void atomicAdd(std::atomic<TCap>& value, TCap delta) {
+		TCap old = value.load(std::memory_order_relaxed);
+		while (!value.compare_exchange_weak(old, old + delta, std::memory_order_relaxed)) { }
+	}
+
+	template<typename Func>
+	void parallelFor(int count, Func&& func) {
+		ThreadPool::global().parallelFor(0, count, m_maxThreads, std::forward<Func>(func),
+				CHUNK_SIZE);
+	}
+
+	//! Moves excess to \p target until no node with a label below \p labelLimit is active.
+	void run(node target, node blocked, int labelLimit) {
+		m_target = target;
+		m_blocked = blocked;
+		m_labelLimit = labelLimit;
+
+		const int n = this->m_G->numberOfNodes();
+		const int relabelThreshold = max(1,
+				static_cast<int>(m_globalRelabelFrequency > 0
+								? min<double>(n / m_globalRelabelFrequency, INT_MAX)
+								: INT_MAX));
+
+		globalRelabel();
+		m_numRelabels = 0;
+		while (!m_workingSet.empty()) {
+			for (node v : m_workingSet) {
+				m_isCandidate[v->index()].store(true, std::memory_order_relaxed);
+			}
+			m_numDiscovered = 0;
+
+			const int numActive = static_cast<int>(m_workingSet.size());
+			parallelFor(numActive, [&](int i) { discharge(m_workingSet[i]); });
+
+			// all nodes that were active or received excess in this round
+			const int numDiscovered = m_numDiscovered;
+			auto candidate = [&](int i) {
+				return i < numActive ? m_workingSet[i] : m_discovered[i - numActive];
+			};
+			const int numCandidates = numActive + numDiscovered;
+
+			parallelFor(numCandidates, [&](int i) {
+				node v = candidate(i);
+				m_ex[v] += m_addedEx[v->index()].exchange(0, std::memory_order_relaxed);
+				m_isCandidate[v->index()].store(false, std::memory_order_relaxed);
+				m_newLabel[v] = isActive(v) ? relabeled(v) : m_label[v];
+			});
+			for (node v : {m_target, m_blocked}) {
+				m_ex[v] += m_addedEx[v->index()].exchange(0, std::memory_order_relaxed);
+			}
+			parallelFor(numCandidates, [&](int i) {
+				node v = candidate(i);
+				m_label[v] = m_newLabel[v];
+			});
+
+			std::vector<node> nextWorkingSet;
+			for (int i = 0; i < numCandidates; ++i) {
+				node v = candidate(i);
+				if (isActive(v)) {
+					nextWorkingSet.push_back(v);
+				}
+			}
+			m_workingSet.swap(nextWorkingSet);
+
+			if (m_numRelabels >= relabelThreshold) {
+				globalRelabel();
+				m_numRelabels = 0;
+			}
+		}
+	}
+
+	//! Pushes excess of \p v along admissible edges (w.r.t. the labels of the last round).
+	void discharge(node v) {
+		TCap ex = m_ex[v];
+		const int label = m_label[v];
+		for (adjEntry adj : v->adjEntries) {
+			if (!this->m_et->greater(ex, (TCap)0)) {
+				break;
+			}
+			const node w = adj->twinNode();
+			// checking the label first ensures that the edge is not used by w in this round
+			if (m_label[w] + 1 != label) {
+				continue;
+			}
+			const TCap value = min(ex, residual(adj));
+			if (!this->m_et->greater(value, (TCap)0)) {
+				continue;
+			}
+
+			const edge e = adj->theEdge();
+			if (v == e->source()) {
+				(*this->m_flow)[e] += value;
+			} else {
+				(*this->m_flow)[e] -= value;
+			}
+			ex -= value;
+			atomicAdd(m_addedEx[w->index()], value);
+			if (w != m_target && w != m_blocked
+					&& !m_isCandidate[w->index()].exchange(true, std::memory_order_relaxed)) {
+				m_discovered[m_numDiscovered++] = w;
+			}
+		}
+		m_ex[v] = ex;
+	}
+
+	//! Returns the new label of the active node \p v (w.r.t. the labels of the last round).
+	int relabeled(node v) {
+		const int label = m_label[v];
+		int minLabel = m_labelLimit;
+		for (adjEntry adj : v->adjEntries) {
+			if (isResidualEdge(adj)) {
+				const int newLabel = m_label[adj->twinNode()] + 1;
+				if (newLabel == label) { // admissible edge left, no relabel
+					return label;
+				}
+				minLabel = min(minLabel, newLabel);
+			}
+		}
+		OGDF_ASSERT(minLabel > label);
+		++m_numRelabels;
+		return minLabel;
+	}
+
+	//! Sets the labels to the distances to #m_target in the residual graph and
+	//! collects all active nodes in #m_workingSet.
+	void globalRelabel() {
+		const int unseen = -1;
+		for (node v : this->m_G->nodes) {
+			m_dist[v->index()].store(unseen, std::memory_order_relaxed);
+		}
+		m_dist[m_target->index()] = 0;
+		m_dist[m_blocked->index()] = m_labelLimit;
+
+		// level-synchronous breadth-first search; the frontier of the current level
+		// is m_frontier[begin, end), the next one is appended behind it
+		m_frontier[0] = m_target;
+		int begin = 0;
+		int end = 1;
+		std::atomic<int> next {end};
+		for (int level = 1; begin < end; ++level) {
+			parallelFor(end - begin, [&](int i) {
+				const node w = m_frontier[begin + i];
+				for (adjEntry adj : w->adjEntries) {
+					const node x = adj->twinNode();
+					int expected = unseen;
+					if (isResidualEdge(adj->twin())
+							&& m_dist[x->index()].compare_exchange_strong(expected, level,
+									std::memory_order_relaxed)) {
+						m_frontier[next++] = x;
+					}
+				}
+			});
+			begin = end;
+			end = next;
+		}
+
+		m_workingSet.clear();
+		for (node v : this->m_G->nodes) {
+			const int dist = m_dist[v->index()].load(std::memory_order_relaxed);
+			m_label[v] = dist == unseen ? m_labelLimit : dist;
+			if (isActive(v)) {
+				m_workingSet.push_back(v);
+			}
+		}
+		// the blocked node must never be admissible
+		m_label[m_blocked] = m_labelLimit;
+	}
+};
+
+}
@@ -52,7 +52,8 @@ class NodeSet;
  * No. UCB/CSD-84-171, 1984.
  * https://www2.eecs.berkeley.edu/Pubs/TechRpts/1984/CSD-84-171.pdf
  *
- * Internally, the MinSTCutMaxFlow algorithm (using MaxFlowGoldbergTarjan) is
+ * Internally, the MinSTCutMaxFlow algorithm (using MaxFlowGoldbergTarjan, or
+ * MaxFlowParallelPushRelabel if \p maxThreads is greater than 1) is
  * called \f$\mathcal{O}(\log n)\f$ times. Assuming a runtime of
  * \f$\mathcal{O}(mn^2)\f$ for the min cut algorithm, the overall runtime is
  * \f$\mathcal{O}(mn^2\log n)\f$.
@@ -77,11 +78,13 @@ class NodeSet;
  * @param resultNodeMap maps each subgraph node (nodes of G) to some other node
  * @param timelimit set to a value greater than -1 to set a timelimit in milliseconds.
  *                  Note that 0 is a valid timelimit. When encountering a timelimit there is no valid result.
+ * @param maxThreads the maximal number of threads used for each max-flow computation.
  *
  * @returns true, if the algorithm was successful and did not run into a timeout.
  */
 OGDF_EXPORT bool maximumDensitySubgraph(
 		Graph& G, NodeSet& subgraphNodes,
-		std::function<node(node)> resultNodeMap = [](node v) { return v; }, int64_t timelimit = -1);
+		std::function<node(node)> resultNodeMap = [](node v) { return v; }, int64_t timelimit = -1,
+		unsigned int maxThreads = 1);
 
 }
@@ -0,0 +1,573 @@
+/** \file
+ * \brief Definition of ogdf::MinCostFlowCostScaling class template
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/graphalg/MinCostFlowModule.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace ogdf {
+
+//! Computes a min-cost flow using Goldberg's cost-scaling push-relabel method.
+/**
+ * @ingroup ga-flow
+ *
+ * The algorithm (A. V. Goldberg: "An efficient implementation of a scaling minimum-cost
+ * flow algorithm", J. Algorithms 22, 1997) scales the edge costs and computes an
+ * \a epsilon-optimal flow for geometrically decreasing values of \a epsilon by
+ * push-relabel operations, interleaved with global price updates. Feasibility is ensured
+ * by artificial arcs of high cost, as in MinCostFlowReinelt.
+ *
+ * All internal buffers are kept between calls, so solving many problems of similar size
+ * with the same instance does not allocate memory. If warmStart() is set, the node prices
+ * of the previous call are reused for the next problem with the same number of nodes
+ * (and the same node order). The search then starts with the final scaling phase, which
+ * is much faster if only a few edges have changed.
+ *
+ * \pre The costs must be integral. Let \a n be the number of nodes and \a C the maximum
+ *      absolute cost; then \a n^3 * \a C must be considerably smaller than 2^63.
+ */
+template<typename TCost>
+class MinCostFlowCostScaling : public MinCostFlowModule<TCost> {
+	static_assert(std::is_integral<TCost>::value, "cost scaling requires integral costs");
+
+public:
+	MinCostFlowCostScaling() { }
+
+	using MinCostFlowModule<TCost>::call;
+
+	//! Computes a min-cost flow in the directed graph \p G without computing dual variables.
+	virtual bool call(const Graph& G, const EdgeArray<int>& lowerBound,
+			const EdgeArray<int>& upperBound, const EdgeArray<TCost>& cost,
+			const NodeArray<int>& supply, EdgeArray<int>& flow) override {
+		return solve(G, lowerBound, upperBound, cost, supply, flow, nullptr);
+	}
+
+	/**
+	 * \brief Computes a min-cost flow in the directed graph \p G using cost scaling.
+	 *
+	 * \pre \p lowerBound[\a e] <= \p upperBound[\a e] for all edges \a e.
+	 *      In contrast to MinCostFlowReinelt, \p G needs not be connected and
+	 *      false is returned if the supplies do not sum up to zero.
+	 *
+	 * @param G is the directed input graph.
+	 * @param lowerBound gives the lower bound for the flow on each edge.
+	 * @param upperBound gives the upper bound for the flow on each edge.
+	 * @param cost gives the costs for each edge.
+	 * @param supply gives the supply (or demand if negative) of each node.
+	 * @param flow is assigned the computed flow on each edge.
+	 * @param dual is assigned the computed dual variables.
+	 * \return true iff a feasible min-cost flow exists.
+	 */
+	virtual bool call(const Graph& G, const EdgeArray<int>& lowerBound,
+			const EdgeArray<int>& upperBound, const EdgeArray<TCost>& cost,
+			const NodeArray<int>& supply, EdgeArray<int>& flow, NodeArray<TCost>& dual) override {
+		return solve(G, lowerBound, upperBound, cost, supply, flow, &dual);
+	}
+
+	//! Returns whether the node prices of the previous call are reused.
+	bool warmStart() const { return m_warmStart; }
+
+	//! Sets whether the node prices of the previous call are reused.
+	/**
+	 * This only has an effect if the next graph has the same number of nodes as the
+	 * previous one. Nodes are identified by their position in the node list.
+	 */
+	void warmStart(bool b) { m_warmStart = b; }
+
+	//! Returns the factor by which \a epsilon is divided in each scaling phase.
+	int scalingFactor() const { return m_scalingFactor; }
+
+	//! Sets the factor by which \a epsilon is divided in each scaling phase to \p factor >= 2.
+	void scalingFactor(int factor) {
+		OGDF_ASSERT(factor >= 2);
+		m_scalingFactor = factor;
+	}
+
+private:
+	using Value = int64_t;
+
+	//! Maximum length of the paths along which augment() pushes flow.
+	static constexpr int s_maxPathLength = 4;
+
+	bool m_warmStart = false; //!< Reuse the prices of the previous call?
+	int m_scalingFactor = 8; //!< Division factor of epsilon per phase
+
+	int m_numNodes = 0; //!< Number of nodes of the network (including the root)
+
+	std::vector<int> m_nodeIndex; //!< Network node of each graph node (by index)
+	std::vector<int> m_first; //!< Arcs of node \a v are m_first[v], ..., m_first[v+1]-1
+	std::vector<int> m_head; //!< Head of each arc
+	std::vector<int> m_rev; //!< Reverse arc of each arc
+	std::vector<Value> m_resCap; //!< Residual capacity of each arc
+	std::vector<Value> m_cost; //!< Scaled cost of each arc
+	std::vector<int> m_edgeArc; //!< Forward arc of each edge (-1 for self-loops)
+	std::vector<int> m_artificialArcs; //!< Forward arcs of the artificial edges
+
+	std::vector<Value> m_excess; //!< Excess of each node
+	std::vector<Value> m_price; //!< Price of each node
+	std::vector<int> m_current; //!< Current arc of each node
+	std::vector<int> m_path; //!< Arcs of the current augmenting path
+	int m_relabels = 0; //!< Number of relabels since the last price update
+
+	std::vector<int> m_queue; //!< Ring buffer of active nodes
+	int m_queueFirst = 0; //!< Position of the first node in #m_queue
+	int m_queueSize = 0; //!< Number of nodes in #m_queue
+	std::vector<bool> m_queued; //!< Whether a node is in #m_queue
+
+	std::vector<int> m_bucketFirst; //!< First node of each bucket in price updates
+	std::vector<int> m_bucketNext; //!< Next node in the same bucket
+	std::vector<int> m_bucketPrev; //!< Previous node in the same bucket
+	std::vector<int> m_dist; //!< Distance labels of price updates
+	std::vector<bool> m_flag; //!< Scanned nodes in price updates, queued nodes for duals
+	std::vector<Value> m_potential; //!< Exact dual values
+
+	//! Computes the flow and, if \p dual is not \c nullptr, the dual variables.
+	bool solve(const Graph& G, const EdgeArray<int>& lowerBound, const EdgeArray<int>& upperBound,
+			const EdgeArray<TCost>& cost, const NodeArray<int>& supply, EdgeArray<int>& flow,
+			NodeArray<TCost>* dual);
+
+	//! Turns the current flow into an \p eps-optimal one.
+	void refine(Value eps);
+
+	//! Pushes excess of \p start along a short path of admissible arcs (partial
+	//! augmentation), relabeling nodes on the way.
+	void augment(int start, Value eps);
+
+	//! Decreases the price of \p v as far as \p eps-optimality allows, treating the
+	//! arc \p extraArc leaving \p v as residual (if not -1).
+	void relabel(int v, Value eps, int extraArc = -1);
+
+	//! Decreases node prices in order to create admissible paths to deficit nodes.
+	void updatePrices(Value eps);
+
+	//! Computes exact dual values of the final flow into #m_potential.
+	void computePotentials();
+
+	//! Returns the reduced cost of arc \p a leaving node \p v.
+	Value reducedCost(int v, int a) const { return m_cost[a] + m_price[v] - m_price[m_head[a]]; }
+
+	//! Pushes \p delta units of flow along arc \p a leaving node \p v.
+	void push(int v, int a, Value delta) {
+		m_resCap[a] -= delta;
+		m_resCap[m_rev[a]] += delta;
+		m_excess[v] -= delta;
+		m_excess[m_head[a]] += delta;
+	}
+
+	void enqueue(int v) {
+		OGDF_ASSERT(m_queueSize < m_numNodes);
+		m_queue[(m_queueFirst + m_queueSize++) % m_numNodes] = v;
+	}
+
+	int dequeue() {
+		int v = m_queue[m_queueFirst];
+		m_queueFirst = (m_queueFirst + 1) % m_numNodes;
+		--m_queueSize;
+		return v;
+	}
+
+	void insertIntoBucket(int v, int d) {
+		m_dist[v] = d;
+		m_bucketPrev[v] = -1;
+		m_bucketNext[v] = m_bucketFirst[d];
+		if (m_bucketFirst[d] >= 0) {
+			m_bucketPrev[m_bucketFirst[d]] = v;
+		}
+		m_bucketFirst[d] = v;
+	}
+
+	void removeFromBucket(int v) {
+		if (m_bucketPrev[v] >= 0) {
+			m_bucketNext[m_bucketPrev[v]] = m_bucketNext[v];
+		} else {
+			m_bucketFirst[m_dist[v]] = m_bucketNext[v];
+		}
+		if (m_bucketNext[v] >= 0) {
+			m_bucketPrev[m_bucketNext[v]] = m_bucketPrev[v];
+		}
+	}
+};
+
+template<typename TCost>
+bool MinCostFlowCostScaling<TCost>::solve(const Graph& G, const EdgeArray<int>& lowerBound,
+		const EdgeArray<int>& upperBound, const EdgeArray<TCost>& cost,
+		const NodeArray<int>& supply, EdgeArray<int>& flow, NodeArray<TCost>* dual) {
+	const int n = G.numberOfNodes();
+	const int numNodes = n + 1;
+	const int root = n;
+
+	const bool warm = m_warmStart && m_numNodes == numNodes;
+	m_numNodes = numNodes;
+
+	// Count the arcs incident to each node and transform the lower bounds into supplies.
+	m_nodeIndex.resize(G.maxNodeIndex() + 1);
+	m_excess.assign(numNodes, 0);
+	m_first.assign(numNodes + 1, 0);
+
+	Value supplySum = 0;
+	int i = 0;
+	for (node v : G.nodes) {
+		m_nodeIndex[v->index()] = i;
+		m_excess[i] = supply[v];
+		supplySum += supply[v];
+		++i;
+	}
+	if (supplySum != 0) {
+		return false;
+	}
+
+	Value maxCost = 0;
+	int numEdges = 0;
+	for (edge e : G.edges) {
+		OGDF_ASSERT(lowerBound[e] <= upperBound[e]);
+		if (e->isSelfLoop()) {
+			continue;
+		}
+		const int s = m_nodeIndex[e->source()->index()];
+		const int t = m_nodeIndex[e->target()->index()];
+		m_excess[s] -= lowerBound[e];
+		m_excess[t] += lowerBound[e];
+		++m_first[s + 1];
+		++m_first[t + 1];
+		++numEdges;
+		maxCost = std::max(maxCost, static_cast<Value>(std::abs(static_cast<Value>(cost[e]))));
+	}
+	for (int v = 0; v < n; ++v) {
+		if (m_excess[v] != 0) {
+			++m_first[v + 1];
+			++m_first[root + 1];
+			++numEdges;
+		}
+	}
+	for (int v = 0; v < numNodes; ++v) {
+		m_first[v + 1] += m_first[v];
+	}
+
+	// Build the residual network. Costs are multiplied by numNodes + 1, so a 1-optimal
+	// flow w.r.t. the scaled costs is optimal w.r.t. the original ones.
+	const Value scale = numNodes + 1;
+	const Value bigCost = 1 + numNodes * maxCost;
+	OGDF_ASSERT(static_cast<double>(bigCost) * scale * (4.0 * numNodes + 4)
+			< static_cast<double>(std::numeric_limits<Value>::max()));
+
+	const int numArcs = 2 * numEdges;
+	m_head.resize(numArcs);
+	m_rev.resize(numArcs);
+	m_resCap.resize(numArcs);
+	m_cost.resize(numArcs);
+	m_current.assign(m_first.begin(), m_first.end() - 1);
+
+	auto addArcs = [&](int s, int t, Value capacity, Value c) {
+		const int a = m_current[s]++;
+		const int b = m_current[t]++;
+		m_head[a] = t;
+		m_head[b] = s;
+		m_rev[a] = b;
+		m_rev[b] = a;
+		m_resCap[a] = capacity;
+		m_resCap[b] = 0;
+		m_cost[a] = c * scale;
+		m_cost[b] = -c * scale;
+		return a;
+	};
+
+	m_edgeArc.clear();
+	for (edge e : G.edges) {
+		if (e->isSelfLoop()) {
+			m_edgeArc.push_back(-1);
+		} else {
+			m_edgeArc.push_back(addArcs(m_nodeIndex[e->source()->index()],
+					m_nodeIndex[e->target()->index()],
+					static_cast<Value>(upperBound[e]) - lowerBound[e], cost[e]));
+		}
+	}
+	m_artificialArcs.clear();
+	for (int v = 0; v < n; ++v) {
+		if (m_excess[v] > 0) {
+			m_artificialArcs.push_back(addArcs(v, root, m_excess[v], bigCost));
+		} else if (m_excess[v] < 0) {
+			m_artificialArcs.push_back(addArcs(root, v, -m_excess[v], bigCost));
+		}
+	}
+
+	m_queue.resize(numNodes);
+	m_queueFirst = m_queueSize = 0;
+	m_bucketNext.resize(numNodes);
+	m_bucketPrev.resize(numNodes);
+	m_dist.resize(numNodes);
+	m_flag.resize(numNodes);
+	m_queued.resize(numNodes);
+
+	// Scale epsilon down to 1. A warm start goes straight to the last phase.
+	if (warm) {
+		OGDF_ASSERT(m_price.size() == static_cast<size_t>(numNodes));
+		refine(1);
+	} else {
+		m_price.assign(numNodes, 0);
+		// The zero flow is (maxCost * scale)-optimal w.r.t. zero prices. Artificial arcs
+		// that need to be used are found by the price updates.
+		Value eps = std::max<Value>(1, maxCost * scale);
+		do {
+			eps = std::max<Value>(1, eps / m_scalingFactor);
+			refine(eps);
+		} while (eps > 1);
+	}
+
+	bool feasible = true;
+	for (int a : m_artificialArcs) {
+		if (m_resCap[m_rev[a]] > 0) {
+			feasible = false;
+		}
+	}
+
+	i = 0;
+	for (edge e : G.edges) {
+		const int a = m_edgeArc[i++];
+		flow[e] = lowerBound[e] + (a < 0 ? 0 : static_cast<int>(m_resCap[m_rev[a]]));
+	}
+
+	if (dual != nullptr) {
+		computePotentials();
+		for (node v : G.nodes) {
+			(*dual)[v] = static_cast<TCost>(
+					m_potential[root] - m_potential[m_nodeIndex[v->index()]]);
+		}
+	}
+
+	// keep prices small for later warm starts
+	const Value rootPrice = m_price[root];
+	for (Value& p : m_price) {
+		p -= rootPrice;
+	}
+
+	return feasible;
+}
+
+template<typename TCost>
+void MinCostFlowCostScaling<TCost>::refine(Value eps) {
+	// saturate all arcs of negative reduced cost; the resulting pseudoflow is 0-optimal
+	for (int v = 0; v < m_numNodes; ++v) {
+		for (int a = m_first[v]; a < m_first[v + 1]; ++a) {
+			if (m_resCap[a] > 0 && reducedCost(v, a) < 0) {
+				push(v, a, m_resCap[a]);
+			}
+		}
+	}
+
+	m_queueFirst = m_queueSize = 0;
+	for (int v = 0; v < m_numNodes; ++v) {
+		m_queued[v] = m_excess[v] > 0;
+		if (m_queued[v]) {
+			enqueue(v);
+		}
+	}
+	if (m_queueSize == 0) {
+		return;
+	}
+
+	updatePrices(eps);
+	while (m_queueSize > 0) {
+		const int v = m_queue[m_queueFirst];
+		if (m_excess[v] > 0) {
+			augment(v, eps);
+			if (m_relabels >= m_numNodes) {
+				updatePrices(eps);
+			}
+		} else {
+			dequeue();
+			m_queued[v] = false;
+		}
+	}
+}
+
+template<typename TCost>
+void MinCostFlowCostScaling<TCost>::augment(int start, Value eps) {
+	// Walk along admissible arcs until a node with deficit or the maximum path length is
+	// reached, relabeling (and retreating from) nodes without admissible arcs. Stop early
+	// when the next price update is due, since relabeling alone may take many steps to
+	// leave a dead end.
+	m_path.clear();
+	int tip = start;
+	while (static_cast<int>(m_path.size()) < s_maxPathLength && m_excess[tip] >= 0
+			&& m_relabels < m_numNodes) {
+		const int end = m_first[tip + 1];
+		int a = m_current[tip];
+		while (a < end && (m_resCap[a] == 0 || reducedCost(tip, a) >= 0)) {
+			++a;
+		}
+
+		if (a < end) {
+			m_current[tip] = a;
+			m_path.push_back(a);
+			tip = m_head[a];
+		} else if (tip == start) {
+			relabel(tip, eps);
+		} else {
+			// The reverse of the last path arc becomes residual once flow is pushed
+			// along the path, so it has to be respected when relabeling.
+			const int back = m_rev[m_path.back()];
+			relabel(tip, eps, back);
+			tip = m_head[back];
+			m_path.pop_back();
+		}
+	}
+
+	// push as much flow as possible along the path
+	int v = start;
+	for (int a : m_path) {
+		push(v, a, std::min(m_excess[v], m_resCap[a]));
+		v = m_head[a];
+		if (m_excess[v] > 0 && !m_queued[v]) {
+			m_queued[v] = true;
+			enqueue(v);
+		}
+	}
+}
+
+template<typename TCost>
+void MinCostFlowCostScaling<TCost>::relabel(int v, Value eps, int extraArc) {
+	Value maxPrice = std::numeric_limits<Value>::lowest();
+	for (int a = m_first[v]; a < m_first[v + 1]; ++a) {
+		if (m_resCap[a] > 0 || a == extraArc) {
+			maxPrice = std::max(maxPrice, m_price[m_head[a]] - m_cost[a]);
+		}
+	}
+	// nodes with excess have a residual path to a deficit, other nodes are given extraArc
+	OGDF_ASSERT(maxPrice != std::numeric_limits<Value>::lowest());
+
+	m_price[v] = maxPrice - eps;
+	m_current[v] = m_first[v];
+	++m_relabels;
+}
+
+template<typename TCost>
+void MinCostFlowCostScaling<TCost>::updatePrices(Value eps) {
+	// Compute distances d(v) from v to the deficit nodes in the residual network, where
+	// an arc of reduced cost c has length floor(c / eps) + 1 (at least 0). Decreasing
+	// each price by d(v) * eps keeps the flow eps-optimal. The search stops as soon as all
+	// nodes with excess are scanned; the remaining nodes are treated as being at the
+	// current distance. Distances are stored in buckets and bounded by 3 * n, which is the
+	// maximum price decrease (in units of eps) within a phase of a feasible problem.
+	const int numBuckets = 3 * m_numNodes + 1;
+	m_bucketFirst.assign(numBuckets, -1);
+
+	int remaining = 0;
+	for (int v = 0; v < m_numNodes; ++v) {
+		m_flag[v] = false;
+		m_dist[v] = numBuckets;
+		if (m_excess[v] < 0) {
+			insertIntoBucket(v, 0);
+		} else if (m_excess[v] > 0) {
+			++remaining;
+		}
+	}
+
+	int level = 0;
+	for (; level < numBuckets; ++level) {
+		while (m_bucketFirst[level] >= 0 && remaining > 0) {
+			const int v = m_bucketFirst[level];
+			removeFromBucket(v);
+			m_flag[v] = true;
+			if (m_excess[v] > 0) {
+				--remaining;
+			}
+
+			for (int a = m_first[v]; a < m_first[v + 1]; ++a) {
+				const int w = m_head[a];
+				const int r = m_rev[a];
+				if (m_flag[w] || m_resCap[r] == 0) {
+					continue;
+				}
+				const Value c = reducedCost(w, r);
+				const Value length = c < 0 ? 0 : c / eps + 1;
+				if (length < numBuckets - level) {
+					const int d = level + static_cast<int>(length);
+					if (d < m_dist[w]) {
+						if (m_dist[w] < numBuckets) {
+							removeFromBucket(w);
+						}
+						insertIntoBucket(w, d);
+					}
+				}
+			}
+		}
+		if (remaining == 0) {
+			break;
+		}
+	}
+
+	for (int v = 0; v < m_numNodes; ++v) {
+		m_price[v] -= (m_flag[v] ? m_dist[v] : level) * eps;
+		m_current[v] = m_first[v];
+	}
+	m_relabels = 0;
+}
+
+template<typename TCost>
+void MinCostFlowCostScaling<TCost>::computePotentials() {
+	// The final prices are almost optimal duals w.r.t. the scaled costs. Starting from
+	// them, a label-correcting shortest path computation in the residual network yields
+	// exact duals w.r.t. the original costs.
+	const Value scale = m_numNodes + 1;
+	m_potential.resize(m_numNodes);
+	m_queueFirst = m_queueSize = 0;
+	for (int v = 0; v < m_numNodes; ++v) {
+		m_potential[v] = m_price[v] / scale;
+		m_flag[v] = true;
+		enqueue(v);
+	}
+
+	while (m_queueSize > 0) {
+		const int v = dequeue();
+		m_flag[v] = false;
+		for (int a = m_first[v]; a < m_first[v + 1]; ++a) {
+			const int w = m_head[a];
+			const Value d = m_potential[v] + m_cost[a] / scale;
+			if (m_resCap[a] > 0 && d < m_potential[w]) {
+				m_potential[w] = d;
+				if (!m_flag[w]) {
+					m_flag[w] = true;
+					enqueue(w);
+				}
+			}
+		}
+	}
+}
+
+}
@@ -41,6 +41,7 @@
 #include <ogdf/basic/comparer.h>
 #include <ogdf/basic/extended_graph_alg.h>
 #include <ogdf/basic/graphics.h>
+#include <ogdf/basic/heap/PairingHeap.h>
 #include <ogdf/basic/simple_graph_alg.h>
 #include <ogdf/energybased/FMMMLayout.h>
 #include <ogdf/energybased/fmmm/FMMMOptions.h>
@@ -152,8 +153,19 @@ public:
 
 	//! Standard single-source-shortest-paths algoritm (%Dijkstra)
 	static void singleSourceShortestPathsStandard(const EdgeWeightedGraph<T>& G, node source,
+			const NodeArray<bool>& isTerminal, NodeArray<T>& distance, NodeArray<edge>& pred) {
+		singleSourceShortestPathsWithHeap<PairingHeap>(G, source, isTerminal, distance, pred);
+	}
+
+	//! Standard single-source-shortest-paths algoritm (%Dijkstra) using heap \a H
+	/**
+	 * Can be passed to the all-terminal and all-node shortest paths functions, e.g.
+	 * \c singleSourceShortestPathsWithHeap<MonotoneRadixHeap> for integral edge weights.
+	 */
+	template<template<typename P, class C> class H>
+	static void singleSourceShortestPathsWithHeap(const EdgeWeightedGraph<T>& G, node source,
 			const NodeArray<bool>&, NodeArray<T>& distance, NodeArray<edge>& pred) {
-		Dijkstra<T> sssp;
+		Dijkstra<T, H> sssp;
 		sssp.call(G, G.edgeWeights(), source, pred, distance);
 	}
 
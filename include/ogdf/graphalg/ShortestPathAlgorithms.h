@@ -31,13 +31,25 @@
 
 #pragma once
 
+#include <ogdf/basic/Array.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphAttributes.h>
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/Math.h>
+#include <ogdf/basic/NodeMatrix.h>
 #include <ogdf/basic/SList.h>
+#include <ogdf/basic/StaticGraphView.h>
+#include <ogdf/basic/ThreadPool.h>
 #include <ogdf/graphalg/Dijkstra.h>
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
 namespace ogdf {
 
 //! Computes all-pairs shortest paths in \p G using breadth-first serach (BFS).
@@ -132,6 +144,185 @@ void dijkstra_SPSS(node s, const Graph& G, NodeArray<TCost>& shortestPathMatrix,
 	sssp.call(G, edgeCosts, s, predecessor, shortestPathMatrix);
 }
 
+//! Computes single-source shortest paths from \p s in the graph view \p G using breadth-first search (BFS).
+/**
+ * @ingroup ga-sp
+ *
+ * The cost of each edge are \p edgeCosts and the result is stored in \p distance,
+ * which is indexed by the dense node indices of \p G.
+ * Unreachable nodes get distance std::numeric_limits<TCost>::max().
+ */
+template<typename TCost>
+void bfs_SPSS(node s, const StaticGraphView& G, std::vector<TCost>& distance, TCost edgeCosts) {
+	distance.assign(G.numberOfNodes(), std::numeric_limits<TCost>::max());
+	std::vector<int> queue;
+	queue.reserve(G.numberOfNodes());
+
+	int src = G.index(s);
+	distance[src] = TCost(0);
+	queue.push_back(src);
+	for (size_t head = 0; head < queue.size(); ++head) {
+		int w = queue[head];
+		TCost d = distance[w] + edgeCosts;
+		for (int i = G.adjBegin(w); i < G.adjEnd(w); ++i) {
+			int v = G.twinNode(i);
+			if (distance[v] == std::numeric_limits<TCost>::max()) {
+				distance[v] = d;
+				queue.push_back(v);
+			}
+		}
+	}
+}
+
+//! Computes single-source shortest paths from node \p s in the graph view \p G using Dijkstra's algorithm.
+/**
+ * @ingroup ga-sp
+ *
+ * The cost of an edge are given by \p edgeCosts and the result is stored in \p distance,
+ * both indexed by the dense indices of \p G.
+ * Unreachable nodes get distance std::numeric_limits<TCost>::max().
+ * Instead of a heap supporting decrease-key, a binary heap with lazy deletion is used.
+ *
+ * @param directed True iff \p G should be interpreted as a directed graph
+ */
+template<typename TCost>
+void dijkstra_SPSS(node s, const StaticGraphView& G, std::vector<TCost>& distance,
+		const std::vector<TCost>& edgeCosts, bool directed = false) {
+	OGDF_ASSERT(static_cast<int>(edgeCosts.size()) == G.numberOfEdges());
+	using Entry = std::pair<TCost, int>;
+	std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+	distance.assign(G.numberOfNodes(), std::numeric_limits<TCost>::max());
+
+	int src = G.index(s);
+	distance[src] = TCost(0);
+	queue.emplace(TCost(0), src);
+	while (!queue.empty()) {
+		Entry top = queue.top();
+		queue.pop();
+		int v = top.second;
+		if (top.first > distance[v]) {
+			continue; // outdated entry
+		}
+		int end = directed ? G.outEnd(v) : G.adjEnd(v);
+		for (int i = G.adjBegin(v); i < end; ++i) {
+			OGDF_ASSERT(edgeCosts[G.adjEdge(i)] >= 0);
+			TCost d = distance[v] + edgeCosts[G.adjEdge(i)];
+			int w = G.twinNode(i);
+			if (d < distance[w]) {
+				distance[w] = d;
+				queue.emplace(d, w);
+			}
+		}
+	}
+}
+
+namespace internal {
+
+//! Runs \p sssp for every node of \p G as source and stores the results row-wise in \p distance.
+/**
+ * The sources are distributed over at most \p maxThreads threads of ThreadPool::global(); the
+ * calling thread is one of them.
+ * \p sssp is called as <tt>sssp(s, row)</tt> and has to fill \p row (indexed by the dense indices
+ * of \p G) as bfs_SPSS(node, const StaticGraphView&, std::vector<TCost>&, TCost) does.
+ * If \p distance is symmetric, the searches are assumed to yield symmetric distances.
+ */
+template<typename TCost, bool Symmetric, typename SSSP>
+void parallel_SPAP(const StaticGraphView& G, NodeMatrix<TCost, Symmetric>& distance,
+		unsigned int maxThreads, SSSP sssp) {
+	const int n = G.numberOfNodes();
+	const TCost unreachable = std::numeric_limits<TCost>::has_infinity
+			? std::numeric_limits<TCost>::infinity()
+			: std::numeric_limits<TCost>::max();
+	distance.init(*G.graphOf());
+
+	std::atomic<int> nextSource(0);
+	auto worker = [&] {
+		std::vector<TCost> row;
+		for (int s = nextSource++; s < n; s = nextSource++) {
+			sssp(G.nodeOf(s), row);
+			node v = G.nodeOf(s);
+			for (int w = 0; w < n; ++w) {
+				// a symmetric entry is written only by the search from its later node
+				if (!Symmetric || w <= s) {
+					distance(v, G.nodeOf(w)) =
+							row[w] == std::numeric_limits<TCost>::max() ? unreachable : row[w];
+				}
+			}
+		}
+	};
+
+	const int nThreads =
+			std::min(static_cast<int>(ThreadPool::global().threadBudget(maxThreads)), n);
+	ThreadPool::global().parallelFor(0, nThreads, nThreads, [&](int) { worker(); });
+}
+
+}
+
+//! Computes all-pairs shortest paths in \p G using breadth-first search (BFS), optionally in parallel.
+/**
+ * @ingroup ga-sp
+ *
+ * The cost of each edge are \p edgeCosts. The result is stored in \p distance,
+ * which is reinitialized for \p G.
+ * Unreachable pairs get distance std::numeric_limits<TCost>::infinity() (or
+ * std::numeric_limits<TCost>::max() if \p TCost has no infinity).
+ *
+ * The single-source searches are distributed over at most \p maxThreads threads.
+ */
+template<typename TCost, bool Symmetric>
+void bfs_SPAP(const Graph& G, NodeMatrix<TCost, Symmetric>& distance, TCost edgeCosts,
+		unsigned int maxThreads = 1) {
+	StaticGraphView view(G);
+	internal::parallel_SPAP(view, distance, maxThreads,
+			[&](node s, std::vector<TCost>& row) { bfs_SPSS(s, view, row, edgeCosts); });
+}
+
+//! Computes all-pairs shortest paths in \p GA using %Dijkstra's algorithm, optionally in parallel.
+/**
+ * @ingroup ga-sp
+ *
+ * The cost of an edge \a e are given by GA.doubleWeight(\a e); see
+ * bfs_SPAP(const Graph&, NodeMatrix<TCost, Symmetric>&, TCost, unsigned int) for the
+ * handling of \p distance and the parallelization.
+ *
+ * @return returns the average edge cost
+ */
+template<typename TCost, bool Symmetric>
+double dijkstra_SPAP(const GraphAttributes& GA, NodeMatrix<TCost, Symmetric>& distance,
+		unsigned int maxThreads = 1) {
+	const Graph& G = GA.constGraph();
+	StaticGraphView view(G);
+	std::vector<TCost> edgeCosts(G.numberOfEdges());
+	double avgCosts = 0;
+	for (edge e : G.edges) {
+		edgeCosts[view.index(e)] = GA.doubleWeight(e);
+		avgCosts += edgeCosts[view.index(e)];
+	}
+	internal::parallel_SPAP(view, distance, maxThreads,
+			[&](node s, std::vector<TCost>& row) { dijkstra_SPSS(s, view, row, edgeCosts); });
+	return avgCosts / G.numberOfEdges();
+}
+
+//! Computes all-pairs shortest paths in graph \p G using %Dijkstra's algorithm, optionally in parallel.
+/**
+ * @ingroup ga-sp
+ *
+ * The cost of an edge are given by \p edgeCosts; see
+ * bfs_SPAP(const Graph&, NodeMatrix<TCost, Symmetric>&, TCost, unsigned int) for the
+ * handling of \p distance and the parallelization.
+ */
+template<typename TCost, bool Symmetric>
+void dijkstra_SPAP(const Graph& G, NodeMatrix<TCost, Symmetric>& distance,
+		const EdgeArray<TCost>& edgeCosts, unsigned int maxThreads = 1) {
+	StaticGraphView view(G);
+	std::vector<TCost> viewCosts(G.numberOfEdges());
+	for (edge e : G.edges) {
+		viewCosts[view.index(e)] = edgeCosts[e];
+	}
+	internal::parallel_SPAP(view, distance, maxThreads,
+			[&](node s, std::vector<TCost>& row) { dijkstra_SPSS(s, view, row, viewCosts); });
+}
+
 //! Computes all-pairs shortest paths in graph \p G using Floyd-Warshall's algorithm.
 /**
  * @ingroup ga-sp
@@ -151,4 +342,23 @@ void floydWarshall_SPAP(NodeArray<NodeArray<TCost>>& shortestPathMatrix, const G
 	}
 }
 
+//! Computes all-pairs shortest paths in graph \p G using Floyd-Warshall's algorithm.
+/**
+ * @ingroup ga-sp
+ *
+ * Note that the \p shortestPathMatrix has to be initialized and all entries must be positive.
+ * The costs of non-adjacent nodes should be set to std::numeric_limits<TCost>::infinity().
+ */
+template<typename TCost, bool Symmetric>
+void floydWarshall_SPAP(NodeMatrix<TCost, Symmetric>& shortestPathMatrix, const Graph& G) {
+	for (node u : G.nodes) {
+		for (node v : G.nodes) {
+			for (node w : G.nodes) {
+				Math::updateMin(shortestPathMatrix(v, w),
+						shortestPathMatrix(u, v) + shortestPathMatrix(u, w));
+			}
+		}
+	}
+}
+
 }
@@ -43,7 +43,7 @@
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/extended_graph_alg.h>
 #include <ogdf/basic/simple_graph_alg.h>
-#include <ogdf/graphalg/Dijkstra.h>
+#include <ogdf/graphalg/DijkstraWorkspace.h>
 #include <ogdf/graphalg/MinSteinerTreeMehlhorn.h>
 #include <ogdf/graphalg/MinSteinerTreeTakahashi.h>
 #include <ogdf/graphalg/SteinerTreeLowerBoundDualAscent.h>
@@ -614,9 +614,10 @@ protected:
 	T computeRadiusSum() const;
 
 	//! Compute first and second best terminals according to function \p dist
+	//! using the shortest paths from \p v computed in \p dijkstra
 	template<typename LAMBDA>
 	void computeOptimalTerminals(node v, LAMBDA dist, node& optimalTerminal1,
-			node& optimalTerminal2, NodeArray<T>& distance) const;
+			node& optimalTerminal2, DijkstraWorkspace<T>& dijkstra) const;
 
 	//! Mark successors of \p currentNode in its shortest-path tree in \p voronoiRegions
 	void markSuccessors(node currentNode, const Voronoi<T>& voronoiRegions,
@@ -1790,6 +1791,10 @@ bool SteinerTreePreprocessing<T>::reachabilityTest(int maxDegreeTest, const int
 
 	steiner_tree::HeavyPathDecomposition<T> tprimeHPD(tprime);
 
+	// only the distances to the terminals are needed, so each search stops once they are settled
+	DijkstraWorkspace<T> dijkstra(m_copyGraph);
+	List<node> source;
+
 	// check which nodes can be deleted
 	for (node v = m_copyGraph.firstNode(), nextV; v; v = nextV) {
 		nextV = v->succ();
@@ -1799,11 +1804,9 @@ bool SteinerTreePreprocessing<T>::reachabilityTest(int maxDegreeTest, const int
 		}
 
 		// compute v's farthest and closest terminals
-		Dijkstra<T> dijkstra;
-
-		NodeArray<T> distance(m_copyGraph);
-		NodeArray<edge> predecessor(m_copyGraph, nullptr);
-		dijkstra.call(m_copyGraph, m_copyGraph.edgeWeights(), v, predecessor, distance);
+		source.clear();
+		source.pushBack(v);
+		dijkstra.call(m_copyGraph.edgeWeights(), source, m_copyTerminals);
 
 		// compute first, second nearest terminals and farthest terminal
 		node farthestTerminal = nullptr;
@@ -1811,22 +1814,22 @@ bool SteinerTreePreprocessing<T>::reachabilityTest(int maxDegreeTest, const int
 		T distanceToClosestTerminal1 = std::numeric_limits<T>::max(),
 		  distanceToClosestTerminal2 = std::numeric_limits<T>::max();
 		for (node terminal : m_copyTerminals) {
-			if (distanceToFarthestTerminal < distance[terminal]) {
+			if (distanceToFarthestTerminal < dijkstra.distance(terminal)) {
 				farthestTerminal = terminal;
-				distanceToFarthestTerminal = distance[terminal];
+				distanceToFarthestTerminal = dijkstra.distance(terminal);
 			}
 
-			if (distanceToClosestTerminal1 > distance[terminal]) {
+			if (distanceToClosestTerminal1 > dijkstra.distance(terminal)) {
 				distanceToClosestTerminal2 = distanceToClosestTerminal1;
-				distanceToClosestTerminal1 = distance[terminal];
+				distanceToClosestTerminal1 = dijkstra.distance(terminal);
 			} else {
-				if (distanceToClosestTerminal2 > distance[terminal]) {
-					distanceToClosestTerminal2 = distance[terminal];
+				if (distanceToClosestTerminal2 > dijkstra.distance(terminal)) {
+					distanceToClosestTerminal2 = dijkstra.distance(terminal);
 				}
 			}
 		}
 
-		if (predecessor[farthestTerminal] == nullptr // is not in the same component with the terminals
+		if (dijkstra.predecessor(farthestTerminal) == nullptr // is not in the same component with the terminals
 				|| distanceToClosestTerminal2
 						== std::numeric_limits<T>::max() // cannot reach at least 2 terminals, must be deleted
 				|| m_eps.geq(distanceToFarthestTerminal + distanceToClosestTerminal1
@@ -1834,7 +1837,7 @@ bool SteinerTreePreprocessing<T>::reachabilityTest(int maxDegreeTest, const int
 						upperBoundCost)) {
 			changed = true;
 			// delete the node
-			if (predecessor[farthestTerminal] != nullptr
+			if (dijkstra.predecessor(farthestTerminal) != nullptr
 					&& distanceToClosestTerminal2 != std::numeric_limits<T>::max()
 					&& m_eps.less(distanceToFarthestTerminal + distanceToClosestTerminal1,
 							upperBoundCost)) {
@@ -1853,26 +1856,24 @@ bool SteinerTreePreprocessing<T>::reachabilityTest(int maxDegreeTest, const int
 template<typename T>
 template<typename LAMBDA>
 void SteinerTreePreprocessing<T>::computeOptimalTerminals(node v, LAMBDA dist,
-		node& optimalTerminal1, node& optimalTerminal2, NodeArray<T>& distance) const {
-	// run Dijkstra starting from v
-	Dijkstra<T> dijkstra;
-
-	distance.init(m_copyGraph);
-	NodeArray<edge> predecessor(m_copyGraph, nullptr);
-	dijkstra.call(m_copyGraph, m_copyGraph.edgeWeights(), v, predecessor, distance);
+		node& optimalTerminal1, node& optimalTerminal2, DijkstraWorkspace<T>& dijkstra) const {
+	// run Dijkstra starting from v until all terminals are settled
+	List<node> source;
+	source.pushBack(v);
+	dijkstra.call(m_copyGraph.edgeWeights(), source, m_copyTerminals);
 
 	for (node terminal : m_copyTerminals) {
-		if (predecessor[terminal] == nullptr) {
+		if (dijkstra.predecessor(terminal) == nullptr) {
 			continue;
 		}
 
 		if (optimalTerminal1 == nullptr
-				|| dist(optimalTerminal1, distance) > dist(terminal, distance)) {
+				|| dist(optimalTerminal1, dijkstra) > dist(terminal, dijkstra)) {
 			optimalTerminal2 = optimalTerminal1;
 			optimalTerminal1 = terminal;
 		} else {
 			if (optimalTerminal2 == nullptr
-					|| dist(optimalTerminal2, distance) > dist(terminal, distance)) {
+					|| dist(optimalTerminal2, dijkstra) > dist(terminal, dijkstra)) {
 				optimalTerminal2 = terminal;
 			}
 		}
@@ -1907,14 +1908,14 @@ bool SteinerTreePreprocessing<T>::cutReachabilityTest() {
 		}
 		cK += minCostOfAdjacentEdge[terminal];
 	}
-	auto dist = [&minCostOfAdjacentEdge](node terminal, const NodeArray<T>& distance) {
-		return distance[terminal] - minCostOfAdjacentEdge[terminal];
+	auto dist = [&minCostOfAdjacentEdge](node terminal, const DijkstraWorkspace<T>& dijkstra) {
+		return dijkstra.distance(terminal) - minCostOfAdjacentEdge[terminal];
 	};
 
 	List<node> delNodes;
 	std::set<edge> delEdges;
-	NodeArray<T> vDistance;
-	NodeArray<T> wDistance;
+	DijkstraWorkspace<T> vDistance(m_copyGraph);
+	DijkstraWorkspace<T> wDistance(m_copyGraph);
 	for (node v = m_copyGraph.firstNode(), nextV; v; v = nextV) {
 		nextV = v->succ();
 
@@ -41,12 +41,19 @@
 #include <ogdf/basic/basic.h>
 
 #include <ostream>
+#include <vector>
 
 namespace ogdf {
 
 //! realizes Hopcroft/Tarjan algorithm for finding the triconnected
 //! components of a biconnected multi-graph
-//! @ingroup ga-connectivity
+/**
+ * @ingroup ga-connectivity
+ *
+ * All depth-first searches are non-recursive, so the depth of the palm tree is
+ * not limited by the call stack. The adjacency and HIGHPT lists are doubly linked
+ * lists of indices into flat arrays instead of List objects.
+ */
 class OGDF_EXPORT Triconnectivity {
 	explicit Triconnectivity(Graph* G);
 
@@ -145,11 +152,16 @@ private:
 	bool TSTACK_notEOS() { return m_TSTACK_a[m_top] != -1; }
 
 	//! create a new empty component
-	CompStruct& newComp() { return m_component[m_numComp++]; }
+	CompStruct& newComp() {
+		if (m_numComp == m_component.size()) {
+			m_component.grow(max(m_numComp, 16));
+		}
+		return m_component[m_numComp++];
+	}
 
 	//! create a new empty component of type t
 	CompStruct& newComp(CompType t) {
-		CompStruct& C = m_component[m_numComp++];
+		CompStruct& C = newComp();
 		C.m_type = t;
 		return C;
 	}
@@ -157,16 +169,14 @@ private:
 	//! type of edges with respect to palm tree
 	enum class EdgeType { unseen, tree, frond, removed };
 
-	//! first dfs traversal
-	void DFS1(node v, node u);
-	//! special version for triconnectivity test
-	void DFS1(node v, node u, node& s1);
+	//! first dfs traversal starting at \p root; assigns a cut vertex to \p s1 if there is one
+	void DFS1(node root, node& s1);
 
 	//! constructs ordered adjaceny lists
 	void buildAcceptableAdjStruct();
 	//! the second dfs traversal
 	void DFS2();
-	void pathFinder(node v);
+	void pathFinder(node root);
 
 	//! finding of split components
 	/**
@@ -175,8 +185,8 @@ private:
 	 */
 	bool pathSearch(node init_v, bool fail_fast, node& s1, node& s2);
 	//! pathSearch() helper for the non-fail-fast version
-	void afterRecursivePathSearch(const node v, const int vnum, const int outv,
-			const ListIterator<edge> it, const edge e, const node w, int wnum);
+	void afterRecursivePathSearch(const node v, const int vnum, const int outv, const int slot,
+			const edge e, const node w, int wnum);
 	//! pathSearch() helper for the fail-fast version
 	bool afterRecursivePathSearch(const node v, const int vnum, const int outv, const edge e,
 			const node w, const int wnum, node& s1, node& s2);
@@ -189,13 +199,46 @@ private:
 	void printStacks() const;
 
 	//! returns high(v) value
-	int high(node v) { return (m_HIGHPT[v].empty()) ? 0 : m_HIGHPT[v].front(); }
+	int high(node v) { return (m_HIGHPT[v] < 0) ? 0 : m_highItems[m_HIGHPT[v]].value; }
 
 	void delHigh(edge e) {
-		ListIterator<int> it = m_IN_HIGH[e];
-		if (it.valid()) {
-			node v = e->target();
-			m_HIGHPT[v].del(it);
+		int i = m_IN_HIGH[e];
+		if (i >= 0) {
+			HighItem& item = m_highItems[i];
+			if (item.prev >= 0) {
+				m_highItems[item.prev].next = item.next;
+			} else {
+				m_HIGHPT[e->target()] = item.next;
+			}
+			if (item.next >= 0) {
+				m_highItems[item.next].prev = item.prev;
+			}
+			m_IN_HIGH[e] = -1;
+		}
+	}
+
+	//! returns the first edge in the adjacency list of \p v
+	edge firstAdj(node v) const { return m_adjSlots[m_A[v]].e; }
+
+	//! returns the number of edges in the adjacency list of \p v
+	int adjSize(node v) const {
+		int size = 0;
+		for (int i = m_A[v]; i >= 0; i = m_adjSlots[i].next) {
+			++size;
+		}
+		return size;
+	}
+
+	//! removes \p slot from the adjacency list of \p v
+	void delAdj(node v, int slot) {
+		const AdjSlot& s = m_adjSlots[slot];
+		if (s.prev >= 0) {
+			m_adjSlots[s.prev].next = s.next;
+		} else {
+			m_A[v] = s.next;
+		}
+		if (s.next >= 0) {
+			m_adjSlots[s.next].prev = s.prev;
 		}
 	}
 
@@ -218,13 +261,30 @@ private:
 	Array<node> m_NODEAT; //!< node with number i
 	NodeArray<node> m_FATHER; //!< father of v in palm tree
 	EdgeArray<EdgeType> m_TYPE; //!< type of edge e
-	NodeArray<List<edge>> m_A; //!< adjacency list of v
+
+	//! element of a doubly linked adjacency list stored in #m_adjSlots
+	struct AdjSlot {
+		edge e;
+		int prev;
+		int next;
+	};
+
+	//! element of a doubly linked HIGHPT list stored in #m_highItems
+	struct HighItem {
+		int value;
+		int prev;
+		int next;
+	};
+
+	NodeArray<int> m_A; //!< first slot of the adjacency list of v, -1 if empty
+	Array<AdjSlot> m_adjSlots; //!< slots of all adjacency lists
 	NodeArray<int> m_NEWNUM; //!< (second) dfs-number of v
 	EdgeArray<bool> m_START; //!< edge starts a path
 	NodeArray<edge> m_TREE_ARC; //!< tree arc entering v
-	NodeArray<List<int>> m_HIGHPT; //!< list of fronds entering v in the order they are visited
-	EdgeArray<ListIterator<edge>> m_IN_ADJ; //!< pointer to element in adjacency list containing e
-	EdgeArray<ListIterator<int>> m_IN_HIGH; //!< pointer to element in HIGHPT list containing e
+	NodeArray<int> m_HIGHPT; //!< first item of the list of fronds entering v, -1 if empty
+	std::vector<HighItem> m_highItems; //!< items of all HIGHPT lists
+	EdgeArray<int> m_IN_ADJ; //!< slot in adjacency list containing e
+	EdgeArray<int> m_IN_HIGH; //!< item in HIGHPT list containing e, -1 if none
 	ArrayBuffer<edge> m_ESTACK; //!< stack of currently active edges
 
 	node m_start; //!< start node of dfs traversal
@@ -0,0 +1,109 @@
+/** \file
+ * \brief Declaration of class BilayerCrossingCounter.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/ArrayBuffer.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+
+#include <cstdint>
+#include <utility>
+
+namespace ogdf {
+class HierarchyLevels;
+class HierarchyLevelsBase;
+
+//! Counts crossings between two consecutive levels of a hierarchy.
+/**
+ * @ingroup gd-layered-crossmin
+ *
+ * Implements the accumulator tree algorithm by Barth, Jünger and Mutzel,
+ * which counts the crossings of \a m edges between two levels in time
+ * O(\a m log \a n). All buffers are kept between calls, so a single counter
+ * should be reused for counting the crossings of several level pairs.
+ *
+ * The incremental counterpart #swapGain() computes how the number of
+ * crossings changes when two neighboring nodes of a level are swapped in
+ * time linear in their degrees.
+ */
+class OGDF_EXPORT BilayerCrossingCounter {
+public:
+	//! Returns the number of crossings between level \p i and \p i+1 of \p levels.
+	int count(const HierarchyLevelsBase& levels, int i);
+
+	//! Returns the number of crossings between level \p i and \p i+1 for simultaneous drawing.
+	/**
+	 * Two crossing edges \a e and \a f contribute the number of subgraphs
+	 * they have in common, i.e., the number of bits set in both
+	 * \p edgeSubGraphs[\a e] and \p edgeSubGraphs[\a f] (of the original edges).
+	 */
+	int countSimDraw(const HierarchyLevels& levels, int i,
+			const EdgeArray<uint32_t>& edgeSubGraphs);
+
+	//! Returns the number of crossings that vanish when swapping neighbors \p v and \p w.
+	/**
+	 * \p v must be the left neighbor of \p w on its level. Considers the
+	 * edges to the upper and to the lower level. A negative value means that
+	 * swapping introduces crossings.
+	 */
+	static int swapGain(const HierarchyLevelsBase& levels, node v, node w);
+
+	//! Returns the number of crossings between the edges from \a v to \p adjV and
+	//! from \a w to \p adjW if \a v is placed left of \a w.
+	/**
+	 * \p adjV and \p adjW must be sorted by position, given by \p pos.
+	 */
+	template<typename Pos>
+	static int pairCrossings(const Array<node>& adjV, const Array<node>& adjW, Pos&& pos) {
+		const int vSize = adjV.size();
+		int iV = 0, sum = 0;
+
+		for (node x : adjW) {
+			int p = pos(x);
+			while (iV < vSize && pos(adjV[iV]) <= p) {
+				++iV;
+			}
+			sum += vSize - iV;
+		}
+
+		return sum;
+	}
+
+private:
+	Array<int> m_tree; //!< The accumulator tree.
+	ArrayBuffer<int> m_targets; //!< Positions of edge targets in lexicographic edge order.
+	ArrayBuffer<std::pair<int, uint32_t>> m_edges; //!< Target positions and subgraphs of edges.
+
+	//! Counts the inversions in #m_targets, which contains positions less than \p nUpper.
+	int countInversions(int nUpper);
+};
+
+}
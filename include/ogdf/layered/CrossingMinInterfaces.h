@@ -36,6 +36,7 @@
 #include <ogdf/basic/basic.h>
 
 namespace ogdf {
+class BilayerCrossingCounter;
 class Hierarchy;
 
 //! Representation of levels in hierarchies.
@@ -92,8 +93,24 @@ public:
 	//! Computes the number of crossings between level \p i and \p i+1.
 	int calculateCrossings(int i) const;
 
+	//! Computes the number of crossings between level \p i and \p i+1 using \p counter.
+	int calculateCrossings(int i, BilayerCrossingCounter& counter) const;
+
 	//! Computes the total number of crossings.
 	int calculateCrossings() const;
+
+	//! Computes the total number of crossings using \p counter.
+	int calculateCrossings(BilayerCrossingCounter& counter) const;
+
+	//! Computes the total number of crossings using up to \p numThreads threads.
+	/**
+	 * Pairs of consecutive levels are split into contiguous chunks, which are
+	 * processed in parallel on the shared ThreadPool, each with a counter of its
+	 * own. The first chunk and small hierarchies, which are processed
+	 * sequentially, use \p counter.
+	 */
+	int calculateCrossingsInParallel(unsigned int numThreads,
+			BilayerCrossingCounter& counter) const;
 };
 
 }
@@ -112,6 +112,9 @@ public:
 	int calculateCrossingsSimDraw(int i, const EdgeArray<uint32_t>* edgeSubGraphs) const;
 	//! Computes the total number of crossings (for simultaneous drawing).
 	int calculateCrossingsSimDraw(const EdgeArray<uint32_t>* edgeSubGraphs) const;
+	//! Computes the total number of crossings (for simultaneous drawing) using \p counter.
+	int calculateCrossingsSimDraw(const EdgeArray<uint32_t>* edgeSubGraphs,
+			BilayerCrossingCounter& counter) const;
 
 	//! Stores the position of nodes in \p oldPos.
 	void storePos(NodeArray<int>& oldPos) const;
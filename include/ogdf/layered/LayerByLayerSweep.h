@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <ogdf/basic/ArrayBuffer.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/memory.h>
 #include <ogdf/layered/HierarchyLevels.h>
@@ -104,10 +105,29 @@ public:
 	//! Performs clean-up.
 	virtual void cleanup() override { }
 
+	//! Returns the number of crossings reached by each run of the last #reduceCrossings() call.
+	const ArrayBuffer<int>& crossingsPerRun() const { return m_crossingsPerRun; }
+
 
 	class CrossMinMaster;
 	class CrossMinWorker;
 
+protected:
+	//! The minimal number of nodes of a level per thread when parallelizing a #call().
+	static constexpr int s_minNodesPerThread = 4096;
+
+	//! Returns the number of threads a single #call() may use.
+	/**
+	 * This is set by SugiyamaLayout depending on its maximal number of
+	 * threads and the number of runs executed concurrently.
+	 */
+	unsigned int numberOfThreads() const { return m_numThreads; }
+
+private:
+	unsigned int m_numThreads = 1; //!< The number of threads a single #call() may use.
+	ArrayBuffer<int> m_crossingsPerRun; //!< Crossings of each run of the last #reduceCrossings().
+
+public:
 	OGDF_MALLOC_NEW_DELETE
 };
 
@@ -32,8 +32,10 @@
 #pragma once
 
 #include <ogdf/basic/Array.h>
+#include <ogdf/basic/ArrayBuffer.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/LayoutModule.h>
+#include <ogdf/basic/Timeouter.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/layered/ExtendedNestingGraph.h>
 #include <ogdf/layered/HierarchyClusterLayoutModule.h>
@@ -106,6 +108,11 @@ class HierarchyLevelsBase;
  *     may not decrease after a complete top-down bottom-up traversal,
  *     before a run is terminated.
  *   </tr><tr>
+ *     <td><i>timeLimit</i><td>double<td>-1
+ *     <td>If non-negative, the crossing minimization starts new runs until
+ *     the given number of seconds since the start of the call has passed
+ *     (ignoring <i>runs</i>) and keeps the best order found so far.
+ *   </tr><tr>
  *     <td><i>arrangeCCs</i><td>bool<td>true
  *     <td>If set to true connected components are
  *     laid out separately and the resulting layouts are arranged afterwards
@@ -127,7 +134,7 @@ class HierarchyLevelsBase;
  * </table>
  *
  * The crossing minimization step of the algorithm is affected by the
- * options <i>runs</i>, <i>transpose</i>, and <i>fails</i>. The options
+ * options <i>runs</i>, <i>transpose</i>, <i>fails</i>, and <i>timeLimit</i>. The options
  * <i>alignBaseClasses</i> and <i>alignSiblings</i> are only relevant for
  * laying out mixed-upward graphs, where directed edges are interpreted
  * as <i>generlizations</i> and undirected egdes as <i>associations</i>
@@ -165,7 +172,7 @@ class HierarchyLevelsBase;
  *   </tr>
  * </table>
  */
-class OGDF_EXPORT SugiyamaLayout : public LayoutModule {
+class OGDF_EXPORT SugiyamaLayout : public LayoutModule, public Timeouter {
 #if 0
 	class CrossMinMaster;
 	class CrossMinWorker;
@@ -199,6 +206,7 @@ protected:
 	unsigned int m_maxThreads; //!< The maximal number of used threads.
 
 	int m_nCrossings; //!< Number of crossings in computed layout.
+	ArrayBuffer<int> m_crossingsPerRun; //!< Number of crossings reached by each run.
 	RCCrossings m_nCrossingsCluster;
 	Array<bool> m_levelChanged;
 
@@ -246,6 +254,28 @@ public:
 	// special call for UML graphs
 	void callUML(GraphAttributes& GA);
 
+	/**
+	 * \brief Updates the layout in \p GA of a previous call after the graph has been edited.
+	 *
+	 * Nodes with a non-negative \p rank keep their level and their relative
+	 * order, which is taken from their current x-coordinates in \p GA. Nodes
+	 * with a negative \p rank are new: they are assigned to a level next to
+	 * their ranked neighbors and, like the dummy nodes of their edges, are
+	 * moved to the position on their level causing the fewest crossings.
+	 * Afterwards, the layout module computes the final coordinates.
+	 *
+	 * Connected components are not arranged separately and simultaneous
+	 * drawing is not supported.
+	 *
+	 * @param GA is the input graph with the previous layout and is assigned
+	 *        the new layout.
+	 * @param rank is the level of each node of the previous call (e.g., as
+	 *        returned by call(GraphAttributes&, NodeArray<int>&) for an
+	 *        invalid array) or negative for new nodes; it is assigned the
+	 *        new levels.
+	 */
+	void callIncremental(GraphAttributes& GA, NodeArray<int>& rank);
+
 	/** @}
 	 *  @name Optional parameters
 	 *  @{
@@ -425,6 +455,17 @@ public:
 	//! Returns the number of crossings in the computed layout (usual graph).
 	int numberOfCrossings() const { return m_nCrossings; }
 
+	/**
+	 * \brief Returns the number of crossings reached by each crossing minimization run.
+	 *
+	 * Runs are listed in the order they finished; a run interrupted by the
+	 * time limit is included with the best number of crossings it found.
+	 * If arrangeCCs is set, the runs of all connected components are listed
+	 * one after another. Only available for LayerByLayerSweep modules and
+	 * simultaneous drawing.
+	 */
+	const ArrayBuffer<int>& crossingsPerRun() const { return m_crossingsPerRun; }
+
 	//! Returns the number of crossings in the computed layout (cluster graph).
 	RCCrossings numberOfCrossingsCluster() const { return m_nCrossingsCluster; }
 
@@ -443,6 +484,9 @@ public:
 
 	const NodeArray<int>& compGC() const { return m_compGC; };
 
+	//! Returns the System::realTime() at which the current crossing minimization stops, or -1.
+	int64_t crossMinStopTime() const { return m_crossMinStopTime; }
+
 protected:
 #if 0
 	void reduceCrossings(HierarchyLevels &levels);
@@ -454,10 +498,16 @@ protected:
 private:
 	int m_numCC;
 	NodeArray<int> m_compGC;
+	int64_t m_crossMinStopTime = -1;
+	const NodeArray<bool>* m_newNodes = nullptr; //!< The new nodes during callIncremental().
 
 	void doCall(GraphAttributes& AG, bool umlCall);
 	void doCall(GraphAttributes& AG, bool umlCall, NodeArray<int>& rank);
 
+	//! Orders the levels of \p H by the coordinates in \p AG and places the new nodes.
+	const HierarchyLevelsBase* reduceCrossingsIncremental(const Hierarchy& H,
+			const GraphAttributes& AG);
+
 #if 0
 	int traverseTopDown(HierarchyLevels &levels);
 	int traverseBottomUp(HierarchyLevels &levels);
@@ -35,8 +35,11 @@
 
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/basic.h>
+#include <ogdf/graphalg/MinCostFlowModule.h>
 #include <ogdf/orthogonal/internal/RoutingChannel.h>
 
+#include <memory>
+
 namespace ogdf {
 
 class GridLayoutMapped;
@@ -98,6 +101,12 @@ public:
 	//! set alignment option
 	void align(bool b) { m_align = b; }
 
+	//! Sets the module used for computing the min-cost flow (default: MinCostFlowReinelt).
+	//! The compaction takes ownership of \p pMinCostFlowComputer.
+	void setMinCostFlowComputer(MinCostFlowModule<int>* pMinCostFlowComputer) {
+		m_minCostFlowComputer.reset(pMinCostFlowComputer);
+	}
+
 
 private:
 	void computeCoords(CompactionConstraintGraph<int>& D, NodeArray<int>& pos,
@@ -115,6 +124,9 @@ private:
 	int m_scalingSteps; //!< number of improvement steps with decreasing separation
 	bool m_align; //!< toggle if brother nodes in hierarchies should be aligned
 
+	//! The module used for computing the min-cost flow
+	std::unique_ptr<MinCostFlowModule<int>> m_minCostFlowComputer;
+
 	EdgeArray<edge> m_dualEdge;
 	EdgeArray<int> m_flow;
 };
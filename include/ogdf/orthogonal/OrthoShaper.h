@@ -35,6 +35,10 @@
 
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/basic.h>
+#include <ogdf/graphalg/MinCostFlowModule.h>
+#include <ogdf/graphalg/MinCostFlowReinelt.h>
+
+#include <memory>
 
 namespace ogdf {
 class CombinatorialEmbedding;
@@ -47,7 +51,7 @@ public:
 	//! Types of network nodes: nodes and faces
 	enum class NetworkNodeType { low, high, inner, outer };
 
-	OrthoShaper() { setDefaultSettings(); }
+	OrthoShaper() : m_minCostFlowComputer(new MinCostFlowReinelt<int>) { setDefaultSettings(); }
 
 	~OrthoShaper() { }
 
@@ -111,6 +115,12 @@ public:
 
 	int getBendBound() { return m_startBoundBendsPerEdge; }
 
+	//! Sets the module used for computing the min-cost flow (default: MinCostFlowReinelt).
+	//! The shaper takes ownership of \p pMinCostFlowComputer.
+	void setMinCostFlowComputer(MinCostFlowModule<int>* pMinCostFlowComputer) {
+		m_minCostFlowComputer.reset(pMinCostFlowComputer);
+	}
+
 private:
 	//! distribute edges among all sides if degree > 4
 	bool m_distributeEdges;
@@ -156,6 +166,9 @@ private:
 	 */
 	int m_startBoundBendsPerEdge;
 
+	//! The module used for computing the min-cost flow
+	std::unique_ptr<MinCostFlowModule<int>> m_minCostFlowComputer;
+
 	//! Set angle boundary.
 	//! Warning: sets upper AND lower bounds, therefore may interfere with existing bounds
 	void setAngleBound(edge netArc, int angle, EdgeArray<int>& lowB, EdgeArray<int>& upB,
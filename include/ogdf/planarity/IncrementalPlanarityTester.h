@@ -0,0 +1,177 @@
+/** \file
+ * \brief Declaration of IncrementalPlanarityTester, which maintains a planar
+ * subgraph under edge insertions
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/ArrayBuffer.h>
+#include <ogdf/basic/CombinatorialEmbedding.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/HashArray.h>
+#include <ogdf/basic/List.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/decomposition/DynamicSPQRForest.h>
+#include <ogdf/planarity/PlanarityModule.h>
+
+#include <memory>
+
+namespace ogdf {
+
+//! Incremental planarity test based on dynamic SPQR-trees.
+/**
+ * @ingroup ga-planembed
+ *
+ * Maintains a planar subgraph \a H of a graph \a G under edge insertions and
+ * answers whether \a H + \a e is still planar for edges \a e of \a G. This is
+ * the core operation of greedy planar subgraph algorithms that try to add the
+ * edges of \a G one by one.
+ *
+ * The structure of \a H is kept in a DynamicSPQRForest. Whether an edge (\a u,\a v)
+ * can be added is decided on the paths from \a u to \a v in the BC-tree and in the
+ * SPQR-trees of the blocks on that path: \a H + (\a u,\a v) is planar iff in the
+ * skeleton of every R-node on these paths the representatives of \a u and \a v
+ * share a face. The embeddings of the rigid skeletons are computed on demand and
+ * kept until an insertion changes the skeleton; an edge inserted into a single
+ * rigid skeleton just splits the common face.
+ *
+ * Hence, a query takes time linear in the lengths of the tree paths plus the
+ * degrees of \a u and \a v in the rigid skeletons, and there is no need to test
+ * the whole subgraph for every edge.
+ *
+ * The PlanarityModule interface tests a graph by inserting its edges one by one;
+ * embeddings are computed by BoyerMyrvold.
+ */
+class OGDF_EXPORT IncrementalPlanarityTester : public PlanarityModule {
+public:
+	IncrementalPlanarityTester() = default;
+
+	/* needs to be deleted explicitly for MSVC<=16 and classes containing a NodeArrayP */
+	OGDF_NO_COPY(IncrementalPlanarityTester)
+
+	//! Starts with the subgraph of \p G consisting of all nodes and the edges in \p initialEdges.
+	/**
+	 * The dynamic SPQR-trees require the subgraph to be connected within each connected
+	 * component of \p G. Therefore, edges of \p G that connect different connected
+	 * components of the subgraph are added right away, like in Kruskal's algorithm.
+	 * Such an edge can always be added, so if the edges of \p G will be inserted in
+	 * a certain order, pass this order as \p insertionOrder to obtain the same subgraph
+	 * as if the edges were inserted in that order. Edges of \p G not in \p insertionOrder
+	 * are considered afterwards.
+	 *
+	 * \pre The edges in \p initialEdges induce a planar graph, and \p G is not changed
+	 * as long as the tester is used.
+	 */
+	void init(const Graph& G, const List<edge>& initialEdges = List<edge>(),
+			const List<edge>& insertionOrder = List<edge>());
+
+	//! Starts with the subgraph of \p G consisting of all nodes and the edges not in \p deleted.
+	/**
+	 * This is init() with the remaining edges of \p G as initial edges and \p deleted,
+	 * which are going to be inserted in this order, as insertion order.
+	 *
+	 * \pre The edges of \p G not in \p deleted induce a planar graph.
+	 */
+	void initWithout(const Graph& G, const List<edge>& deleted);
+
+	//! Returns true iff \p e belongs to the current planar subgraph.
+	bool contains(edge e) const { return m_contained[e]; }
+
+	//! Returns true iff adding \p e keeps the current subgraph planar.
+	bool isPlanarWith(edge e);
+
+	//! Adds \p e to the current subgraph if it stays planar and returns whether \p e is contained.
+	bool insert(edge e);
+
+	//! Returns true iff \p G is planar.
+	bool isPlanar(const Graph& G) override;
+
+	//! Returns true iff \p G is planar.
+	bool isPlanarDestructive(Graph& G) override { return isPlanar(G); }
+
+	//! Returns true iff \p G is planar, in which case \p G is planarly embedded by BoyerMyrvold.
+	bool planarEmbed(Graph& G) override;
+
+	//! Embeds the planar graph \p G using BoyerMyrvold.
+	bool planarEmbedPlanarGraph(Graph& G) override;
+
+private:
+	//! Embedding of the skeleton of an R-node.
+	struct RigidSkeleton {
+		Graph graph; //!< The skeleton graph.
+		CombinatorialEmbedding embedding; //!< The (unique) planar embedding of #graph.
+		HashArray<node, node> skeletonNode; //!< Maps the nodes of the auxiliary graph to #graph.
+		HashArray<edge, edge> skeletonEdge; //!< Maps the edges of the auxiliary graph to #graph.
+		FaceArray<int> stamp; //!< Marks faces when searching for a common face.
+		int currentStamp = 0;
+
+		RigidSkeleton() : skeletonNode(nullptr), skeletonEdge(nullptr) { }
+	};
+
+	//! A node or a (virtual) edge in a rigid skeleton.
+	struct Representative {
+		node v = nullptr;
+		edge e = nullptr;
+	};
+
+	const Graph* m_pGraph = nullptr; //!< The graph \a G.
+	EdgeArray<bool> m_contained; //!< Whether an edge of \a G belongs to the subgraph.
+
+	Graph m_subgraph; //!< The maintained subgraph, made connected by auxiliary edges.
+	NodeArray<node> m_copy; //!< Maps nodes of \a G to #m_subgraph.
+	std::unique_ptr<DynamicSPQRForest> m_forest; //!< BC- and SPQR-trees of #m_subgraph.
+	NodeArrayP<RigidSkeleton> m_rigid; //!< Embeddings of R-nodes, if computed.
+
+	ArrayBuffer<node> m_rigidOnPath; //!< The R-nodes on the paths of the last query.
+
+	//! If the last positive query ended in a single R-node, the R-node and the
+	//! adjacency entries starting the new edge in its skeleton.
+	node m_splitNode = nullptr;
+	adjEntry m_splitSource = nullptr;
+	adjEntry m_splitTarget = nullptr;
+
+	//! Returns true iff #m_subgraph stays planar when adding an edge between \p u and \p v.
+	bool test(node u, node v);
+
+	//! Returns true iff the block containing \p sH and \p tH stays planar when adding
+	//! an edge between them. \p sH and \p tH are nodes of the auxiliary graph.
+	bool testBlock(node sH, node tH);
+
+	//! Returns the embedded skeleton of the R-node \p vT.
+	RigidSkeleton& rigidSkeleton(node vT);
+
+	//! Searches for a face of \p R containing \p a and \p b; returns false if there is none.
+	bool commonFace(RigidSkeleton& R, const Representative& a, const Representative& b,
+			adjEntry& adjA, adjEntry& adjB);
+
+	//! Updates the embedded rigid skeletons after inserting an edge into #m_forest;
+	//! \p maxEdgeIndex is the maximal index of an auxiliary edge before the insertion.
+	void updateRigidSkeletons(int maxEdgeIndex);
+};
+
+}
@@ -32,14 +32,13 @@
 #pragma once
 
 #include <ogdf/basic/Graph.h>
-#include <ogdf/basic/GraphCopy.h>
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/Math.h>
 #include <ogdf/basic/Module.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/comparer.h>
-#include <ogdf/basic/extended_graph_alg.h>
+#include <ogdf/planarity/IncrementalPlanarityTester.h>
 #include <ogdf/planarity/PlanarSubgraphEmpty.h>
 #include <ogdf/planarity/PlanarSubgraphModule.h>
 
@@ -62,6 +61,7 @@ class MaximalPlanarSubgraphSimple { };
  * A (possibly non-maximal) planar subgraph is first computed by the set heuristic (default: ogdf::PlanarSubgraphEmpty).
  * Secondly, we iterate over all non-inserted edges performing one planarity test each.
  * Each edge is inserted if planarity can be maintained and discarded otherwise.
+ * The tests are performed incrementally by an IncrementalPlanarityTester.
  */
 template<typename TCost>
 class MaximalPlanarSubgraphSimple<TCost, typename std::enable_if<std::is_integral<TCost>::value>::type>
@@ -116,16 +116,11 @@ protected:
 			heuDelEdges.quicksort(GenericComparer<edge, TCost>(*pCost));
 		}
 		if (Module::isSolution(result)) {
-			GraphCopy copy(graph);
+			IncrementalPlanarityTester tester;
+			tester.initWithout(graph, heuDelEdges);
 			for (edge e : heuDelEdges) {
-				copy.delEdge(copy.copy(e));
-			}
-			for (edge e : heuDelEdges) {
-				edge f = copy.newEdge(e);
-
-				if (!isPlanar(copy)) {
+				if (!tester.insert(e)) {
 					delEdges.pushBack(e);
-					copy.delEdge(f);
 				}
 			}
 		}
@@ -244,24 +239,18 @@ protected:
 			}
 
 			if (Module::isSolution(result)) {
-				GraphCopy copy(graph);
-
 				if (pCost != nullptr) {
 					GenericComparer<edge, TCost> cmp(normalizedCost);
 					heuDelEdges.quicksort(cmp);
 				}
 
-				for (edge e : heuDelEdges) {
-					copy.delEdge(copy.copy(e));
-				}
+				IncrementalPlanarityTester tester;
+				tester.initWithout(graph, heuDelEdges);
 
 				delEdgesCurrentBest.clear();
 				for (edge e : heuDelEdges) {
-					edge f = copy.newEdge(e);
-
-					if (!isPlanar(copy)) {
+					if (!tester.insert(e)) {
 						delEdgesCurrentBest.pushBack(e);
-						copy.delEdge(f);
 					}
 				}
 
@@ -38,7 +38,7 @@
 #include <ogdf/basic/Module.h>
 #include <ogdf/basic/SList.h>
 #include <ogdf/basic/STNumbering.h>
-#include <ogdf/basic/Thread.h>
+#include <ogdf/basic/ThreadPool.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/pqtree/PQLeafKey.h>
 #include <ogdf/basic/simple_graph_alg.h>
@@ -244,7 +244,8 @@ protected:
 		copyV.init();
 
 		int nRuns = max(1, m_nRuns);
-		unsigned int nThreads = min(this->maxThreads(), (unsigned int)nRuns);
+		unsigned int nThreads =
+				ThreadPool::global().threadBudget(min(this->maxThreads(), (unsigned int)nRuns));
 
 		if (nThreads == 1) {
 			seqCall(block, pCost, nRuns, (m_nRuns == 0), delEdges);
@@ -329,17 +330,18 @@ private:
 			unsigned int nThreads, List<edge>& delEdges) {
 		ThreadMaster master(block, pCost, nRuns - nThreads);
 
+		ThreadPool::TaskGroup tasks(nThreads);
 		Array<Worker*> worker(nThreads - 1);
-		Array<Thread> thread(nThreads - 1);
 		for (unsigned int i = 0; i < nThreads - 1; ++i) {
 			worker[i] = new Worker(&master);
-			thread[i] = Thread(*worker[i]);
+			Worker* pWorker = worker[i];
+			tasks.run([pWorker] { (*pWorker)(); });
 		}
 
 		doWorkHelper(master);
 
+		tasks.wait();
 		for (unsigned int i = 0; i < nThreads - 1; ++i) {
-			thread[i].join();
 			delete worker[i];
 		}
 
@@ -0,0 +1,201 @@
+/** \file
+ * \brief Declaration of PlanarityTester, a reusable planarity test for many graphs
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/ThreadPool.h>
+#include <ogdf/basic/basic.h>
+
+#include <atomic>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace ogdf {
+
+//! Planarity test for many graphs that reuses its data structures between calls.
+/**
+ * @ingroup ga-planembed
+ *
+ * Implements the left-right planarity test (Brandes: "The Left-Right Planarity
+ * Test", 2009) on a compact adjacency array representation of the input. In
+ * contrast to BoyerMyrvold::isPlanar(), a call neither copies the graph nor
+ * allocates node or edge arrays; all buffers are kept by the object and only grow.
+ * Both depth-first searches are non-recursive. Self-loops and multi-edges are
+ * allowed.
+ *
+ * This pays off when testing large numbers of small or medium-sized graphs, e.g.
+ * candidate subgraphs or generated instances. isPlanarBatch() tests a range of
+ * graphs using several threads with one tester per thread.
+ *
+ * The test only decides planarity; use BoyerMyrvold to obtain an embedding or a
+ * Kuratowski subdivision.
+ */
+class OGDF_EXPORT PlanarityTester {
+public:
+	//! Returns true iff \p G is planar.
+	bool isPlanar(const Graph& G);
+
+	//! Returns true iff the graph with nodes 0, ..., \p numberOfNodes - 1 and the given
+	//! \p edges is planar.
+	bool isPlanar(int numberOfNodes, const std::vector<std::pair<int, int>>& edges);
+
+	//! Tests all graphs in [\p first, \p last) and stores the results in \p planar.
+	/**
+	 * @tparam Iterator A random access iterator whose value type is either
+	 *         \c Graph or <tt>const Graph*</tt>.
+	 * @param first,last The range of graphs. The graphs must not be changed concurrently.
+	 * @param planar Is assigned an array whose <i>i</i>-th entry is true iff the
+	 *        <i>i</i>-th graph of the range is planar.
+	 * @param numberOfThreads The maximal number of threads; 0 uses all threads of
+	 *        ThreadPool::global().
+	 */
+	template<typename Iterator>
+	static void isPlanarBatch(Iterator first, Iterator last, Array<bool>& planar,
+			unsigned int numberOfThreads = 0) {
+		const int n = static_cast<int>(std::distance(first, last));
+		planar.init(n);
+
+#ifdef OGDF_MEMORY_POOL_NTS
+		numberOfThreads = 1;
+#else
+		if (numberOfThreads == 0) {
+			numberOfThreads = ThreadPool::global().maxThreads();
+		}
+#endif
+		const int numTasks =
+				min(static_cast<int>(ThreadPool::global().threadBudget(numberOfThreads)), n);
+
+		// Graphs may differ a lot in size, so the tasks fetch them one by one.
+		std::atomic<int> next(0);
+		ThreadPool::global().parallelFor(0, numTasks, numberOfThreads, [&](int) {
+			PlanarityTester tester;
+			for (int i = next++; i < n; i = next++) {
+				planar[i] = tester.isPlanar(graphOf(first[i]));
+			}
+		});
+	}
+
+private:
+	//! An interval of return edges, see Brandes' paper.
+	struct Interval {
+		int low = -1;
+		int high = -1;
+
+		bool empty() const { return low < 0 && high < 0; }
+	};
+
+	//! A pair of intervals whose return edges must be on different sides.
+	struct ConflictPair {
+		Interval left;
+		Interval right;
+		int id; //!< Distinguishes conflict pairs that occupy the same stack position.
+	};
+
+	int m_numNodes = 0; //!< Number of nodes of the current graph.
+	std::vector<int> m_endpoints; //!< Endpoints of the edges of the current graph, in pairs.
+	std::vector<int> m_nodeIndex; //!< Maps node indices of a Graph to 0, ..., n-1.
+
+	// adjacency arrays
+	std::vector<int> m_first; //!< First arc of each node.
+	std::vector<int> m_arcHead; //!< Head of each arc.
+	std::vector<int> m_arcEdge; //!< Edge of each arc.
+	std::vector<int> m_mark; //!< Marks neighbors to detect multi-edges.
+
+	// orientation phase
+	std::vector<int> m_height; //!< Height of a node in the DFS forest, -1 if not visited.
+	std::vector<int> m_parentEdge; //!< Tree edge leading to a node, -1 for roots.
+	std::vector<int> m_iter; //!< Current position in the adjacency list of a node.
+	std::vector<int> m_roots; //!< Roots of the DFS forest.
+	std::vector<int> m_source; //!< Source of an oriented edge, -1 if not yet oriented.
+	std::vector<int> m_target; //!< Target of an oriented edge.
+	std::vector<int> m_lowpt; //!< Lowest return point of an edge.
+	std::vector<int> m_lowpt2; //!< Second lowest return point of an edge.
+	std::vector<int> m_nestingDepth; //!< Nesting depth of an edge.
+
+	// testing phase
+	std::vector<int> m_orderedFirst; //!< First outgoing edge of each node in #m_ordered.
+	std::vector<int> m_ordered; //!< Outgoing edges of all nodes ordered by nesting depth.
+	std::vector<int> m_bucket; //!< Buffer for sorting by nesting depth.
+	std::vector<int> m_ref; //!< Next lower return edge in the same interval.
+	std::vector<int> m_lowptEdge; //!< Return edge of an edge with lowest return point.
+	std::vector<int> m_stackBottom; //!< Id of the topmost conflict pair when visiting an edge.
+	std::vector<ConflictPair> m_conflicts; //!< The stack of conflict pairs.
+	int m_nextId = 0; //!< Id of the next conflict pair.
+
+	std::vector<int> m_dfsStack; //!< Stack of both depth-first searches.
+
+	static const Graph& graphOf(const Graph& G) { return G; }
+
+	static const Graph& graphOf(const Graph* G) { return *G; }
+
+	//! Runs the test on #m_numNodes and #m_endpoints.
+	bool test();
+
+	//! Builds the adjacency arrays, dropping multi-edges; returns the number of edges.
+	int buildAdjacency();
+
+	//! Orients the edges in DFS order and computes lowpoints and nesting depths.
+	void orient();
+
+	//! Sorts the outgoing edges of every node by nesting depth.
+	void sortByNestingDepth();
+
+	//! Runs the testing phase; returns false iff a conflict is found.
+	bool testOrientation();
+
+	//! Updates the data of \p e for its child edge \p ei at \p v; see testOrientation().
+	bool integrate(int v, int ei);
+
+	//! Adds the constraints of the return edges of \p ei to those of its parent edge \p e.
+	bool addConstraints(int ei, int e);
+
+	//! Removes the back edges ending at \p u from the conflict pair stack.
+	void trimBackEdges(int u);
+
+	int topId() const { return m_conflicts.empty() ? -1 : m_conflicts.back().id; }
+
+	int lowest(const ConflictPair& P) const {
+		if (P.left.empty()) {
+			return m_lowpt[P.right.low];
+		}
+		if (P.right.empty()) {
+			return m_lowpt[P.left.low];
+		}
+		return min(m_lowpt[P.left.low], m_lowpt[P.right.low]);
+	}
+
+	bool conflicting(const Interval& I, int b) const {
+		return I.high >= 0 && m_lowpt[I.high] > m_lowpt[b];
+	}
+};
+
+}
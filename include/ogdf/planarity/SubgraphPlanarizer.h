@@ -70,6 +70,11 @@ class PlanRepLight;
  * Minimization Heuristics</i>. 11th International Symposium on %Graph
  * Drawing 2003, Perugia (GD '03), LNCS 2912, pp. 13-24, 2004.
  *
+ * Since crossings between edges of different blocks are never necessary,
+ * a connected component with several non-planar blocks is planarized block
+ * by block. The blocks are processed concurrently, largest first, and their
+ * planarizations are merged at the cut vertices afterwards.
+ *
  * <H3>Optional parameters</H3>
  *
  * <table>
@@ -85,7 +90,8 @@ class PlanRepLight;
  *   </tr><tr>
  *     <td><i>maxThreads</i><td>int<td>System::numberOfProcessors()
  *     <td>This is the maximal number of threads that will be used for parallelizing the
- *     algorithm. At the moment, each permutation is parallelized, hence the there will
+ *     algorithm. If a connected component has several non-planar blocks, these are
+ *     planarized in parallel; otherwise, the permutations are parallelized, hence there will
  *     never be used more threads than permutations. To achieve sequential behaviour, set
  *     maxThreads to 1.
  *   </tr>
@@ -112,6 +118,7 @@ class PlanRepLight;
 class OGDF_EXPORT SubgraphPlanarizer : public CrossingMinimizationModule, public Logger {
 	class ThreadMaster;
 	class Worker;
+	struct Block;
 
 protected:
 	//! Implements the algorithm call.
@@ -164,6 +171,20 @@ private:
 	static void doWorkHelper(ThreadMaster& master, EdgeInsertionModule& inserter,
 			std::minstd_rand& rng);
 
+	//! Planarizes the non-planar blocks of \p pr separately if there are at least two of them.
+	/**
+	 * Returns false, leaving \p pr unchanged, if there is at most one non-planar block.
+	 * Otherwise, the merged planarization is stored in \p pr and \p result is set to
+	 * the return value.
+	 */
+	bool doCallBlocks(PlanRep& pr, int cc, const EdgeArray<int>* pCostOrig,
+			const EdgeArray<bool>* pForbiddenOrig, const EdgeArray<uint32_t>* pEdgeSubGraphs,
+			int64_t stopTime, ReturnType& result);
+
+	//! Embeds the planarized \p pr, removes pseudo crossings and returns the crossing number.
+	static int finishPlanarization(PlanRep& pr, const EdgeArray<int>* pCostOrig,
+			const EdgeArray<uint32_t>* pEdgeSubGraphs);
+
 	static bool doSinglePermutation(PlanRepLight& prl, int cc, const EdgeArray<int>* pCost,
 			const EdgeArray<bool>* pForbid, const EdgeArray<uint32_t>* pEdgeSubGraphs,
 			Array<edge>& deletedEdges, EdgeInsertionModule& inserter, std::minstd_rand& rng,
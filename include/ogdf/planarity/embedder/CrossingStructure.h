@@ -46,6 +46,18 @@ public:
 
 	void init(GraphCopy& PG, int weightedCrossingNumber);
 
+	//! Initializes the structure for the original graph \p G without any crossings.
+	void init(const Graph& G);
+
+	/**
+	 * Adds the crossings of \p PG, which planarizes a subgraph of the original graph.
+	 *
+	 * @param PG is a planarized copy of the subgraph.
+	 * @param original maps the edges of the subgraph to the original graph.
+	 * @param weightedCrossingNumber is the weighted crossing number of \p PG.
+	 */
+	void add(const GraphCopy& PG, const EdgeArray<edge>& original, int weightedCrossingNumber);
+
 	/**
 	 * @warning The order of adjEntries around each node will not be restored.
 	 * In particular, the order of edges around a dummy node may not reflect a
@@ -200,49 +200,6 @@ ArrayBuffer<int> LayoutStatistics::numberOfCrossings(const GraphAttributes& ga)
 	return values;
 }
 
-ArrayBuffer<int> LayoutStatistics::numberOfNodeCrossings(const GraphAttributes& ga) {
-	ArrayBuffer<int> values;
-	const Graph& G = ga.constGraph();
-	DPoint inter;
-
-	// Get bounding rectangle of every node.
-	NodeArray<DRect> nodeRects(G);
-	ga.nodeBoundingBoxes<DRect>(nodeRects);
-
-	// For all edges, get the target point of each of their edge segments.
-	for (edge e : G.edges) {
-		int nCrossingsE = 0;
-		node src = e->source();
-		node tgt = e->target();
-		DPoint vPoint = ga.point(src);
-
-		DPolyline edgeSegmentTargets = ga.bends(e);
-		edgeSegmentTargets.pushBack(ga.point(tgt));
-
-		int i = 0;
-		int last = edgeSegmentTargets.size() - 1;
-
-		// For all edge segments from vPoint to wPoint:
-		for (DPoint wPoint : edgeSegmentTargets) {
-			DSegment segment = DSegment(vPoint, wPoint);
-
-			// Count crossing of segment with nodes u, but do not count
-			// "crossing" of source/target node with first/last edge segment.
-			for (node u : G.nodes) {
-				if ((u != src || i != 0) && (u != tgt || i != last)
-						&& nodeRects[u].intersection(segment)) {
-					nCrossingsE++;
-				}
-			}
-			vPoint = wPoint;
-			i++;
-		}
-		values.push(nCrossingsE);
-	}
-
-	return values;
-}
-
 ArrayBuffer<int> LayoutStatistics::numberOfNodeOverlaps(const GraphAttributes& ga) {
 	ArrayBuffer<int> values;
 	const Graph& G = ga.constGraph();
@@ -0,0 +1,472 @@
+/** \file
+ * \brief Implements grid based crossing counting for LayoutStatistics.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/ArrayBuffer.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphAttributes.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/LayoutStatistics.h>
+#include <ogdf/basic/ThreadPool.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/geometry.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace ogdf {
+
+namespace {
+
+//! Axis-parallel bounding box of a line segment or a node.
+struct BoundingBox {
+	double minX, minY, maxX, maxY;
+
+	bool intersects(const BoundingBox& other) const {
+		return minX <= other.maxX && other.minX <= maxX && minY <= other.maxY
+				&& other.minY <= maxY;
+	}
+};
+
+//! A single segment of an edge's polyline.
+struct EdgeSegment {
+	DSegment segment;
+	edge e;
+	int edgeIndex; //!< Position of #e in the list of edges.
+	bool first; //!< Whether this segment starts at the source of #e.
+	bool last; //!< Whether this segment ends at the target of #e.
+};
+
+//! Splits all edges of \p ga into their segments, ordered by edge.
+void collectSegments(const GraphAttributes& ga, std::vector<EdgeSegment>& segments,
+		std::vector<BoundingBox>& boxes) {
+	const Graph& G = ga.constGraph();
+	segments.reserve(G.numberOfEdges());
+	boxes.reserve(G.numberOfEdges());
+
+	int edgeIndex = 0;
+	for (edge e : G.edges) {
+		const DPolyline& bends = ga.bends(e);
+		DPoint vPoint = ga.point(e->source());
+		const DPoint tgtPoint = ga.point(e->target());
+
+		int i = 0;
+		const int last = bends.size();
+		auto addSegment = [&](const DPoint& wPoint) {
+			segments.push_back({DSegment(vPoint, wPoint), e, edgeIndex, i == 0, i == last});
+			boxes.push_back({std::min(vPoint.m_x, wPoint.m_x), std::min(vPoint.m_y, wPoint.m_y),
+					std::max(vPoint.m_x, wPoint.m_x), std::max(vPoint.m_y, wPoint.m_y)});
+			vPoint = wPoint;
+			i++;
+		};
+
+		for (const DPoint& bend : bends) {
+			addSegment(bend);
+		}
+		addSegment(tgtPoint);
+		edgeIndex++;
+	}
+}
+
+//! Uniform grid over a set of bounding boxes.
+/**
+ * Each box is registered in every cell it overlaps. A pair of overlapping
+ * boxes therefore shows up in several cells; it is handled only in its
+ * reference cell, i.e., the cell containing the lower left corner of the
+ * intersection of both boxes. Hence every pair is handled exactly once
+ * without any bookkeeping.
+ *
+ * Boxes overlapping many cells (e.g., of long diagonal segments) would blow
+ * up the size of the grid. Such large boxes are not registered in any cell but
+ * kept in a separate list, whose items have to be tested against all others.
+ */
+class UniformGrid {
+	static constexpr int s_maxCellsPerSide = 1024;
+	static constexpr int s_maxCellsPerBox = 64;
+
+	double m_minX, m_minY;
+	double m_scaleX, m_scaleY; //!< Number of cells per unit.
+	int m_columns, m_rows;
+	std::vector<int> m_cellStart; //!< Offsets of the cells in #m_items.
+	std::vector<int> m_items;
+	std::vector<int> m_largeItems; //!< Boxes not registered in the cells.
+	std::vector<bool> m_isLarge;
+
+public:
+	explicit UniformGrid(const std::vector<BoundingBox>& boxes) {
+		OGDF_ASSERT(!boxes.empty());
+
+		BoundingBox all = boxes.front();
+		double extent = 0;
+		for (const BoundingBox& box : boxes) {
+			all.minX = std::min(all.minX, box.minX);
+			all.minY = std::min(all.minY, box.minY);
+			all.maxX = std::max(all.maxX, box.maxX);
+			all.maxY = std::max(all.maxY, box.maxY);
+			extent += std::max(box.maxX - box.minX, box.maxY - box.minY);
+		}
+		extent /= boxes.size();
+
+		// Cells should be about as large as an average box, so that a box only
+		// overlaps a few cells, but not much larger than required for having
+		// a constant number of boxes per cell on average.
+		const double width = all.maxX - all.minX;
+		const double height = all.maxY - all.minY;
+		double cellSize = std::max(extent, std::max(width, height) / std::sqrt(boxes.size()));
+		if (cellSize <= 0) {
+			cellSize = 1;
+		}
+
+		m_minX = all.minX;
+		m_minY = all.minY;
+		m_columns = std::min(s_maxCellsPerSide, static_cast<int>(width / cellSize) + 1);
+		m_rows = std::min(s_maxCellsPerSide, static_cast<int>(height / cellSize) + 1);
+		m_scaleX = width > 0 ? m_columns / width : 0;
+		m_scaleY = height > 0 ? m_rows / height : 0;
+
+		// Fill the cells in compressed form, i.e., count, prefix sums, distribute.
+		m_cellStart.assign(numberOfCells() + 1, 0);
+		m_isLarge.resize(boxes.size());
+		for (int i = 0; i < static_cast<int>(boxes.size()); i++) {
+			if (isLarge(boxes[i])) {
+				m_isLarge[i] = true;
+				m_largeItems.push_back(i);
+			} else {
+				forEachCell(boxes[i], [&](int c) { m_cellStart[c + 1]++; });
+			}
+		}
+		for (int c = 0; c < numberOfCells(); c++) {
+			m_cellStart[c + 1] += m_cellStart[c];
+		}
+		m_items.resize(m_cellStart.back());
+		std::vector<int> fill(m_cellStart.begin(), m_cellStart.end() - 1);
+		for (int i = 0; i < static_cast<int>(boxes.size()); i++) {
+			if (!m_isLarge[i]) {
+				forEachCell(boxes[i], [&](int c) { m_items[fill[c]++] = i; });
+			}
+		}
+	}
+
+	int numberOfCells() const { return m_columns * m_rows; }
+
+	//! Returns the cell containing (\p x, \p y), clamped to the grid.
+	int cell(double x, double y) const { return row(y) * m_columns + column(x); }
+
+	//! Returns the cell in which the pair of boxes \p a and \p b is handled.
+	int referenceCell(const BoundingBox& a, const BoundingBox& b) const {
+		return cell(std::max(a.minX, b.minX), std::max(a.minY, b.minY));
+	}
+
+	//! Calls \p func for every cell overlapped by \p box.
+	template<typename Func>
+	void forEachCell(const BoundingBox& box, Func func) const {
+		const int lastColumn = column(box.maxX);
+		const int lastRow = row(box.maxY);
+		for (int r = row(box.minY); r <= lastRow; r++) {
+			for (int c = column(box.minX); c <= lastColumn; c++) {
+				func(r * m_columns + c);
+			}
+		}
+	}
+
+	//! Returns whether \p box overlaps too many cells for being registered in them.
+	bool isLarge(const BoundingBox& box) const {
+		const int64_t columns = column(box.maxX) - column(box.minX) + 1;
+		return columns * (row(box.maxY) - row(box.minY) + 1) > s_maxCellsPerBox;
+	}
+
+	//! Returns whether the \p i-th box is not registered in the cells.
+	bool isLarge(int i) const { return m_isLarge[i]; }
+
+	//! Returns the indices of the boxes that are not registered in the cells.
+	const std::vector<int>& largeItems() const { return m_largeItems; }
+
+	const int* begin(int c) const { return m_items.data() + m_cellStart[c]; }
+
+	const int* end(int c) const { return m_items.data() + m_cellStart[c + 1]; }
+
+private:
+	int column(double x) const {
+		return std::min(m_columns - 1, std::max(0, static_cast<int>((x - m_minX) * m_scaleX)));
+	}
+
+	int row(double y) const {
+		return std::min(m_rows - 1, std::max(0, static_cast<int>((y - m_minY) * m_scaleY)));
+	}
+};
+
+//! Whether the segments \p s and \p t of two distinct edges cross.
+/**
+ * Adjacent edges touching in their common node do not cross. A crossing
+ * that coincides with a bend point is only reported for the segment that
+ * starts at the bend point, such that it is counted once.
+ */
+bool crosses(const GraphAttributes& ga, const EdgeSegment& s, const EdgeSegment& t) {
+	OGDF_ASSERT(s.e != t.e);
+	if (s.segment.start() == s.segment.end() || t.segment.start() == t.segment.end()) {
+		return false;
+	}
+
+	DPoint inter;
+	if (s.segment.intersection(t.segment, inter) != IntersectionType::SinglePoint) {
+		return false;
+	}
+
+	if ((!s.last && inter == s.segment.end()) || (!t.last && inter == t.segment.end())) {
+		return false;
+	}
+
+	for (node v : {s.e->source(), s.e->target()}) {
+		if (t.e->isIncident(v) && inter == ga.point(v)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//! Calls \p worker with the indices 0, ..., \p numWorkers - 1 on the global ThreadPool.
+/**
+ * The workers fetch their work dynamically, so the result does not depend on
+ * how many of them actually run concurrently within the pool's thread budget.
+ */
+template<typename Worker>
+void runInParallel(unsigned int numWorkers, Worker& worker) {
+	ThreadPool::global().parallelFor(0, static_cast<int>(numWorkers), numWorkers,
+			[&](int i) { worker(static_cast<unsigned int>(i)); });
+}
+
+//! Clamps the number of workers to something sensible for \p work items.
+unsigned int numberOfWorkers(unsigned int numThreads, size_t work) {
+	// do not bother splitting tiny instances
+	const size_t minWorkPerThread = 1024;
+	return static_cast<unsigned int>(std::min<size_t>(std::max(numThreads, 1u),
+			std::max<size_t>(work / minWorkPerThread, 1)));
+}
+
+//! Node rectangles and the grid built on top of them.
+struct NodeGrid {
+	std::vector<node> nodes;
+	std::vector<DRect> rects;
+	std::vector<BoundingBox> boxes;
+
+	explicit NodeGrid(const GraphAttributes& ga) {
+		const Graph& G = ga.constGraph();
+		NodeArray<DRect> nodeRects(G);
+		ga.nodeBoundingBoxes<DRect>(nodeRects);
+
+		nodes.reserve(G.numberOfNodes());
+		rects.reserve(G.numberOfNodes());
+		boxes.reserve(G.numberOfNodes());
+		for (node v : G.nodes) {
+			const DRect& rect = nodeRects[v];
+			nodes.push_back(v);
+			rects.push_back(rect);
+			boxes.push_back({rect.p1().m_x, rect.p1().m_y, rect.p2().m_x, rect.p2().m_y});
+		}
+	}
+};
+
+//! Returns the number of nodes crossed by segment \p s.
+int nodeCrossings(const UniformGrid& grid, const NodeGrid& nodeGrid, const EdgeSegment& s,
+		const BoundingBox& box) {
+	const node src = s.e->source();
+	const node tgt = s.e->target();
+	int crossings = 0;
+
+	auto countCrossing = [&](int i) {
+		// Do not count "crossing" of source/target node with first/last edge segment.
+		node u = nodeGrid.nodes[i];
+		if ((u != src || !s.first) && (u != tgt || !s.last)
+				&& nodeGrid.rects[i].intersection(s.segment)) {
+			crossings++;
+		}
+	};
+
+	if (grid.isLarge(box)) {
+		// walking all overlapped cells would be slower than testing every node
+		for (int i = 0; i < static_cast<int>(nodeGrid.nodes.size()); ++i) {
+			if (box.intersects(nodeGrid.boxes[i])) {
+				countCrossing(i);
+			}
+		}
+		return crossings;
+	}
+
+	grid.forEachCell(box, [&](int c) {
+		for (const int* it = grid.begin(c); it != grid.end(c); ++it) {
+			const BoundingBox& other = nodeGrid.boxes[*it];
+			if (box.intersects(other) && grid.referenceCell(box, other) == c) {
+				countCrossing(*it);
+			}
+		}
+	});
+	for (int i : grid.largeItems()) {
+		if (box.intersects(nodeGrid.boxes[i])) {
+			countCrossing(i);
+		}
+	}
+
+	return crossings;
+}
+
+}
+
+ArrayBuffer<int> LayoutStatistics::numberOfNodeCrossings(const GraphAttributes& ga) {
+	const Graph& G = ga.constGraph();
+	ArrayBuffer<int> values(G.numberOfEdges());
+	if (G.numberOfEdges() == 0) {
+		return values;
+	}
+
+	std::vector<EdgeSegment> segments;
+	std::vector<BoundingBox> boxes;
+	collectSegments(ga, segments, boxes);
+
+	NodeGrid nodeGrid(ga);
+	UniformGrid grid(nodeGrid.boxes);
+
+	std::vector<int> crossings(G.numberOfEdges(), 0);
+	for (size_t i = 0; i < segments.size(); ++i) {
+		crossings[segments[i].edgeIndex] += nodeCrossings(grid, nodeGrid, segments[i], boxes[i]);
+	}
+
+	for (int nCrossingsE : crossings) {
+		values.push(nCrossingsE);
+	}
+
+	return values;
+}
+
+int64_t LayoutStatistics::totalNumberOfNodeCrossings(const GraphAttributes& ga,
+		unsigned int numThreads) {
+	const Graph& G = ga.constGraph();
+	if (G.numberOfEdges() == 0) {
+		return 0;
+	}
+
+	std::vector<EdgeSegment> segments;
+	std::vector<BoundingBox> boxes;
+	collectSegments(ga, segments, boxes);
+
+	NodeGrid nodeGrid(ga);
+	UniformGrid grid(nodeGrid.boxes);
+
+	numThreads = numberOfWorkers(numThreads, segments.size());
+	std::vector<int64_t> counts(numThreads, 0);
+	const int numSegments = static_cast<int>(segments.size());
+	const int chunkSize = 256;
+	std::atomic<int> nextSegment(0);
+
+	auto countCrossings = [&](unsigned int threadNr) {
+		int64_t count = 0;
+		for (int first = nextSegment.fetch_add(chunkSize); first < numSegments;
+				first = nextSegment.fetch_add(chunkSize)) {
+			const int last = std::min(numSegments, first + chunkSize);
+			for (int i = first; i < last; ++i) {
+				count += nodeCrossings(grid, nodeGrid, segments[i], boxes[i]);
+			}
+		}
+		counts[threadNr] = count;
+	};
+	runInParallel(numThreads, countCrossings);
+
+	int64_t total = 0;
+	for (int64_t count : counts) {
+		total += count;
+	}
+	return total;
+}
+
+int64_t LayoutStatistics::totalNumberOfCrossings(const GraphAttributes& ga,
+		unsigned int numThreads) {
+	if (ga.constGraph().numberOfEdges() < 2) {
+		return 0;
+	}
+
+	std::vector<EdgeSegment> segments;
+	std::vector<BoundingBox> boxes;
+	collectSegments(ga, segments, boxes);
+	UniformGrid grid(boxes);
+
+	numThreads = numberOfWorkers(numThreads, segments.size());
+	std::vector<int64_t> counts(numThreads, 0);
+	const int numCells = grid.numberOfCells();
+	const int chunkSize = 16;
+	std::atomic<int> nextCell(0);
+	const std::vector<int>& large = grid.largeItems();
+	const int numLarge = static_cast<int>(large.size());
+	const int numSegments = static_cast<int>(segments.size());
+	std::atomic<int> nextLarge(0);
+
+	auto countCrossings = [&](unsigned int threadNr) {
+		int64_t count = 0;
+		for (int first = nextCell.fetch_add(chunkSize); first < numCells;
+				first = nextCell.fetch_add(chunkSize)) {
+			const int last = std::min(numCells, first + chunkSize);
+			for (int c = first; c < last; ++c) {
+				for (const int* i = grid.begin(c); i != grid.end(c); ++i) {
+					for (const int* j = i + 1; j != grid.end(c); ++j) {
+						const EdgeSegment& s = segments[*i];
+						const EdgeSegment& t = segments[*j];
+						if (s.e != t.e && boxes[*i].intersects(boxes[*j])
+								&& grid.referenceCell(boxes[*i], boxes[*j]) == c
+								&& crosses(ga, s, t)) {
+							count++;
+						}
+					}
+				}
+			}
+		}
+
+		// Segments with large boxes are tested against all others. A pair of
+		// such segments is handled by the one with the lower index.
+		for (int k = nextLarge++; k < numLarge; k = nextLarge++) {
+			const int i = large[k];
+			for (int j = 0; j < numSegments; ++j) {
+				if (j != i && (!grid.isLarge(j) || i < j) && segments[i].e != segments[j].e
+						&& boxes[i].intersects(boxes[j]) && crosses(ga, segments[i], segments[j])) {
+					count++;
+				}
+			}
+		}
+		counts[threadNr] = count;
+	};
+	runInParallel(numThreads, countCrossings);
+
+	int64_t total = 0;
+	for (int64_t count : counts) {
+		total += count;
+	}
+	return total;
+}
+
+}
@@ -0,0 +1,89 @@
+/** \file
+ * \brief Implementation of ogdf::StaticGraphView
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/StaticGraphView.h>
+
+#include <vector>
+
+namespace ogdf {
+
+void StaticGraphView::init(const Graph& G) {
+	m_graph = &G;
+	const int n = G.numberOfNodes();
+	const int m = G.numberOfEdges();
+
+	m_node.clear();
+	m_node.reserve(n);
+	m_nodeIndex.assign(G.maxNodeIndex() + 1, -1);
+	for (node v : G.nodes) {
+		m_nodeIndex[v->index()] = static_cast<int>(m_node.size());
+		m_node.push_back(v);
+	}
+
+	m_edge.clear();
+	m_edge.reserve(m);
+	m_edgeIndex.assign(G.maxEdgeIndex() + 1, -1);
+	m_source.resize(m);
+	m_target.resize(m);
+	for (edge e : G.edges) {
+		const int i = static_cast<int>(m_edge.size());
+		m_edgeIndex[e->index()] = i;
+		m_edge.push_back(e);
+		m_source[i] = m_nodeIndex[e->source()->index()];
+		m_target[i] = m_nodeIndex[e->target()->index()];
+	}
+
+	m_offset.resize(n + 1);
+	m_outEnd.resize(n);
+	m_adjNode.resize(2 * m);
+	m_adjEdge.resize(2 * m);
+
+	int slot = 0;
+	for (int v = 0; v < n; ++v) {
+		m_offset[v] = slot;
+		for (bool outgoing : {true, false}) {
+			for (adjEntry adj : m_node[v]->adjEntries) {
+				if (adj->isSource() == outgoing) {
+					m_adjNode[slot] = m_nodeIndex[adj->twinNode()->index()];
+					m_adjEdge[slot] = m_edgeIndex[adj->theEdge()->index()];
+					++slot;
+				}
+			}
+			if (outgoing) {
+				m_outEnd[v] = slot;
+			}
+		}
+	}
+	m_offset[n] = slot;
+	OGDF_ASSERT(slot == 2 * m);
+}
+
+}
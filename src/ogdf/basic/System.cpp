@@ -80,9 +80,9 @@
 #endif
 // clang-format on
 
-static inline void cpuid(int CPUInfo[4], int infoType) {
+static inline void cpuid(int CPUInfo[4], int infoType, int subLeaf = 0) {
 #if defined(OGDF_SYSTEM_WINDOWS) && !defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
-	__cpuid(CPUInfo, infoType);
+	__cpuidex(CPUInfo, infoType, subLeaf);
 #else
 	uint32_t a = 0;
 	uint32_t b = 0;
@@ -90,7 +90,7 @@ static inline void cpuid(int CPUInfo[4], int infoType) {
 	uint32_t d = 0;
 
 #	if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
-	__get_cpuid(infoType, &a, &b, &c, &d);
+	__get_cpuid_count(infoType, subLeaf, &a, &b, &c, &d);
 #	endif
 
 	CPUInfo[0] = a;
@@ -100,6 +100,19 @@ static inline void cpuid(int CPUInfo[4], int infoType) {
 #endif
 }
 
+//! Returns the register XCR0 telling which register states are saved by the OS.
+static inline uint64_t xgetbv0() {
+#if defined(OGDF_SYSTEM_WINDOWS) && !defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	return _xgetbv(0);
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	uint32_t a, d;
+	__asm__ volatile("xgetbv" : "=a"(a), "=d"(d) : "c"(0));
+	return (uint64_t(d) << 32) | a;
+#else
+	return 0;
+#endif
+}
+
 namespace ogdf {
 
 unsigned int System::s_cpuFeatures = 0;
@@ -161,6 +174,30 @@ void System::init() {
 		if (featureInfoECX & (1 << 3)) {
 			s_cpuFeatures |= CPUFeatureMask::MONITOR;
 		}
+
+		// AVX instructions may only be used if the OS saves the extended registers
+		bool osxsave = featureInfoECX & (1 << 27);
+		uint64_t xcr0 = osxsave ? xgetbv0() : 0;
+		bool ymmSaved = (xcr0 & 0x06) == 0x06;
+		bool zmmSaved = (xcr0 & 0xe6) == 0xe6;
+
+		if (ymmSaved && (featureInfoECX & (1 << 28))) {
+			s_cpuFeatures |= CPUFeatureMask::AVX;
+		}
+		if (ymmSaved && (featureInfoECX & (1 << 12))) {
+			s_cpuFeatures |= CPUFeatureMask::FMA;
+		}
+		if (nIds >= 7) {
+			cpuid(CPUInfo, 7, 0);
+			int extendedFeatureInfoEBX = CPUInfo[1];
+
+			if (ymmSaved && (extendedFeatureInfoEBX & (1 << 5))) {
+				s_cpuFeatures |= CPUFeatureMask::AVX2;
+			}
+			if (zmmSaved && (extendedFeatureInfoEBX & (1 << 16))) {
+				s_cpuFeatures |= CPUFeatureMask::AVX512F;
+			}
+		}
 	}
 
 	cpuid(CPUInfo, 0x80000000);
@@ -0,0 +1,270 @@
+/** \file
+ * \brief Implementation of the process-wide work-stealing executor.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/System.h>
+#include <ogdf/basic/ThreadPool.h>
+#include <ogdf/basic/memory.h>
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+namespace ogdf {
+
+namespace {
+
+//! The pool the current thread is a worker of (if any).
+thread_local const ThreadPool* s_currentPool = nullptr;
+//! The index of the current thread within #s_currentPool.
+thread_local unsigned int s_currentIndex = 0;
+
+}
+
+ThreadPool::ThreadPool(unsigned int numWorkers) : m_numWorkers(numWorkers) {
+#ifdef OGDF_MEMORY_POOL_NTS
+	m_numWorkers = 0;
+#endif
+}
+
+ThreadPool::~ThreadPool() { stop(); }
+
+ThreadPool& ThreadPool::global() {
+	static ThreadPool pool(std::max(System::numberOfProcessors(), 1) - 1);
+	return pool;
+}
+
+void ThreadPool::setNumberOfWorkers(unsigned int numWorkers) {
+	stop();
+#ifndef OGDF_MEMORY_POOL_NTS
+	m_numWorkers = numWorkers;
+#endif
+}
+
+unsigned int ThreadPool::threadBudget(unsigned int numThreads) const {
+	return std::min(std::max(numThreads, 1u), maxThreads());
+}
+
+void ThreadPool::start() {
+	std::lock_guard<std::mutex> guard(m_startMutex);
+	if (m_running) {
+		return;
+	}
+
+	m_queues.clear();
+	for (unsigned int i = 0; i < m_numWorkers; ++i) {
+		m_queues.emplace_back(new WorkerQueue);
+	}
+	m_workers.reserve(m_numWorkers);
+	for (unsigned int i = 0; i < m_numWorkers; ++i) {
+		m_workers.emplace_back(&ThreadPool::workerLoop, this, i);
+	}
+	m_running = true;
+}
+
+void ThreadPool::stop() {
+	std::lock_guard<std::mutex> guard(m_startMutex);
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_wakeUp.notify_all();
+
+	for (std::thread& worker : m_workers) {
+		worker.join();
+	}
+	m_workers.clear();
+	m_stop = false;
+	m_running = false;
+}
+
+void ThreadPool::submit(Job job) {
+	if (m_numWorkers == 0) {
+		job();
+		return;
+	}
+
+	if (!m_running) {
+		start();
+	}
+
+	unsigned int index = s_currentPool == this ? s_currentIndex : m_nextQueue++ % m_numWorkers;
+	{
+		std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+		m_queues[index]->jobs.push_back(std::move(job));
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_queued++;
+	}
+	m_wakeUp.notify_one();
+}
+
+bool ThreadPool::tryPop(unsigned int index, Job& job) {
+	// Take the most recent job of our own queue, it is most likely to be cache-hot...
+	{
+		WorkerQueue& own = *m_queues[index];
+		std::lock_guard<std::mutex> lock(own.mutex);
+		if (!own.jobs.empty()) {
+			job = std::move(own.jobs.back());
+			own.jobs.pop_back();
+			return true;
+		}
+	}
+
+	// ...otherwise steal the oldest job of somebody else.
+	for (unsigned int k = 1; k < m_numWorkers; ++k) {
+		WorkerQueue& other = *m_queues[(index + k) % m_numWorkers];
+		std::lock_guard<std::mutex> lock(other.mutex);
+		if (!other.jobs.empty()) {
+			job = std::move(other.jobs.front());
+			other.jobs.pop_front();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ThreadPool::workerLoop(unsigned int index) {
+	s_currentPool = this;
+	s_currentIndex = index;
+
+	for (;;) {
+		Job job;
+		if (tryPop(index, job)) {
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_queued--;
+			}
+			job();
+			OGDF_ALLOCATOR::flushPool();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_wakeUp.wait(lock, [this] { return m_stop || m_queued > 0; });
+		if (m_stop && m_queued <= 0) {
+			break;
+		}
+	}
+
+	s_currentPool = nullptr;
+}
+
+struct ThreadPool::TaskGroup::State {
+	std::mutex mutex;
+	std::condition_variable finished;
+	std::deque<Job> tasks; //!< Tasks not yet started.
+	int unfinished = 0; //!< Tasks not yet finished.
+	unsigned int helpers = 0; //!< Pool jobs currently working on #tasks.
+	unsigned int maxHelpers = 0;
+	std::exception_ptr error;
+};
+
+ThreadPool::TaskGroup::TaskGroup(unsigned int numThreads, ThreadPool& pool)
+	: m_pool(pool)
+	, m_budget(numThreads == 0 ? pool.maxThreads() : pool.threadBudget(numThreads))
+	, m_state(std::make_shared<State>()) {
+	// The thread calling wait() counts towards the budget.
+	m_state->maxHelpers = m_budget - 1;
+}
+
+ThreadPool::TaskGroup::~TaskGroup() {
+	try {
+		wait();
+	} catch (...) {
+		// destructors must not throw
+	}
+}
+
+void ThreadPool::TaskGroup::run(Job task) {
+	bool addHelper = false;
+	{
+		std::lock_guard<std::mutex> lock(m_state->mutex);
+		m_state->tasks.push_back(std::move(task));
+		m_state->unfinished++;
+		if (m_state->helpers < m_state->maxHelpers) {
+			m_state->helpers++;
+			addHelper = true;
+		}
+	}
+
+	if (addHelper) {
+		// The helper keeps the state alive in case it starts after wait() returned.
+		std::shared_ptr<State> state = m_state;
+		m_pool.submit([state] { drain(*state, true); });
+	}
+}
+
+void ThreadPool::TaskGroup::wait() {
+	drain(*m_state, false);
+
+	std::unique_lock<std::mutex> lock(m_state->mutex);
+	m_state->finished.wait(lock, [this] { return m_state->unfinished == 0; });
+	if (m_state->error) {
+		std::exception_ptr error = m_state->error;
+		m_state->error = nullptr;
+		std::rethrow_exception(error);
+	}
+}
+
+void ThreadPool::TaskGroup::drain(State& state, bool isHelper) {
+	for (;;) {
+		Job task;
+		{
+			std::lock_guard<std::mutex> lock(state.mutex);
+			if (state.tasks.empty()) {
+				if (isHelper) {
+					state.helpers--;
+				}
+				return;
+			}
+			task = std::move(state.tasks.front());
+			state.tasks.pop_front();
+		}
+
+		std::exception_ptr error;
+		try {
+			task();
+		} catch (...) {
+			error = std::current_exception();
+		}
+		task = nullptr;
+
+		std::lock_guard<std::mutex> lock(state.mutex);
+		if (error && !state.error) {
+			state.error = error;
+		}
+		if (--state.unfinished == 0) {
+			state.finished.notify_all();
+		}
+	}
+}
+
+}
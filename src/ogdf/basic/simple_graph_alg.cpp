@@ -40,6 +40,7 @@
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/Math.h>
 #include <ogdf/basic/SList.h>
+#include <ogdf/basic/StaticGraphView.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/extended_graph_alg.h>
 #include <ogdf/basic/simple_graph_alg.h>
@@ -47,6 +48,7 @@
 
 #include <functional>
 #include <limits>
+#include <vector>
 
 namespace ogdf {
 
@@ -1329,6 +1331,127 @@ bool isBipartite(const Graph& G, NodeArray<bool>& color) {
 	return true;
 }
 
+bool isLoopFree(const StaticGraphView& G) {
+	for (int e = 0; e < G.numberOfEdges(); ++e) {
+		if (G.source(e) == G.target(e)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool isParallelFree(const StaticGraphView& G) {
+	// lastSeen[w] == v iff an edge (v,w) has already been seen
+	std::vector<int> lastSeen(G.numberOfNodes(), -1);
+	for (int v = 0; v < G.numberOfNodes(); ++v) {
+		for (int i = G.adjBegin(v); i < G.outEnd(v); ++i) {
+			int w = G.twinNode(i);
+			if (lastSeen[w] == v) {
+				return false;
+			}
+			lastSeen[w] = v;
+		}
+	}
+	return true;
+}
+
+bool isConnected(const StaticGraphView& G) {
+	return G.numberOfNodes() == 0 || connectedComponents(G) == 1;
+}
+
+int connectedComponents(const StaticGraphView& G, std::vector<int>& component) {
+	const int n = G.numberOfNodes();
+	component.assign(n, -1);
+
+	std::vector<int> stack;
+	int nComponent = 0;
+	for (int v = 0; v < n; ++v) {
+		if (component[v] != -1) {
+			continue;
+		}
+
+		stack.push_back(v);
+		component[v] = nComponent;
+		while (!stack.empty()) {
+			int w = stack.back();
+			stack.pop_back();
+			for (int i = G.adjBegin(w); i < G.adjEnd(w); ++i) {
+				int u = G.twinNode(i);
+				if (component[u] == -1) {
+					component[u] = nComponent;
+					stack.push_back(u);
+				}
+			}
+		}
+		++nComponent;
+	}
+
+	return nComponent;
+}
+
+bool isAcyclic(const StaticGraphView& G) {
+	// Repeatedly remove sources (Kahn's algorithm); a cycle prevents removing all nodes.
+	const int n = G.numberOfNodes();
+	std::vector<int> indeg(n);
+	std::vector<int> sources;
+	for (int v = 0; v < n; ++v) {
+		indeg[v] = G.indeg(v);
+		if (indeg[v] == 0) {
+			sources.push_back(v);
+		}
+	}
+
+	int nRemoved = 0;
+	while (!sources.empty()) {
+		int v = sources.back();
+		sources.pop_back();
+		++nRemoved;
+		for (int i = G.adjBegin(v); i < G.outEnd(v); ++i) {
+			int w = G.twinNode(i);
+			if (--indeg[w] == 0) {
+				sources.push_back(w);
+			}
+		}
+	}
+
+	return nRemoved == n;
+}
+
+bool isAcyclicUndirected(const StaticGraphView& G) {
+	// A graph is a forest iff each of its components is a tree.
+	return G.numberOfEdges() == G.numberOfNodes() - connectedComponents(G);
+}
+
+bool isBipartite(const StaticGraphView& G) {
+	const int n = G.numberOfNodes();
+	std::vector<signed char> color(n, -1);
+	std::vector<int> stack;
+
+	for (int v = 0; v < n; ++v) {
+		if (color[v] != -1) {
+			continue;
+		}
+
+		color[v] = 0;
+		stack.push_back(v);
+		while (!stack.empty()) {
+			int w = stack.back();
+			stack.pop_back();
+			for (int i = G.adjBegin(w); i < G.adjEnd(w); ++i) {
+				int u = G.twinNode(i);
+				if (color[u] == -1) {
+					color[u] = 1 - color[w];
+					stack.push_back(u);
+				} else if (color[u] == color[w]) {
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
 void nodeDistribution(const Graph& G, Array<int>& dist, std::function<int(node)> func) {
 	int maxval = 0;
 	int minval = std::numeric_limits<int>::max();
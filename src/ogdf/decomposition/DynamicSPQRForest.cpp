@@ -320,7 +320,7 @@ edge DynamicSPQRForest::updateInsertedEdgeSPQR(node vB, edge eG) {
 		}
 		node wT = spqrproper(gH);
 		if (m_tNode_type[wT] == TNodeType::PComp) {
-			addHEdge(eH, vT);
+			addHEdge(eH, wT);
 		} else {
 			node nT = newSPQRNode(vB, TNodeType::PComp);
 			edge v1 = m_tNode_hRefEdge[vT];
@@ -31,6 +31,7 @@
 
 
 #include <ogdf/basic/Array.h>
+#include <ogdf/basic/ArrayBuffer.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/List.h>
@@ -95,47 +96,68 @@ void PlanarSPQRTree::adoptEmbedding() {
 void PlanarSPQRTree::setPosInEmbedding(NodeArray<SListPure<adjEntry>>& adjEdges,
 		NodeArray<node>& currentCopy, NodeArray<adjEntry>& lastAdj, SListPure<node>& current,
 		const Skeleton& S, adjEntry adj) {
-	node vT = S.treeNode();
-
-	adjEdges[vT].pushBack(adj);
-
-	node vCopy = adj->theNode();
-	node vOrig = S.original(vCopy);
+	// The skeletons containing an original node may form a long path in the tree, so
+	// the skeletons still to be scanned are kept on an explicit stack. A frame consists
+	// of a skeleton, the adjacency entry it was entered with, and the next entry to scan.
+	struct Frame {
+		const Skeleton* S;
+		adjEntry adj;
+		adjEntry next;
+	};
+	ArrayBuffer<Frame> stack;
+
+	const Skeleton* pS = &S;
+	while (adj != nullptr) {
+		node vT = pS->treeNode();
+
+		adjEdges[vT].pushBack(adj);
+
+		node vCopy = adj->theNode();
+		adjEntry adjVirt = nullptr;
+
+		if (currentCopy[vT] == nullptr) {
+			currentCopy[vT] = vCopy;
+			current.pushBack(vT);
+			stack.push({pS, adj, vCopy->firstAdj()});
+
+		} else if (lastAdj[vT] != nullptr && lastAdj[vT] != adj) {
+			adjVirt = lastAdj[vT];
+			lastAdj[vT] = nullptr;
+		}
 
-	if (currentCopy[vT] == nullptr) {
-		currentCopy[vT] = vCopy;
-		current.pushBack(vT);
+		// find the next virtual edge to follow
+		while (adjVirt == nullptr && !stack.empty()) {
+			Frame& f = stack.top();
+			if (f.next == nullptr) {
+				stack.pop();
+				continue;
+			}
 
-		for (adjEntry adjVirt : vCopy->adjEntries) {
-			edge eCopy = S.twinEdge(adjVirt->theEdge());
-			if (eCopy == nullptr) {
+			adjEntry adjNext = f.next;
+			f.next = adjNext->succ();
+			if (f.S->twinEdge(adjNext->theEdge()) == nullptr) {
 				continue;
 			}
-			if (adjVirt == adj) {
-				lastAdj[vT] = adj;
+			if (adjNext == f.adj) {
+				lastAdj[f.S->treeNode()] = adjNext;
 				continue;
 			}
 
-			const Skeleton& STwin = skeleton(S.twinTreeNode(adjVirt->theEdge()));
-
-			adjEntry adjCopy = (STwin.original(eCopy->source()) == vOrig) ? eCopy->adjSource()
-																		  : eCopy->adjTarget();
-
-			setPosInEmbedding(adjEdges, currentCopy, lastAdj, current, STwin, adjCopy);
+			adjVirt = adjNext;
+			pS = f.S;
 		}
 
-	} else if (lastAdj[vT] != nullptr && lastAdj[vT] != adj) {
-		adjEntry adjVirt = lastAdj[vT];
-		edge eCopy = S.twinEdge(adjVirt->theEdge());
-
-		const Skeleton& STwin = skeleton(S.twinTreeNode(adjVirt->theEdge()));
+		adj = nullptr;
+		if (adjVirt != nullptr) {
+			node vOrig = pS->original(adjVirt->theNode());
+			edge eCopy = pS->twinEdge(adjVirt->theEdge());
 
-		adjEntry adjCopy = (STwin.original(eCopy->source()) == vOrig) ? eCopy->adjSource()
-																	  : eCopy->adjTarget();
-
-		setPosInEmbedding(adjEdges, currentCopy, lastAdj, current, STwin, adjCopy);
+			const Skeleton& STwin = skeleton(pS->twinTreeNode(adjVirt->theEdge()));
 
-		lastAdj[vT] = nullptr;
+			adj = (STwin.original(eCopy->source()) == vOrig) ? eCopy->adjSource()
+															 : eCopy->adjTarget();
+			pS = &STwin;
+		}
 	}
 }
 
@@ -187,73 +209,95 @@ void PlanarSPQRTree::embed(Graph& G) {
 }
 
 void PlanarSPQRTree::expandVirtualEmbed(node vT, adjEntry adjVirt, SListPure<adjEntry>& adjEdges) {
-	const Skeleton& S = skeleton(vT);
-
-	node v = adjVirt->theNode();
-	node vOrig = S.original(v);
+	// The skeletons containing an original node may form a long path in the tree,
+	// so they are expanded using an explicit stack. A frame consists of a skeleton
+	// node, its virtual adjacency entry, and the next adjacency entry to process.
+	struct Frame {
+		node vT;
+		adjEntry adjVirt;
+		adjEntry adj;
+	};
+	ArrayBuffer<Frame> stack;
+	stack.push({vT, adjVirt, adjVirt->cyclicSucc()});
+
+	while (!stack.empty()) {
+		Frame& f = stack.top();
+		adjEntry adj = f.adj;
+		if (adj == f.adjVirt) {
+			stack.pop();
+			continue;
+		}
+		f.adj = adj->cyclicSucc();
 
-	adjEntry adj;
-	for (adj = adjVirt->cyclicSucc(); adj != adjVirt; adj = adj->cyclicSucc()) {
+		const Skeleton& S = skeleton(f.vT);
+		node vOrig = S.original(adj->theNode());
 		edge e = adj->theEdge();
 		edge eOrig = S.realEdge(e);
 
 		if (eOrig != nullptr) {
 			adjEntry adjOrig = (vOrig == eOrig->source()) ? eOrig->adjSource() : eOrig->adjTarget();
-			OGDF_ASSERT(adjOrig->theNode() == S.original(v));
+			OGDF_ASSERT(adjOrig->theNode() == vOrig);
 			adjEdges.pushBack(adjOrig);
 
 		} else {
 			node wT = S.twinTreeNode(e);
 			edge eTwin = S.twinEdge(e);
-			expandVirtualEmbed(wT,
-					(vOrig == skeleton(wT).original(eTwin->source())) ? eTwin->adjSource()
-																	  : eTwin->adjTarget(),
-					adjEdges);
+			adjEntry adjTwin = (vOrig == skeleton(wT).original(eTwin->source()))
+					? eTwin->adjSource()
+					: eTwin->adjTarget();
+			stack.push({wT, adjTwin, adjTwin->cyclicSucc()});
 		}
 	}
 }
 
 void PlanarSPQRTree::createInnerVerticesEmbed(Graph& G, node vT) {
-	const Skeleton& S = skeleton(vT);
-	const Graph& M = S.getGraph();
-
-	node src = S.referenceEdge()->source();
-	node tgt = S.referenceEdge()->target();
-
-	for (node v : M.nodes) {
-		if (v == src || v == tgt) {
-			continue;
+	// traverse the subtree rooted at vT with an explicit stack
+	ArrayBuffer<node> stack;
+	stack.push(vT);
+
+	while (!stack.empty()) {
+		vT = stack.popRet();
+		for (adjEntry adj : vT->adjEntries) {
+			node wT = adj->theEdge()->target();
+			if (wT != vT) {
+				stack.push(wT);
+			}
 		}
 
-		node vOrig = S.original(v);
-		SListPure<adjEntry> adjEdges;
+		const Skeleton& S = skeleton(vT);
+		const Graph& M = S.getGraph();
 
-		for (adjEntry adj : v->adjEntries) {
-			edge e = adj->theEdge();
-			edge eOrig = S.realEdge(e);
+		node src = S.referenceEdge()->source();
+		node tgt = S.referenceEdge()->target();
 
-			if (eOrig != nullptr) {
-				adjEntry adjOrig =
-						(vOrig == eOrig->source()) ? eOrig->adjSource() : eOrig->adjTarget();
-				OGDF_ASSERT(adjOrig->theNode() == S.original(v));
-				adjEdges.pushBack(adjOrig);
-			} else {
-				node wT = S.twinTreeNode(e);
-				edge eTwin = S.twinEdge(e);
-				expandVirtualEmbed(wT,
-						(vOrig == skeleton(wT).original(eTwin->source())) ? eTwin->adjSource()
-																		  : eTwin->adjTarget(),
-						adjEdges);
+		for (node v : M.nodes) {
+			if (v == src || v == tgt) {
+				continue;
 			}
-		}
 
-		G.sort(vOrig, adjEdges);
-	}
+			node vOrig = S.original(v);
+			SListPure<adjEntry> adjEdges;
+
+			for (adjEntry adj : v->adjEntries) {
+				edge e = adj->theEdge();
+				edge eOrig = S.realEdge(e);
+
+				if (eOrig != nullptr) {
+					adjEntry adjOrig =
+							(vOrig == eOrig->source()) ? eOrig->adjSource() : eOrig->adjTarget();
+					OGDF_ASSERT(adjOrig->theNode() == S.original(v));
+					adjEdges.pushBack(adjOrig);
+				} else {
+					node wT = S.twinTreeNode(e);
+					edge eTwin = S.twinEdge(e);
+					expandVirtualEmbed(wT,
+							(vOrig == skeleton(wT).original(eTwin->source())) ? eTwin->adjSource()
+																			  : eTwin->adjTarget(),
+							adjEdges);
+				}
+			}
 
-	for (adjEntry adj : vT->adjEntries) {
-		node wT = adj->theEdge()->target();
-		if (wT != vT) {
-			createInnerVerticesEmbed(G, wT);
+			G.sort(vOrig, adjEdges);
 		}
 	}
 }
@@ -291,26 +335,31 @@ void PlanarSPQRTree::swap(node vT, edge e1, edge e2) {
 double PlanarSPQRTree::numberOfEmbeddings(node vT) const {
 	double num = 1.0;
 
-	switch (typeOf(vT)) {
-	case NodeType::RNode:
-		num = 2;
-		break;
-	case NodeType::PNode:
-#if 0
-		node vFirst = skeleton(vT).getGraph().firstNode();
-#endif
-		for (int i = skeleton(vT).getGraph().firstNode()->degree() - 1; i >= 2; --i) {
-			num *= i;
+	// traverse the subtree rooted at vT with an explicit stack
+	ArrayBuffer<node> stack;
+	stack.push(vT);
+
+	while (!stack.empty()) {
+		vT = stack.popRet();
+
+		switch (typeOf(vT)) {
+		case NodeType::RNode:
+			num *= 2;
+			break;
+		case NodeType::PNode:
+			for (int i = skeleton(vT).getGraph().firstNode()->degree() - 1; i >= 2; --i) {
+				num *= i;
+			}
+			break;
+		case NodeType::SNode:
+			break;
 		}
-		break;
-	case NodeType::SNode:
-		break;
-	}
 
-	for (adjEntry adj : vT->adjEntries) {
-		node wT = adj->theEdge()->target();
-		if (wT != vT) {
-			num *= numberOfEmbeddings(wT);
+		for (adjEntry adj : vT->adjEntries) {
+			node wT = adj->theEdge()->target();
+			if (wT != vT) {
+				stack.push(wT);
+			}
 		}
 	}
 
@@ -617,18 +666,13 @@ bool PlanarSPQRTree::nextEmbedding(ListIterator<node> it) {
 	//if the last embedding of the actual SPQR-node *it was computed: compute
 	//the first embedding of *it and the next embedding of *it++
 	//otherwise: compute the next embedding of *it
-	if (!nextEmbedding(*it)) {
-		++it;
-		//if there is a valid successor of *it in the list of P- and R-nodes: compute
-		//its next embedding
-		//otherwise: all embeddings are computed
-		if (it.valid()) {
-			return nextEmbedding(it);
-		} else {
-			return false;
+	//if there is no valid successor of *it in the list of nodes, all embeddings are computed
+	for (; it.valid(); ++it) {
+		if (nextEmbedding(*it)) {
+			return true;
 		}
 	}
-	return true;
+	return false;
 }
 
 }
@@ -308,6 +308,7 @@ void FMMMLayout::resetOptions() {
 	nmSmallCell(FMMMOptions::SmallestCellFinding::Iteratively);
 	nmParticlesInLeaves(25);
 	nmPrecision(4);
+	m_maxThreads = 1;
 }
 
 void FMMMLayout::update_low_level_options_due_to_high_level_options_settings() {
@@ -1075,6 +1076,7 @@ void FMMMLayout::make_initialisations_for_rep_calc_classes(Graph& G) {
 		FR.make_initialisations(boxlength, down_left_corner, frGridQuotient());
 		break;
 	case FMMMOptions::RepulsiveForcesMethod::NMM:
+		NM.max_threads(maxThreads());
 		NM.make_initialisations(G, boxlength, down_left_corner, nmParticlesInLeaves(),
 				nmPrecision(), nmTreeConstruction(), nmSmallCell());
 	}
@@ -34,6 +34,7 @@
 #include <ogdf/basic/GraphAttributes.h>
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/System.h>
+#include <ogdf/basic/ThreadPool.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/geometry.h>
 #include <ogdf/energybased/FastMultipoleEmbedder.h>
@@ -182,13 +183,14 @@ void FastMultipoleEmbedder::allocate(uint32_t numNodes, uint32_t numEdges) {
 	m_pGraph = new ArrayGraph(numNodes, numEdges);
 	initOptions();
 	if (!m_maxNumberOfThreads) {
-		uint32_t availableThreads = System::numberOfProcessors();
+		uint32_t availableThreads = ThreadPool::global().maxThreads();
 		uint32_t minNodesPerThread = 100;
 		m_numberOfThreads = numNodes / minNodesPerThread;
 		m_numberOfThreads = max<uint32_t>(1, m_numberOfThreads);
 		m_numberOfThreads = prevPowerOfTwo(min<uint32_t>(m_numberOfThreads, availableThreads));
 	} else {
-		uint32_t availableThreads = min<uint32_t>(m_maxNumberOfThreads, System::numberOfProcessors());
+		uint32_t availableThreads =
+				min<uint32_t>(m_maxNumberOfThreads, ThreadPool::global().maxThreads());
 		uint32_t minNodesPerThread = 100;
 		m_numberOfThreads = numNodes / minNodesPerThread;
 		m_numberOfThreads = max<uint32_t>(1, m_numberOfThreads);
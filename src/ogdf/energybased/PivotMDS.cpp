@@ -235,7 +235,8 @@ void PivotMDS::eigenValueDecomposition(Array<Array<double>>& K, Array<Array<doub
 	}
 }
 
-void PivotMDS::getPivotDistanceMatrix(const GraphAttributes& GA, Array<Array<double>>& pivDistMatrix) {
+void PivotMDS::getPivotDistanceMatrix(const GraphAttributes& GA, Array<Array<double>>& pivDistMatrix,
+		Array<node>* pivots) {
 	const Graph& G = GA.constGraph();
 	const int n = G.numberOfNodes();
 
@@ -246,6 +247,9 @@ void PivotMDS::getPivotDistanceMatrix(const GraphAttributes& GA, Array<Array<dou
 	for (int i = 0; i < numberOfPivots; i++) {
 		pivDistMatrix[i].init(n);
 	}
+	if (pivots != nullptr) {
+		pivots->init(numberOfPivots);
+	}
 	// edges costs array
 	EdgeArray<double> edgeCosts;
 	bool hasEdgeCosts = false;
@@ -268,10 +272,19 @@ void PivotMDS::getPivotDistanceMatrix(const GraphAttributes& GA, Array<Array<dou
 		shortestPathSingleSource.fill(std::numeric_limits<double>::infinity());
 		if (hasEdgeCosts) {
 			dijkstra_SPSS(pivNode, G, shortestPathSingleSource, edgeCosts);
+			// Dijkstra marks unreachable nodes by the maximum value
+			for (node v : G.nodes) {
+				if (shortestPathSingleSource[v] == std::numeric_limits<double>::max()) {
+					shortestPathSingleSource[v] = std::numeric_limits<double>::infinity();
+				}
+			}
 		} else {
 			bfs_SPSS(pivNode, G, shortestPathSingleSource, m_edgeCosts);
 		}
 		copySPSS(pivDistMatrix[i], shortestPathSingleSource);
+		if (pivots != nullptr) {
+			(*pivots)[i] = pivNode;
+		}
 		// update the pivot and the minDistances array ... to ensure the
 		// correctness set minDistance of the pivot node to zero
 		minDistances[pivNode] = 0;
@@ -39,6 +39,7 @@
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/Math.h>
 #include <ogdf/basic/Thread.h>
+#include <ogdf/basic/ThreadPool.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/geometry.h>
 #include <ogdf/energybased/SpringEmbedderGridVariant.h>
@@ -113,7 +114,11 @@ SpringEmbedderGridVariant::Master::Master(const SpringEmbedderGridVariant& sprin
 	const unsigned int minNodesPerThread = 64;
 	const unsigned int n = gc.numberOfNodes();
 
-	unsigned int nThreads = max(1u, min(spring.m_maxThreads, (n / 4) / (minNodesPerThread / 4)));
+	// The workers synchronize via a barrier and thus all need their own thread; we only make
+	// sure not to exceed the global limit of the shared thread pool.
+	unsigned int nThreads = max(1u,
+			min(ThreadPool::global().threadBudget(spring.m_maxThreads),
+					(n / 4) / (minNodesPerThread / 4)));
 	m_worker.init(nThreads);
 
 	if (nThreads == 1) {
@@ -34,6 +34,7 @@
 #include <ogdf/basic/GraphAttributes.h>
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/Math.h>
+#include <ogdf/basic/NodeMatrix.h>
 #include <ogdf/basic/SList.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/geometry.h>
@@ -54,8 +55,8 @@ const double SpringEmbedderKK::desMinLength = 0.0001;
 const int SpringEmbedderKK::maxVal = std::numeric_limits<int>::max();
 
 void SpringEmbedderKK::initialize(GraphAttributes& GA, NodeArray<dpair>& partialDer,
-		const EdgeArray<double>& eLength, NodeArray<NodeArray<double>>& oLength,
-		NodeArray<NodeArray<double>>& sstrength, bool simpleBFS) {
+		const EdgeArray<double>& eLength, NodeMatrix<double>& oLength,
+		NodeMatrix<double>& sstrength, bool simpleBFS) {
 	double maxDist;
 	const Graph& G = GA.constGraph();
 	m_prevEnergy = startVal;
@@ -68,9 +69,7 @@ void SpringEmbedderKK::initialize(GraphAttributes& GA, NodeArray<dpair>& partial
 	}
 
 	//the shortest path lengths
-	for (node v : G.nodes) {
-		oLength[v].init(G, std::numeric_limits<double>::max());
-	}
+	oLength.init(G, std::numeric_limits<double>::max());
 
 	//computes shortest path distances d_ij
 	if (simpleBFS) {
@@ -154,18 +153,18 @@ void SpringEmbedderKK::initialize(GraphAttributes& GA, NodeArray<dpair>& partial
 	// Having L we can compute the original lengths l_ij
 	// Computes spring strengths k_ij
 	double dij;
+	sstrength.init(G);
 	for (node v : G.nodes) {
-		sstrength[v].init(G);
 		for (node w : G.nodes) {
-			dij = oLength[v][w];
+			dij = oLength(v, w);
 			if (dij == std::numeric_limits<double>::max()) {
-				sstrength[v][w] = minVal;
+				sstrength(v, w) = minVal;
 			} else {
-				oLength[v][w] = L * dij;
+				oLength(v, w) = L * dij;
 				if (v == w) {
-					sstrength[v][w] = 1.0;
+					sstrength(v, w) = 1.0;
 				} else {
-					sstrength[v][w] = m_K / (dij * dij);
+					sstrength(v, w) = m_K / (dij * dij);
 				}
 			}
 		}
@@ -173,7 +172,7 @@ void SpringEmbedderKK::initialize(GraphAttributes& GA, NodeArray<dpair>& partial
 }
 
 void SpringEmbedderKK::mainStep(GraphAttributes& GA, NodeArray<dpair>& partialDer,
-		NodeArray<NodeArray<double>>& oLength, NodeArray<NodeArray<double>>& sstrength) {
+		NodeMatrix<double>& oLength, NodeMatrix<double>& sstrength) {
 	const Graph& G = GA.constGraph();
 
 	// Now we compute delta_m, we search for the node with max value
@@ -222,8 +221,8 @@ void SpringEmbedderKK::mainStep(GraphAttributes& GA, NodeArray<dpair>& partialDe
 					double dist = sqrt(x_diff * x_diff + y_diff * y_diff);
 					double dist3 = dist * dist * dist;
 					OGDF_ASSERT(dist3 != 0.0);
-					double k_mi = sstrength[best_m][v];
-					double l_mi = oLength[best_m][v];
+					double k_mi = sstrength(best_m, v);
+					double l_mi = oLength(best_m, v);
 					dE_dx_dx += k_mi * (1 - (l_mi * y_diff * y_diff) / dist3);
 					dE_dx_dy += k_mi * l_mi * x_diff * y_diff / dist3;
 					dE_dy_dx += k_mi * l_mi * x_diff * y_diff / dist3;
@@ -276,8 +275,8 @@ void SpringEmbedderKK::mainStep(GraphAttributes& GA, NodeArray<dpair>& partialDe
 void SpringEmbedderKK::doCall(GraphAttributes& GA, const EdgeArray<double>& eLength, bool simpleBFS) {
 	const Graph& G = GA.constGraph();
 	NodeArray<dpair> partialDer(G); //stores the partial derivative per node
-	NodeArray<NodeArray<double>> oLength(G); //first distance, then original length
-	NodeArray<NodeArray<double>> sstrength(G); //the spring strength
+	NodeMatrix<double> oLength; //first distance, then original length
+	NodeMatrix<double> sstrength; //the spring strength
 
 	//only for debugging
 	OGDF_ASSERT(isConnected(G));
@@ -342,14 +341,14 @@ void SpringEmbedderKK::shufflePositions(GraphAttributes& GA) {
 // Compute contribution of vertex u to the first partial
 // derivatives (dE/dx_m, dE/dy_m) (for vertex m) (eq. 7 and 8 in paper)
 SpringEmbedderKK::dpair SpringEmbedderKK::computeParDer(node m, node u, GraphAttributes& GA,
-		NodeArray<NodeArray<double>>& ss, NodeArray<NodeArray<double>>& dist) {
+		NodeMatrix<double>& ss, NodeMatrix<double>& dist) {
 	dpair result(0.0, 0.0);
 	if (m != u) {
 		double x_diff = GA.x(m) - GA.x(u);
 		double y_diff = GA.y(m) - GA.y(u);
 		double distance = sqrt(x_diff * x_diff + y_diff * y_diff);
-		result.x1() = (ss[m][u]) * (x_diff - (dist[m][u]) * x_diff / distance);
-		result.x2() = (ss[m][u]) * (y_diff - (dist[m][u]) * y_diff / distance);
+		result.x1() = (ss(m, u)) * (x_diff - (dist(m, u)) * x_diff / distance);
+		result.x2() = (ss(m, u)) * (y_diff - (dist(m, u)) * y_diff / distance);
 	}
 
 	return result;
@@ -357,7 +356,7 @@ SpringEmbedderKK::dpair SpringEmbedderKK::computeParDer(node m, node u, GraphAtt
 
 //compute partial derivative for v
 SpringEmbedderKK::dpair SpringEmbedderKK::computeParDers(node v, GraphAttributes& GA,
-		NodeArray<NodeArray<double>>& ss, NodeArray<NodeArray<double>>& dist) {
+		NodeMatrix<double>& ss, NodeMatrix<double>& dist) {
 	dpair result(0.0, 0.0);
 	for (node u : GA.constGraph().nodes) {
 		dpair deriv = computeParDer(v, u, GA, ss, dist);
@@ -372,25 +371,24 @@ SpringEmbedderKK::dpair SpringEmbedderKK::computeParDers(node v, GraphAttributes
  * Initialise the original estimates from nodes and edges.
  */
 
-//we could speed this up by not using nested NodeArrays and
-//by not doing the fully symmetrical computation on undirected graphs
+//we could speed this up by not doing the fully symmetrical computation on undirected graphs
 //All Pairs Shortest Path Floyd, initializes the whole matrix
 //returns maximum distance. Does not detect negative cycles (lead to neg. values on diagonal)
 //threshold is the value for the distance of non-adjacent nodes, distance has to be
 //initialized with
 double SpringEmbedderKK::allpairssp(const Graph& G, const EdgeArray<double>& eLengths,
-		NodeArray<NodeArray<double>>& distance, const double threshold) {
+		NodeMatrix<double>& distance, const double threshold) {
 	double maxDist = -threshold;
 
 	for (node v : G.nodes) {
-		distance[v][v] = 0.0;
+		distance(v, v) = 0.0;
 	}
 
 	//TODO: Experimentally compare this against
 	// all nodes and incident edges (memory access) on huge graphs
 	for (edge e : G.edges) {
-		distance[e->source()][e->target()] = eLengths[e];
-		distance[e->target()][e->source()] = eLengths[e];
+		distance(e->source(), e->target()) = eLengths[e];
+		distance(e->target(), e->source()) = eLengths[e];
 	}
 
 	///**
@@ -399,14 +397,14 @@ double SpringEmbedderKK::allpairssp(const Graph& G, const EdgeArray<double>& eLe
 	for (node v : G.nodes) {
 		for (node u : G.nodes) {
 			for (node w : G.nodes) {
-				if ((distance[u][v] < threshold) && (distance[v][w] < threshold)) {
-					Math::updateMin(distance[u][w], distance[u][v] + distance[v][w]);
+				if ((distance(u, v) < threshold) && (distance(v, w) < threshold)) {
+					Math::updateMin(distance(u, w), distance(u, v) + distance(v, w));
 #if 0
-					distance[w][u] = distance[u][w]; //is done anyway afterwards
+					distance(w, u) = distance(u, w); //is done anyway afterwards
 #endif
 				}
-				if (distance[u][w] < threshold) {
-					Math::updateMax(maxDist, distance[u][w]);
+				if (distance(u, w) < threshold) {
+					Math::updateMax(maxDist, distance(u, w));
 				}
 			}
 		}
@@ -415,7 +413,7 @@ double SpringEmbedderKK::allpairssp(const Graph& G, const EdgeArray<double>& eLe
 #	ifdef OGDF_DEBUG
 	for(node v : G.nodes)
 	{
-		if (distance[v][v] < 0.0) std::cerr << "\n###Error in shortest path computation###\n\n";
+		if (distance(v, v) < 0.0) std::cerr << "\n###Error in shortest path computation###\n\n";
 	}
 	std::cout << "Maxdist: "<<maxDist<<"\n";
 	for(node u : G.nodes)
@@ -423,7 +421,7 @@ double SpringEmbedderKK::allpairssp(const Graph& G, const EdgeArray<double>& eLe
 	for(node w : G.nodes)
 	{
 #		if 0
-		std::cout << "Distance " << u->index() << " -> "<<w->index()<<" "<<distance[u][w]<<"\n";
+		std::cout << "Distance " << u->index() << " -> "<<w->index()<<" "<<distance(u, w)<<"\n";
 #		endif
 	}
 	}
@@ -435,11 +433,11 @@ double SpringEmbedderKK::allpairssp(const Graph& G, const EdgeArray<double>& eLe
 //the same without weights, i.e. all pairs shortest paths with BFS
 //Runs in time |V|²
 //for compatibility, distances are double
-double SpringEmbedderKK::allpairsspBFS(const Graph& G, NodeArray<NodeArray<double>>& distance) {
+double SpringEmbedderKK::allpairsspBFS(const Graph& G, NodeMatrix<double>& distance) {
 	double maxDist = 0;
 
 	for (node v : G.nodes) {
-		distance[v][v] = 0.0;
+		distance(v, v) = 0.0;
 	}
 
 	//start in each node once
@@ -452,7 +450,7 @@ double SpringEmbedderKK::allpairsspBFS(const Graph& G, NodeArray<NodeArray<doubl
 
 		while (!bfs.empty()) {
 			node w = bfs.popFrontRet();
-			double d = distance[v][w] + 1.0f;
+			double d = distance(v, w) + 1.0f;
 
 
 			for (adjEntry adj : w->adjEntries) {
@@ -460,7 +458,7 @@ double SpringEmbedderKK::allpairsspBFS(const Graph& G, NodeArray<NodeArray<doubl
 				if (mark[u]) {
 					mark[u] = false;
 					bfs.pushBack(u);
-					distance[v][u] = d;
+					distance(v, u) = d;
 					Math::updateMax(maxDist, d);
 				}
 			}
@@ -468,7 +466,7 @@ double SpringEmbedderKK::allpairsspBFS(const Graph& G, NodeArray<NodeArray<doubl
 	}
 	//check for negative cycles
 	for (node v : G.nodes) {
-		if (distance[v][v] < 0.0) {
+		if (distance(v, v) < 0.0) {
 			std::cerr << "\n###Error in shortest path computation###\n\n";
 		}
 	}
@@ -480,7 +478,7 @@ double SpringEmbedderKK::allpairsspBFS(const Graph& G, NodeArray<NodeArray<doubl
 	{
 	for(node w : G.nodes)
 	{
-		std::cout << "Distance " << u->index() << " -> "<<w->index()<<" "<<distance[u][w]<<"\n";
+		std::cout << "Distance " << u->index() << " -> "<<w->index()<<" "<<distance(u, w)<<"\n";
 	}
 	}
 #	endif
@@ -30,10 +30,13 @@
  * http://www.gnu.org/copyleft/gpl.html
  */
 
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/ArrayBuffer.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphAttributes.h>
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/Logger.h>
+#include <ogdf/basic/NodeMatrix.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/simple_graph_alg.h>
 #include <ogdf/energybased/PivotMDS.h>
@@ -41,6 +44,7 @@
 #include <ogdf/graphalg/ShortestPathAlgorithms.h>
 #include <ogdf/packing/ComponentSplitterLayout.h>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <ostream>
@@ -51,6 +55,8 @@ const double StressMinimization::EPSILON = 10e-4;
 
 const int StressMinimization::DEFAULT_NUMBER_OF_PIVOTS = 50;
 
+const int StressMinimization::DEFAULT_NUMBER_OF_SPARSE_PIVOTS = 200;
+
 void StressMinimization::call(GraphAttributes& GA) {
 	m_use3D = GA.has(GraphAttributes::threeD) && !m_forcing2DLayout;
 	const Graph& G = GA.constGraph();
@@ -68,24 +74,26 @@ void StressMinimization::call(GraphAttributes& GA) {
 	}
 	// Separate component layout cant be applied to a non-connected graph
 	OGDF_ASSERT(!m_componentLayout || isConnected(G));
-	NodeArray<NodeArray<double>> shortestPathMatrix(G);
-	NodeArray<NodeArray<double>> weightMatrix(G);
-	initMatrices(G, shortestPathMatrix, weightMatrix);
-	// if the edge costs are defined by the attribute copy it to an array and
-	// construct the proper shortest path matrix
+	if (m_sparseStress) {
+		callSparse(GA);
+		return;
+	}
+	// compute shortest path all pairs (in parallel); if the edge costs are
+	// defined by the attribute, use them instead of uniform costs
+	NodeMatrix<double, true> shortestPathMatrix;
 	if (m_hasEdgeCostsAttribute) {
 		OGDF_ASSERT(GA.has(GraphAttributes::edgeDoubleWeight));
-		m_avgEdgeCosts = dijkstra_SPAP(GA, shortestPathMatrix);
-		// compute shortest path all pairs
+		m_avgEdgeCosts = dijkstra_SPAP(GA, shortestPathMatrix, m_maxThreads);
 	} else {
 		m_avgEdgeCosts = m_edgeCosts;
-		bfs_SPAP(G, shortestPathMatrix, m_edgeCosts);
+		bfs_SPAP(G, shortestPathMatrix, m_edgeCosts, m_maxThreads);
 	}
+	NodeMatrix<double, true> weightMatrix(G, 0);
 	call(GA, shortestPathMatrix, weightMatrix);
 }
 
-void StressMinimization::call(GraphAttributes& GA, NodeArray<NodeArray<double>>& shortestPathMatrix,
-		NodeArray<NodeArray<double>>& weightMatrix) {
+void StressMinimization::call(GraphAttributes& GA, NodeMatrix<double, true>& shortestPathMatrix,
+		NodeMatrix<double, true>& weightMatrix) {
 	// compute the initial layout if necessary
 	if (!m_hasInitialLayout) {
 		computeInitialLayout(GA);
@@ -123,33 +131,33 @@ void StressMinimization::computeInitialLayout(GraphAttributes& GA) {
 	}
 }
 
-void StressMinimization::replaceInfinityDistances(NodeArray<NodeArray<double>>& shortestPathMatrix,
+void StressMinimization::replaceInfinityDistances(NodeMatrix<double, true>& shortestPathMatrix,
 		double newVal) {
 	const Graph& G = *shortestPathMatrix.graphOf();
 
 	for (node v : G.nodes) {
 		for (node w : G.nodes) {
-			if (v != w && isinf(shortestPathMatrix[v][w])) {
-				shortestPathMatrix[v][w] = newVal;
+			if (v != w && isinf(shortestPathMatrix(v, w))) {
+				shortestPathMatrix(v, w) = newVal;
 			}
 		}
 	}
 }
 
-void StressMinimization::calcWeights(const Graph& G, NodeArray<NodeArray<double>>& shortestPathMatrix,
-		NodeArray<NodeArray<double>>& weightMatrix) {
+void StressMinimization::calcWeights(const Graph& G, NodeMatrix<double, true>& shortestPathMatrix,
+		NodeMatrix<double, true>& weightMatrix) {
 	for (node v : G.nodes) {
 		for (node w : G.nodes) {
 			if (v != w) {
 				// w_ij = d_ij^-2
-				weightMatrix[v][w] = 1 / (shortestPathMatrix[v][w] * shortestPathMatrix[v][w]);
+				weightMatrix(v, w) = 1 / (shortestPathMatrix(v, w) * shortestPathMatrix(v, w));
 			}
 		}
 	}
 }
 
 double StressMinimization::calcStress(const GraphAttributes& GA,
-		NodeArray<NodeArray<double>>& shortestPathMatrix, NodeArray<NodeArray<double>>& weightMatrix) {
+		NodeMatrix<double, true>& shortestPathMatrix, NodeMatrix<double, true>& weightMatrix) {
 	double stress = 0;
 	for (node v = GA.constGraph().firstNode(); v != nullptr; v = v->succ()) {
 		for (node w = v->succ(); w != nullptr; w = w->succ()) {
@@ -161,8 +169,8 @@ double StressMinimization::calcStress(const GraphAttributes& GA,
 			}
 			double dist = sqrt(xDiff * xDiff + yDiff * yDiff + zDiff * zDiff);
 			if (dist != 0) {
-				stress += weightMatrix[v][w] * (shortestPathMatrix[v][w] - dist)
-						* (shortestPathMatrix[v][w] - dist); //
+				stress += weightMatrix(v, w) * (shortestPathMatrix(v, w) - dist)
+						* (shortestPathMatrix(v, w) - dist); //
 			}
 		}
 	}
@@ -189,7 +197,7 @@ void StressMinimization::copyLayout(const GraphAttributes& GA, NodeArray<double>
 }
 
 void StressMinimization::minimizeStress(GraphAttributes& GA,
-		NodeArray<NodeArray<double>>& shortestPathMatrix, NodeArray<NodeArray<double>>& weightMatrix) {
+		NodeMatrix<double, true>& shortestPathMatrix, NodeMatrix<double, true>& weightMatrix) {
 	const Graph& G = GA.constGraph();
 	int numberOfPerformedIterations = 0;
 
@@ -231,7 +239,7 @@ void StressMinimization::minimizeStress(GraphAttributes& GA,
 }
 
 void StressMinimization::nextIteration(GraphAttributes& GA,
-		NodeArray<NodeArray<double>>& shortestPathMatrix, NodeArray<NodeArray<double>>& weights) {
+		NodeMatrix<double, true>& shortestPathMatrix, NodeMatrix<double, true>& weights) {
 	const Graph& G = GA.constGraph();
 
 	for (node v : G.nodes) {
@@ -251,9 +259,9 @@ void StressMinimization::nextIteration(GraphAttributes& GA,
 			double zDiff = m_use3D ? GA.z(v) - GA.z(w) : 0.0;
 			double euclideanDist = sqrt(xDiff * xDiff + yDiff * yDiff + zDiff * zDiff);
 			// get the weight
-			double weight = weights[v][w];
+			double weight = weights(v, w);
 			// get the desired distance
-			double desDistance = shortestPathMatrix[v][w];
+			double desDistance = shortestPathMatrix(v, w);
 			// reset the voted x coordinate
 			// if x is not fixed
 			if (!m_fixXCoords) {
@@ -331,14 +339,187 @@ bool StressMinimization::finished(GraphAttributes& GA, int numberOfPerformedIter
 	}
 }
 
-void StressMinimization::initMatrices(const Graph& G,
-		NodeArray<NodeArray<double>>& shortestPathMatrix, NodeArray<NodeArray<double>>& weightMatrix) {
-	// init shortest path matrix by infinity distances
+void StressMinimization::callSparse(GraphAttributes& GA) {
+	const Graph& G = GA.constGraph();
+	const int n = G.numberOfNodes();
+
+	// select the pivots and compute their distances to all nodes
+	PivotMDS pivMDS;
+	pivMDS.setNumberOfPivots(m_numberOfSparsePivots);
+	pivMDS.useEdgeCostsAttribute(m_hasEdgeCostsAttribute);
+	pivMDS.setEdgeCosts(m_edgeCosts);
+	Array<Array<double>> pivDist;
+	Array<node> pivots;
+	pivMDS.getPivotDistanceMatrix(GA, pivDist, &pivots);
+	const int k = pivots.size();
+
+	// desired lengths of edges
+	EdgeArray<double> edgeCosts(G, m_edgeCosts);
+	m_avgEdgeCosts = m_edgeCosts;
+	if (m_hasEdgeCostsAttribute) {
+		OGDF_ASSERT(GA.has(GraphAttributes::edgeDoubleWeight));
+		m_avgEdgeCosts = 0;
+		for (edge e : G.edges) {
+			edgeCosts[e] = GA.doubleWeight(e);
+			m_avgEdgeCosts += edgeCosts[e];
+		}
+		m_avgEdgeCosts /= G.numberOfEdges();
+	}
+
+	// replace infinity distances by sqrt(n) as in the full model
+	if (!m_componentLayout) {
+		for (int p = 0; p < k; ++p) {
+			for (int j = 0; j < n; ++j) {
+				if (isinf(pivDist[p][j])) {
+					pivDist[p][j] = m_avgEdgeCosts * sqrt((double)n);
+				}
+			}
+		}
+	}
+
+	if (!m_hasInitialLayout) {
+		computeInitialLayout(GA);
+	}
+
+	NodeArray<int> position(G);
+	int j = 0;
 	for (node v : G.nodes) {
-		shortestPathMatrix[v].init(G, std::numeric_limits<double>::infinity());
-		shortestPathMatrix[v][v] = 0;
-		weightMatrix[v].init(G, 0);
+		position[v] = j++;
+	}
+
+	// the region of a pivot consists of the nodes closest to it;
+	// store the distances of these nodes to the pivot in ascending order
+	Array<ArrayBuffer<double>> regionDist(k);
+	for (j = 0; j < n; ++j) {
+		int closest = 0;
+		for (int p = 1; p < k; ++p) {
+			if (pivDist[p][j] < pivDist[closest][j]) {
+				closest = p;
+			}
+		}
+		regionDist[closest].push(pivDist[closest][j]);
+	}
+	for (ArrayBuffer<double>& dists : regionDist) {
+		std::sort(dists.begin(), dists.end());
+	}
+
+	// w_pj = s_pj * d_pj^-2, where s_pj is the number of nodes in the region of
+	// pivot p that are at most half as far from p as node j; pairs of adjacent
+	// nodes are covered by the edge terms instead
+	Array<Array<double>> pivWeight(k);
+	NodeArray<int> adjacentPivot(G, -1);
+	for (int p = 0; p < k; ++p) {
+		pivWeight[p].init(0, n - 1, 0);
+		for (adjEntry adj : pivots[p]->adjEntries) {
+			adjacentPivot[adj->twinNode()] = p;
+		}
+		for (node v : G.nodes) {
+			j = position[v];
+			double d = pivDist[p][j];
+			if (v != pivots[p] && adjacentPivot[v] != p && d > 0) {
+				auto end = std::upper_bound(regionDist[p].begin(), regionDist[p].end(), d / 2);
+				pivWeight[p][j] = (end - regionDist[p].begin()) / (d * d);
+			}
+		}
+	}
+
+	// calls func(w, desired distance, weight) for all terms of v
+	auto forAllTerms = [&](node v, auto&& func) {
+		for (adjEntry adj : v->adjEntries) {
+			if (!adj->theEdge()->isSelfLoop()) {
+				double d = edgeCosts[adj->theEdge()];
+				func(adj->twinNode(), d, 1 / (d * d));
+			}
+		}
+		for (int p = 0; p < k; ++p) {
+			double weight = pivWeight[p][position[v]];
+			if (weight > 0) {
+				func(pivots[p], pivDist[p][position[v]], weight);
+			}
+		}
+	};
+
+	auto calcSparseStress = [&] {
+		double stress = 0;
+		for (node v : G.nodes) {
+			forAllTerms(v, [&](node w, double desDistance, double weight) {
+				double xDiff = GA.x(v) - GA.x(w);
+				double yDiff = GA.y(v) - GA.y(w);
+				double zDiff = m_use3D ? GA.z(v) - GA.z(w) : 0.0;
+				double dist = sqrt(xDiff * xDiff + yDiff * yDiff + zDiff * zDiff);
+				stress += weight * (desDistance - dist) * (desDistance - dist);
+			});
+		}
+		return stress;
+	};
+
+	int numberOfPerformedIterations = 0;
+	double prevStress = std::numeric_limits<double>::max();
+	double curStress = std::numeric_limits<double>::max();
+	if (m_terminationCriterion == TerminationCriterion::Stress) {
+		curStress = calcSparseStress();
+	}
+
+	NodeArray<double> newX;
+	NodeArray<double> newY;
+	NodeArray<double> newZ;
+	if (m_terminationCriterion == TerminationCriterion::PositionDifference) {
+		newX.init(G);
+		newY.init(G);
+		if (m_use3D) {
+			newZ.init(G);
+		}
 	}
+
+	do {
+		if (m_terminationCriterion == TerminationCriterion::PositionDifference) {
+			if (m_use3D) {
+				copyLayout(GA, newX, newY, newZ);
+			} else {
+				copyLayout(GA, newX, newY);
+			}
+		}
+
+		// same localized update as in nextIteration(), restricted to the sparse terms
+		for (node v : G.nodes) {
+			double newXCoord = 0.0;
+			double newYCoord = 0.0;
+			double newZCoord = 0.0;
+			double totalWeight = 0;
+			forAllTerms(v, [&](node w, double desDistance, double weight) {
+				double xDiff = GA.x(v) - GA.x(w);
+				double yDiff = GA.y(v) - GA.y(w);
+				double zDiff = m_use3D ? GA.z(v) - GA.z(w) : 0.0;
+				double euclideanDist = sqrt(xDiff * xDiff + yDiff * yDiff + zDiff * zDiff);
+				double factor = euclideanDist != 0 ? desDistance / euclideanDist : 0.0;
+				newXCoord += weight * (GA.x(w) + factor * xDiff);
+				newYCoord += weight * (GA.y(w) + factor * yDiff);
+				if (m_use3D) {
+					newZCoord += weight * (GA.z(w) + factor * zDiff);
+				}
+				totalWeight += weight;
+			});
+			if (totalWeight != 0) {
+				if (!m_fixXCoords) {
+					GA.x(v) = newXCoord / totalWeight;
+				}
+				if (!m_fixYCoords) {
+					GA.y(v) = newYCoord / totalWeight;
+				}
+				if (m_use3D && !m_fixZCoords) {
+					GA.z(v) = newZCoord / totalWeight;
+				}
+			}
+		}
+
+		if (m_terminationCriterion == TerminationCriterion::Stress) {
+			prevStress = curStress;
+			curStress = calcSparseStress();
+		}
+	} while (!finished(GA, ++numberOfPerformedIterations, newX, newY, prevStress, curStress));
+
+	Logger::slout() << "Iteration count:\t" << numberOfPerformedIterations << "\tSparse stress:\t"
+					<< calcSparseStress() << std::endl;
 }
 
 }
@@ -42,6 +42,80 @@ using namespace ogdf::sse;
 namespace ogdf {
 namespace fast_multipole_embedder {
 
+#ifdef OGDF_AVX2_EXTENSIONS
+//! returns the sum of the 8 floats in v
+OGDF_AVX2_TARGET static inline float horizontal_sum_avx2(__m256 v) {
+	__m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+	sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+	sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+	return _mm_cvtss_f32(sum);
+}
+
+//! evaluates the forces between point (x, y) with size s and the points x2[0..n2) and
+//! adds them to fx, fy and fx2, fy2, respectively; the first n2 - n2 % 8 points are
+//! handled with AVX2
+OGDF_AVX2_TARGET static inline void eval_direct_point_avx2(float x, float y, float s, float& fx,
+		float& fy, float* x2, float* y2, float* s2, float* fx2, float* fy2, size_t n2) {
+	const __m256 x_i = _mm256_set1_ps(x);
+	const __m256 y_i = _mm256_set1_ps(y);
+	const __m256 s_i = _mm256_set1_ps(s);
+	const __m256 factor = _mm256_set1_ps(OGDF_FME_KERNEL_COMPUTE_FORCE_PROTECTION_FACTOR);
+	__m256 fx_sum = _mm256_setzero_ps();
+	__m256 fy_sum = _mm256_setzero_ps();
+
+	size_t j = 0;
+	for (; j + 8 <= n2; j += 8) {
+		__m256 dx = _mm256_sub_ps(x_i, _mm256_loadu_ps(x2 + j));
+		__m256 dy = _mm256_sub_ps(y_i, _mm256_loadu_ps(y2 + j));
+#	ifdef OGDF_FME_KERNEL_USE_OLD
+		__m256 s_sum = _mm256_add_ps(s_i, _mm256_loadu_ps(s2 + j));
+#	else
+		__m256 s_sum = _mm256_mul_ps(s_i, _mm256_loadu_ps(s2 + j));
+#	endif
+		// s / max(s * factor, dx * dx + dy * dy)
+		__m256 dsq = _mm256_fmadd_ps(dx, dx, _mm256_mul_ps(dy, dy));
+		__m256 f = _mm256_div_ps(s_sum, _mm256_max_ps(_mm256_mul_ps(s_sum, factor), dsq));
+		__m256 f_x = _mm256_mul_ps(dx, f);
+		__m256 f_y = _mm256_mul_ps(dy, f);
+		fx_sum = _mm256_add_ps(fx_sum, f_x);
+		fy_sum = _mm256_add_ps(fy_sum, f_y);
+		_mm256_storeu_ps(fx2 + j, _mm256_sub_ps(_mm256_loadu_ps(fx2 + j), f_x));
+		_mm256_storeu_ps(fy2 + j, _mm256_sub_ps(_mm256_loadu_ps(fy2 + j), f_y));
+	}
+	for (; j < n2; j++) {
+		float dx = x - x2[j];
+		float dy = y - y2[j];
+#	ifdef OGDF_FME_KERNEL_USE_OLD
+		float s_sum = s + s2[j];
+#	else
+		float s_sum = s * s2[j];
+#	endif
+		float f = OGDF_FME_KERNEL_COMPUTE_FORCE(dx, dy, s_sum);
+		fx += dx * f;
+		fy += dy * f;
+		fx2[j] -= dx * f;
+		fy2[j] -= dy * f;
+	}
+	fx += horizontal_sum_avx2(fx_sum);
+	fy += horizontal_sum_avx2(fy_sum);
+}
+
+OGDF_AVX2_TARGET void eval_direct_avx2(float* x, float* y, float* s, float* fx, float* fy,
+		size_t n) {
+	for (size_t i = 0; i + 1 < n; i++) {
+		eval_direct_point_avx2(x[i], y[i], s[i], fx[i], fy[i], x + i + 1, y + i + 1, s + i + 1,
+				fx + i + 1, fy + i + 1, n - i - 1);
+	}
+}
+
+OGDF_AVX2_TARGET void eval_direct_avx2(float* x1, float* y1, float* s1, float* fx1, float* fy1,
+		size_t n1, float* x2, float* y2, float* s2, float* fx2, float* fy2, size_t n2) {
+	for (size_t i = 0; i < n1; i++) {
+		eval_direct_point_avx2(x1[i], y1[i], s1[i], fx1[i], fy1[i], x2, y2, s2, fx2, fy2, n2);
+	}
+}
+#endif
+
 #ifdef OGDF_FME_KERNEL_USE_SSE_DIRECT
 
 inline void eval_direct_aligned_SSE(float* ptr_x1, float* ptr_y1, float* ptr_s1, float* ptr_fx1,
@@ -29,11 +29,14 @@
  * http://www.gnu.org/copyleft/gpl.html
  */
 
+#include <ogdf/basic/System.h>
+#include <ogdf/basic/internal/intrinsics.h>
 #include <ogdf/energybased/fast_multipole_embedder/ComplexDouble.h>
 #include <ogdf/energybased/fast_multipole_embedder/FastUtils.h>
 #include <ogdf/energybased/fast_multipole_embedder/LinearQuadtree.h>
 #include <ogdf/energybased/fast_multipole_embedder/LinearQuadtreeExpansion.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 
@@ -42,10 +45,162 @@ using namespace ogdf::sse;
 namespace ogdf {
 namespace fast_multipole_embedder {
 
+namespace {
+
+//! Array of doubles that lives on the stack for the usual expansion sizes.
+/**
+ * The array is 16-byte aligned, since ComplexDouble loads from it with aligned
+ * SSE loads if #OGDF_FME_KERNEL_USE_SSE is defined.
+ */
+class ScratchArray {
+public:
+	explicit ScratchArray(uint32_t size)
+		: m_data(size <= Capacity ? m_local
+								  : static_cast<double*>(OGDF_MALLOC_16(size * sizeof(double)))) { }
+
+	~ScratchArray() {
+		if (m_data != m_local) {
+			OGDF_FREE_16(m_data);
+		}
+	}
+
+	ScratchArray(const ScratchArray&) = delete;
+	ScratchArray& operator=(const ScratchArray&) = delete;
+
+	double* data() { return m_data; }
+
+private:
+	static constexpr uint32_t Capacity = 128;
+	alignas(16) double m_local[Capacity];
+	double* m_data;
+};
+
+void weightedSumScalar(const double* w, const double* x, uint32_t n, double* res) {
+	double re = 0;
+	double im = 0;
+	for (uint32_t i = 0; i < 2 * n; i += 2) {
+		re += w[i] * x[i];
+		im += w[i + 1] * x[i + 1];
+	}
+	res[0] += re;
+	res[1] += im;
+}
+
+void weightedProductSumScalar(const double* w, const double* x, const double* y, uint32_t n,
+		double* res) {
+	double re = 0;
+	double im = 0;
+	for (uint32_t i = 0; i < 2 * n; i += 2) {
+		re += w[i] * (x[i] * y[i] - x[i + 1] * y[i + 1]);
+		im += w[i] * (x[i] * y[i + 1] + x[i + 1] * y[i]);
+	}
+	res[0] += re;
+	res[1] += im;
+}
+
+#ifdef OGDF_AVX2_EXTENSIONS
+// An __m256d holds two complex numbers (re0, im0, re1, im1).
+
+//! Returns the two complex products x * y.
+OGDF_AVX2_TARGET inline __m256d complexMulAVX2(__m256d x, __m256d y) {
+	__m256d yRe = _mm256_movedup_pd(y); // (yre0, yre0, yre1, yre1)
+	__m256d yIm = _mm256_permute_pd(y, 0xF); // (yim0, yim0, yim1, yim1)
+	__m256d xSwapped = _mm256_permute_pd(x, 0x5); // (xim0, xre0, xim1, xre1)
+	return _mm256_fmaddsub_pd(x, yRe, _mm256_mul_pd(xSwapped, yIm));
+}
+
+//! Adds both complex numbers in \p acc and \p tail to \p res.
+OGDF_AVX2_TARGET inline void storeSumAVX2(__m256d acc, __m128d tail, double* res) {
+	__m128d sum = _mm_add_pd(_mm256_castpd256_pd128(acc), _mm256_extractf128_pd(acc, 1));
+	sum = _mm_add_pd(_mm_add_pd(sum, tail), _mm_loadu_pd(res));
+	_mm_storeu_pd(res, sum);
+}
+
+OGDF_AVX2_TARGET void weightedSumAVX2(const double* w, const double* x, uint32_t n, double* res) {
+	__m256d acc = _mm256_setzero_pd();
+	__m128d tail = _mm_setzero_pd();
+	uint32_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		acc = _mm256_fmadd_pd(_mm256_loadu_pd(w + 2 * i), _mm256_loadu_pd(x + 2 * i), acc);
+	}
+	if (i < n) {
+		tail = _mm_mul_pd(_mm_loadu_pd(w + 2 * i), _mm_loadu_pd(x + 2 * i));
+	}
+	storeSumAVX2(acc, tail, res);
+}
+
+OGDF_AVX2_TARGET void weightedProductSumAVX2(const double* w, const double* x, const double* y,
+		uint32_t n, double* res) {
+	__m256d acc = _mm256_setzero_pd();
+	__m128d tail = _mm_setzero_pd();
+	uint32_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		__m256d prod = complexMulAVX2(_mm256_loadu_pd(x + 2 * i), _mm256_loadu_pd(y + 2 * i));
+		acc = _mm256_fmadd_pd(_mm256_loadu_pd(w + 2 * i), prod, acc);
+	}
+	if (i < n) {
+		__m128d xi = _mm_loadu_pd(x + 2 * i);
+		__m128d yi = _mm_loadu_pd(y + 2 * i);
+		__m128d prod = _mm_fmaddsub_pd(xi, _mm_movedup_pd(yi),
+				_mm_mul_pd(_mm_permute_pd(xi, 0x1), _mm_permute_pd(yi, 0x3)));
+		tail = _mm_mul_pd(_mm_loadu_pd(w + 2 * i), prod);
+	}
+	storeSumAVX2(acc, tail, res);
+}
+#endif
+
+#ifdef OGDF_AVX512_EXTENSIONS
+// An __m512d holds four complex numbers, the last iteration uses a masked load.
+
+//! Returns the mask for the min(4, \p n - \p i) complex numbers starting at \p i.
+inline __mmask8 complexMaskAVX512(uint32_t i, uint32_t n) {
+	return static_cast<__mmask8>((1u << (2 * std::min(4u, n - i))) - 1);
+}
+
+//! Adds the four complex numbers in \p acc to \p res.
+OGDF_AVX512_TARGET inline void storeSumAVX512(__m512d acc, double* res) {
+	double sum[8];
+	_mm512_storeu_pd(sum, acc);
+	res[0] += (sum[0] + sum[2]) + (sum[4] + sum[6]);
+	res[1] += (sum[1] + sum[3]) + (sum[5] + sum[7]);
+}
+
+OGDF_AVX512_TARGET void weightedSumAVX512(const double* w, const double* x, uint32_t n,
+		double* res) {
+	__m512d acc = _mm512_setzero_pd();
+	for (uint32_t i = 0; i < n; i += 4) {
+		__mmask8 mask = complexMaskAVX512(i, n);
+		acc = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, w + 2 * i),
+				_mm512_maskz_loadu_pd(mask, x + 2 * i), acc);
+	}
+	storeSumAVX512(acc, res);
+}
+
+OGDF_AVX512_TARGET void weightedProductSumAVX512(const double* w, const double* x,
+		const double* y, uint32_t n, double* res) {
+	__m512d acc = _mm512_setzero_pd();
+	for (uint32_t i = 0; i < n; i += 4) {
+		__mmask8 mask = complexMaskAVX512(i, n);
+		__m512d xi = _mm512_maskz_loadu_pd(mask, x + 2 * i);
+		__m512d yi = _mm512_maskz_loadu_pd(mask, y + 2 * i);
+		__m512d yRe = _mm512_shuffle_pd(yi, yi, 0x00);
+		__m512d yIm = _mm512_shuffle_pd(yi, yi, 0xFF);
+		__m512d xSwapped = _mm512_shuffle_pd(xi, xi, 0x55);
+		__m512d prod = _mm512_fmaddsub_pd(xi, yRe, _mm512_mul_pd(xSwapped, yIm));
+		acc = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, w + 2 * i), prod, acc);
+	}
+	storeSumAVX512(acc, res);
+}
+#endif
+
+}
+
 LinearQuadtreeExpansion::LinearQuadtreeExpansion(uint32_t precision, const LinearQuadtree& tree)
 	: m_tree(tree), m_numCoeff(precision), binCoef(2 * m_numCoeff) {
 	m_numExp = m_tree.maxNumberOfNodes();
 	allocate();
+	initWeights();
+	initKernels();
 }
 
 LinearQuadtreeExpansion::~LinearQuadtreeExpansion(void) { deallocate(); }
@@ -53,11 +208,60 @@ LinearQuadtreeExpansion::~LinearQuadtreeExpansion(void) { deallocate(); }
 void LinearQuadtreeExpansion::allocate() {
 	m_multiExp = (double*)OGDF_MALLOC_16(m_numCoeff * sizeof(double) * 2 * m_numExp);
 	m_localExp = (double*)OGDF_MALLOC_16(m_numCoeff * sizeof(double) * 2 * m_numExp);
+	m_m2mWeights = (double*)OGDF_MALLOC_16(m_numCoeff * sizeof(double) * 2 * m_numCoeff);
+	m_l2lWeights = (double*)OGDF_MALLOC_16(m_numCoeff * sizeof(double) * 2 * m_numCoeff);
+	m_m2lWeights = (double*)OGDF_MALLOC_16(m_numCoeff * sizeof(double) * 2 * m_numCoeff);
 }
 
 void LinearQuadtreeExpansion::deallocate() {
 	OGDF_FREE_16(m_multiExp);
 	OGDF_FREE_16(m_localExp);
+	OGDF_FREE_16(m_m2mWeights);
+	OGDF_FREE_16(m_l2lWeights);
+	OGDF_FREE_16(m_m2lWeights);
+}
+
+void LinearQuadtreeExpansion::initWeights() {
+	// every weight is stored twice, once for the real and once for the imaginary part
+	const uint32_t rowLength = m_numCoeff << 1;
+	for (uint32_t i = 0; i < m_numCoeff * rowLength; i++) {
+		m_m2mWeights[i] = m_l2lWeights[i] = m_m2lWeights[i] = 0.0;
+	}
+	for (uint32_t j = 0; j < m_numCoeff; j++) {
+		double* m2m = m_m2mWeights + j * rowLength;
+		double* l2l = m_l2lWeights + j * rowLength;
+		double* m2l = m_m2lWeights + j * rowLength;
+		for (uint32_t i = 1; i <= j; i++) {
+			m2m[2 * (i - 1)] = m2m[2 * (i - 1) + 1] = binCoef.value(j - 1, i - 1);
+		}
+		for (uint32_t k = j; k < m_numCoeff; k++) {
+			l2l[2 * (k - j)] = l2l[2 * (k - j) + 1] = binCoef.value(k, j);
+		}
+		for (uint32_t k = 1; j > 0 && k < m_numCoeff; k++) {
+			m2l[2 * (k - 1)] = m2l[2 * (k - 1) + 1] = binCoef.value(j + k - 1, k - 1);
+		}
+	}
+}
+
+void LinearQuadtreeExpansion::initKernels() {
+	useScalarKernels();
+#ifdef OGDF_AVX2_EXTENSIONS
+	if (System::cpuSupports(CPUFeature::AVX2) && System::cpuSupports(CPUFeature::FMA)) {
+		m_weightedSum = weightedSumAVX2;
+		m_weightedProductSum = weightedProductSumAVX2;
+	}
+#endif
+#ifdef OGDF_AVX512_EXTENSIONS
+	if (System::cpuSupports(CPUFeature::AVX512F)) {
+		m_weightedSum = weightedSumAVX512;
+		m_weightedProductSum = weightedProductSumAVX512;
+	}
+#endif
+}
+
+void LinearQuadtreeExpansion::useScalarKernels() {
+	m_weightedSum = weightedSumScalar;
+	m_weightedProductSum = weightedProductSumScalar;
 }
 
 void LinearQuadtreeExpansion::P2M(uint32_t point, uint32_t receiver) {
@@ -118,20 +322,27 @@ void LinearQuadtreeExpansion::M2M(uint32_t source, uint32_t receiver) {
 	ComplexDouble delta(ComplexDouble(center_x_source, center_y_source)
 			- ComplexDouble(center_x_receiver, center_y_receiver));
 
+	// powers of delta in descending order: delta_pow[t] = delta^(numCoeff-1-t)
+	ScratchArray delta_pow(m_numCoeff << 1);
+	ComplexDouble delta_k(1.0, 0.0);
+	for (uint32_t t = m_numCoeff; t-- > 0;) {
+		delta_k.store_unaligned(delta_pow.data() + (t << 1));
+		delta_k *= delta;
+	}
+
 	ComplexDouble a(source_coeff);
 	ComplexDouble b(receiv_coeff);
 	b += a;
 	b.store(receiv_coeff);
 	for (uint32_t j = 1; j < m_numCoeff; j++) {
+		// b_j += sum_{i=1..j} a_i * delta^(j-i) * binom(j-1, i-1)
+		m_weightedProductSum(m_m2mWeights + j * (m_numCoeff << 1), source_coeff + 2,
+				delta_pow.data() + ((m_numCoeff - j) << 1), j, receiv_coeff + (j << 1));
+
+		// b_j -= a_0 * delta^j / j
 		b.load(receiv_coeff + (j << 1));
-		ComplexDouble delta_k(1.0, 0.0);
-		for (uint32_t k = 0; k < j; k++) {
-			a.load(source_coeff + ((j - k) << 1));
-			b += a * delta_k * binCoef.value(j - 1, k);
-			delta_k *= delta;
-		}
-		a.load(source_coeff);
-		b -= a * delta_k * (1 / (double)j);
+		ComplexDouble delta_j(delta_pow.data() + ((m_numCoeff - 1 - j) << 1));
+		b -= a * delta_j * (1 / (double)j);
 		b.store(receiv_coeff + (j << 1));
 	}
 }
@@ -149,15 +360,18 @@ void LinearQuadtreeExpansion::L2L(uint32_t source, uint32_t receiver) {
 	ComplexDouble center_source(center_x_source, center_y_source);
 	ComplexDouble delta(center_source - center_receiver);
 
+	// powers of delta in ascending order: delta_pow[k] = delta^k
+	ScratchArray delta_pow(m_numCoeff << 1);
+	ComplexDouble delta_k(1.0, 0.0);
+	for (uint32_t k = 0; k < m_numCoeff; k++) {
+		delta_k.store_unaligned(delta_pow.data() + (k << 1));
+		delta_k *= delta;
+	}
+
 	for (uint32_t j = 0; j < m_numCoeff; j++) {
-		ComplexDouble b(receiv_coeff + (j << 1));
-		ComplexDouble delta_k(1.0, 0.0);
-		for (uint32_t k = j; k < m_numCoeff; k++) {
-			ComplexDouble a(source_coeff + (k << 1));
-			b += a * delta_k * binCoef.value(k, j);
-			delta_k *= delta;
-		}
-		b.store(receiv_coeff + (j << 1));
+		// b_j += sum_{k=j..numCoeff-1} a_k * delta^(k-j) * binom(k, j)
+		m_weightedProductSum(m_l2lWeights + j * (m_numCoeff << 1), source_coeff + (j << 1),
+				delta_pow.data(), m_numCoeff - j, receiv_coeff + (j << 1));
 	}
 }
 
@@ -173,64 +387,51 @@ void LinearQuadtreeExpansion::M2L(uint32_t source, uint32_t receiver) {
 	ComplexDouble center_receiver(center_x_receiver, center_y_receiver);
 	ComplexDouble center_source(center_x_source, center_y_source);
 	ComplexDouble delta0(center_source - center_receiver);
-
 	ComplexDouble delta1 = -delta0;
-	ComplexDouble delta1_l(delta1);
+
+	// scaled source coefficients c_k = a_k / delta0^k for k = 1..numCoeff-1, such that
+	// only numCoeff complex divisions are needed instead of numCoeff^2
+	ScratchArray scaled_coeff(m_numCoeff << 1);
+	ComplexDouble inv_delta0 = ComplexDouble(1.0, 0.0) / delta0;
+	ComplexDouble inv_delta0_k(inv_delta0);
 	ComplexDouble a;
 	ComplexDouble a0(source_coeff);
 	ComplexDouble b;
-	ComplexDouble sum;
-	for (uint32_t j = 1; j < m_numCoeff; j++) {
-		b.load(receiv_coeff + (j << 1));
-		sum = a0 * (-1 / (double)j);
-		ComplexDouble delta0_k(delta0);
-		for (uint32_t k = 1; k < m_numCoeff; k++) {
-			a.load(source_coeff + (k << 1));
-			sum += (a * binCoef.value(j + k - 1, k - 1)) / delta0_k;
-			delta0_k *= delta0;
+	ComplexDouble sum_b0;
+	for (uint32_t k = 1; k < m_numCoeff; k++) {
+		a.load(source_coeff + (k << 1));
+		a *= inv_delta0_k;
+		a.store_unaligned(scaled_coeff.data() + ((k - 1) << 1));
+		// a_k / delta1^k = (-1)^k * c_k
+		if (k % 2 == 0) {
+			sum_b0 += a;
+		} else {
+			sum_b0 -= a;
 		}
+		inv_delta0_k *= inv_delta0;
+	}
+
+	ComplexDouble inv_delta1 = -inv_delta0;
+	ComplexDouble inv_delta1_l(inv_delta1);
+	for (uint32_t j = 1; j < m_numCoeff; j++) {
+		// b_j += (-a_0 / j + sum_{k=1..numCoeff-1} c_k * binom(j+k-1, k-1)) / delta1^j
+		double sum[2] = {0.0, 0.0};
+		m_weightedSum(m_m2lWeights + j * (m_numCoeff << 1), scaled_coeff.data(), m_numCoeff - 1,
+				sum);
+		ComplexDouble sum_j = a0 * (-1 / (double)j) + ComplexDouble(sum[0], sum[1]);
 
-		b += sum / delta1_l;
+		b.load(receiv_coeff + (j << 1));
+		b += sum_j * inv_delta1_l;
 		b.store(receiv_coeff + (j << 1));
-		delta1_l *= delta1;
+		inv_delta1_l *= inv_delta1;
 	}
 
 	// b0
 	b.load(receiv_coeff);
-#if 0
-	std::complex<double> sdelta(m_center[(receiver<<1)] - m_center[(source<<1)],
-	                            m_center[(receiver<<1)+1] - m_center[(source<<1) +1]);
-	                            //, m_x[receiver] - m_x[source], m_y[receiver] - m_y[source]);
-#endif
-#if 0
-	std::complex<double> sdelta(center_x_receiver - center_x_source,
-	                            center_y_receiver - center_y_source);
-	                            //, m_x[receiver] - m_x[source], m_y[receiver] - m_y[source]);
-
-	if ((sdelta.real() <=0) && (sdelta.imag() == 0)) { //no cont. compl. log fct exists !!!
-		sdelta = log(sdelta + 0.00000001);
-	} else {
-		sdelta = log(sdelta);
-	}
-#endif
-
-	double r = delta1.length(); //= sqrt(sdelta.real()*sdelta.real()+sdelta.imag()*sdelta.imag());
+	double r = delta1.length();
 	double phi = atan((center_x_receiver - center_x_source) / (center_y_receiver - center_y_source));
-#if 0
-	sum = a0*log(z1 - z0)
-#endif
 	b += a0 * ComplexDouble(log(r), phi);
-	// (z1 - z0)^1
-#if 0
-	b += a0*ComplexDouble(sdelta.real(), sdelta.imag());
-#endif
-	delta1_l = delta1;
-	for (uint32_t k = 1; k < m_numCoeff; k++) {
-		a.load(source_coeff + (k << 1));
-		b += a / delta1_l;
-		//(z1 - z0)^k
-		delta1_l *= delta1;
-	}
+	b += sum_b0;
 	b.store(receiv_coeff);
 }
 
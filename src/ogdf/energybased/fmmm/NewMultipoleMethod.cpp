@@ -36,6 +36,7 @@
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/Math.h>
+#include <ogdf/basic/ThreadPool.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/geometry.h>
 #include <ogdf/energybased/fmmm/FMMMOptions.h>
@@ -49,6 +50,7 @@
 #include <ogdf/energybased/fmmm/numexcept.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <complex>
 #include <functional>
@@ -57,6 +59,25 @@
 
 #define MIN_BOX_LENGTH 1e-300
 
+namespace {
+
+//! Splits [0, n) into \p numChunks contiguous chunks and calls \p func(i, first, last)
+//! for the i-th chunk [first, last) on the shared thread pool.
+template<typename Func>
+void for_each_chunk(int n, int numChunks, Func& func) {
+	auto bound = [&](int i) { return static_cast<int>(static_cast<long long>(n) * i / numChunks); };
+
+	ogdf::ThreadPool::TaskGroup tasks(numChunks);
+	for (int i = 1; i < numChunks; i++) {
+		int first = bound(i), last = bound(i + 1);
+		tasks.run([&func, i, first, last] { func(i, first, last); });
+	}
+	func(0, 0, bound(1));
+	tasks.wait();
+}
+
+}
+
 namespace ogdf {
 namespace energybased {
 namespace fmmm {
@@ -119,7 +140,7 @@ static ParticleListState traverse(List<ParticleInfo>& relevantList, double mid_c
 }
 
 NewMultipoleMethod::NewMultipoleMethod()
-	: MIN_NODE_NUMBER(175), using_NMM(true), max_power_of_2_index(30) {
+	: MIN_NODE_NUMBER(175), using_NMM(true), _max_threads(1), max_power_of_2_index(30) {
 	// setting predefined parameters
 	precision(4);
 	particles_in_leaves(25);
@@ -159,10 +180,16 @@ void NewMultipoleMethod::calculate_repulsive_forces_by_NMM(const Graph& G,
 	}
 
 	form_multipole_expansions(A, T, quad_tree_leaves);
-	calculate_local_expansions_and_WSPRLS(A, T.get_root_ptr());
-	transform_local_exp_to_forces(A, quad_tree_leaves, F_local_exp);
-	transform_multipole_exp_to_forces(A, quad_tree_leaves, F_multipole_exp);
-	calculate_neighbourcell_forces(A, quad_tree_leaves, F_direct);
+	if (max_threads() > 1) {
+		calculate_local_expansions_and_WSPRLS_in_parallel(A, T.get_root_ptr());
+		calculate_leaf_forces_in_parallel(G, A, quad_tree_leaves, F_direct, F_multipole_exp,
+				F_local_exp);
+	} else {
+		calculate_local_expansions_and_WSPRLS(A, T.get_root_ptr());
+		transform_local_exp_to_forces(A, quad_tree_leaves, F_local_exp);
+		transform_multipole_exp_to_forces(A, quad_tree_leaves, F_multipole_exp);
+		calculate_neighbourcell_forces(A, quad_tree_leaves, F_direct);
+	}
 	add_rep_forces(G, F_direct, F_multipole_exp, F_local_exp, F_rep);
 
 	delete_red_quad_tree_and_count_treenodes(T);
@@ -1366,8 +1393,72 @@ inline void NewMultipoleMethod::delete_red_quad_tree_and_count_treenodes(QuadTre
 
 inline void NewMultipoleMethod::form_multipole_expansions(NodeArray<NodeAttributes>& A,
 		QuadTreeNM& T, List<QuadTreeNodeNM*>& quad_tree_leaves) {
-	T.set_act_ptr(T.get_root_ptr());
-	form_multipole_expansion_of_subtree(A, T, quad_tree_leaves);
+	if (max_threads() > 1) {
+		// the centers are set sequentially since they depend on the random numbers
+		init_expansions_and_centers_of_subtree(T.get_root_ptr(), quad_tree_leaves);
+
+		Array<QuadTreeNodeNM*> leaves(quad_tree_leaves.size());
+		int i = 0;
+		for (QuadTreeNodeNM* leaf_ptr : quad_tree_leaves) {
+			leaves[i++] = leaf_ptr;
+		}
+		auto form_leaf_expansions = [&](int, int first, int last) {
+			for (int j = first; j < last; j++) {
+				form_multipole_expansion_of_leaf_node(A, leaves[j]);
+			}
+		};
+		for_each_chunk(leaves.size(), min(int(max_threads()), leaves.size()), form_leaf_expansions);
+
+		add_shifted_expansions_of_subtree(T.get_root_ptr());
+	} else {
+		T.set_act_ptr(T.get_root_ptr());
+		form_multipole_expansion_of_subtree(A, T, quad_tree_leaves);
+	}
+}
+
+void NewMultipoleMethod::init_expansions_and_centers_of_subtree(QuadTreeNodeNM* act_ptr,
+		List<QuadTreeNodeNM*>& quad_tree_leaves) {
+	init_expansion_Lists(act_ptr);
+	set_center(act_ptr);
+
+	if (act_ptr->is_leaf()) {
+		quad_tree_leaves.pushBack(act_ptr);
+	} else {
+		if (act_ptr->child_lt_exists()) {
+			init_expansions_and_centers_of_subtree(act_ptr->get_child_lt_ptr(), quad_tree_leaves);
+		}
+		if (act_ptr->child_rt_exists()) {
+			init_expansions_and_centers_of_subtree(act_ptr->get_child_rt_ptr(), quad_tree_leaves);
+		}
+		if (act_ptr->child_lb_exists()) {
+			init_expansions_and_centers_of_subtree(act_ptr->get_child_lb_ptr(), quad_tree_leaves);
+		}
+		if (act_ptr->child_rb_exists()) {
+			init_expansions_and_centers_of_subtree(act_ptr->get_child_rb_ptr(), quad_tree_leaves);
+		}
+	}
+}
+
+void NewMultipoleMethod::add_shifted_expansions_of_subtree(QuadTreeNodeNM* act_ptr) {
+	if (act_ptr->is_leaf()) {
+		return;
+	}
+	if (act_ptr->child_lt_exists()) {
+		add_shifted_expansions_of_subtree(act_ptr->get_child_lt_ptr());
+		add_shifted_expansion_to_father_expansion(act_ptr->get_child_lt_ptr());
+	}
+	if (act_ptr->child_rt_exists()) {
+		add_shifted_expansions_of_subtree(act_ptr->get_child_rt_ptr());
+		add_shifted_expansion_to_father_expansion(act_ptr->get_child_rt_ptr());
+	}
+	if (act_ptr->child_lb_exists()) {
+		add_shifted_expansions_of_subtree(act_ptr->get_child_lb_ptr());
+		add_shifted_expansion_to_father_expansion(act_ptr->get_child_lb_ptr());
+	}
+	if (act_ptr->child_rb_exists()) {
+		add_shifted_expansions_of_subtree(act_ptr->get_child_rb_ptr());
+		add_shifted_expansion_to_father_expansion(act_ptr->get_child_rb_ptr());
+	}
 }
 
 void NewMultipoleMethod::form_multipole_expansion_of_subtree(NodeArray<NodeAttributes>& A,
@@ -1493,6 +1584,70 @@ void NewMultipoleMethod::add_shifted_expansion_to_father_expansion(QuadTreeNodeN
 
 void NewMultipoleMethod::calculate_local_expansions_and_WSPRLS(NodeArray<NodeAttributes>& A,
 		QuadTreeNodeNM* act_node_ptr) {
+	calculate_local_expansions_and_WSPRLS_of_node(A, act_node_ptr);
+
+	// recursive calls if act_node is not a leaf
+	if (!act_node_ptr->is_leaf()) {
+		if (act_node_ptr->child_lt_exists()) {
+			calculate_local_expansions_and_WSPRLS(A, act_node_ptr->get_child_lt_ptr());
+		}
+		if (act_node_ptr->child_rt_exists()) {
+			calculate_local_expansions_and_WSPRLS(A, act_node_ptr->get_child_rt_ptr());
+		}
+		if (act_node_ptr->child_lb_exists()) {
+			calculate_local_expansions_and_WSPRLS(A, act_node_ptr->get_child_lb_ptr());
+		}
+		if (act_node_ptr->child_rb_exists()) {
+			calculate_local_expansions_and_WSPRLS(A, act_node_ptr->get_child_rb_ptr());
+		}
+	}
+}
+
+void NewMultipoleMethod::calculate_local_expansions_and_WSPRLS_in_parallel(
+		NodeArray<NodeAttributes>& A, QuadTreeNodeNM* root_ptr) {
+	// Expand the upper levels of T breadth-first until there are enough subtrees to keep
+	// all threads busy. The subtrees are independent of each other since the lists of a
+	// node only depend on the lists of its ancestors, so they can be processed in any order.
+	const int min_subtrees = 4 * max_threads();
+	List<QuadTreeNodeNM*> E;
+	Array<QuadTreeNodeNM*> subtrees;
+	E.pushBack(root_ptr);
+
+	while (!E.empty() && E.size() + subtrees.size() < min_subtrees) {
+		QuadTreeNodeNM* act_node_ptr = E.popFrontRet();
+		if (act_node_ptr->is_leaf()) {
+			subtrees.grow(1, act_node_ptr);
+		} else {
+			calculate_local_expansions_and_WSPRLS_of_node(A, act_node_ptr);
+			if (act_node_ptr->child_lt_exists()) {
+				E.pushBack(act_node_ptr->get_child_lt_ptr());
+			}
+			if (act_node_ptr->child_rt_exists()) {
+				E.pushBack(act_node_ptr->get_child_rt_ptr());
+			}
+			if (act_node_ptr->child_lb_exists()) {
+				E.pushBack(act_node_ptr->get_child_lb_ptr());
+			}
+			if (act_node_ptr->child_rb_exists()) {
+				E.pushBack(act_node_ptr->get_child_rb_ptr());
+			}
+		}
+	}
+	for (QuadTreeNodeNM* act_node_ptr : E) {
+		subtrees.grow(1, act_node_ptr);
+	}
+
+	std::atomic<int> next_subtree(0);
+	auto process_subtrees = [&](int, int, int) {
+		for (int i = next_subtree++; i < subtrees.size(); i = next_subtree++) {
+			calculate_local_expansions_and_WSPRLS(A, subtrees[i]);
+		}
+	};
+	for_each_chunk(subtrees.size(), min(int(max_threads()), subtrees.size()), process_subtrees);
+}
+
+void NewMultipoleMethod::calculate_local_expansions_and_WSPRLS_of_node(
+		NodeArray<NodeAttributes>& A, QuadTreeNodeNM* act_node_ptr) {
 	List<QuadTreeNodeNM*> I, L, L2, E, D1, D2, M;
 	QuadTreeNodeNM* selected_node_ptr;
 
@@ -1585,21 +1740,9 @@ void NewMultipoleMethod::calculate_local_expansions_and_WSPRLS(NodeArray<NodeAtt
 		add_local_expansion_of_leaf(A, ptr, act_node_ptr);
 	}
 
-	// Step 4: recursive calls if act_node is not a leaf
-	if (!act_node_ptr->is_leaf()) {
-		if (act_node_ptr->child_lt_exists()) {
-			calculate_local_expansions_and_WSPRLS(A, act_node_ptr->get_child_lt_ptr());
-		}
-		if (act_node_ptr->child_rt_exists()) {
-			calculate_local_expansions_and_WSPRLS(A, act_node_ptr->get_child_rt_ptr());
-		}
-		if (act_node_ptr->child_lb_exists()) {
-			calculate_local_expansions_and_WSPRLS(A, act_node_ptr->get_child_lb_ptr());
-		}
-		if (act_node_ptr->child_rb_exists()) {
-			calculate_local_expansions_and_WSPRLS(A, act_node_ptr->get_child_rb_ptr());
-		}
-	} else { // *act_node_ptr is a leaf
+	// Step 4 (the recursive calls) is done by the caller
+
+	if (act_node_ptr->is_leaf()) {
 		// Step 5: WSPRLS(Well Separateness Preserving Refinement of leaf surroundings)
 		// if act_node is a leaf then calculate the list D1,D2 and M from I and D1
 		act_node_ptr->get_D1(D1);
@@ -1815,6 +1958,13 @@ void NewMultipoleMethod::add_local_expansion_of_leaf(NodeArray<NodeAttributes>&
 
 void NewMultipoleMethod::transform_local_exp_to_forces(NodeArray<NodeAttributes>& A,
 		List<QuadTreeNodeNM*>& quad_tree_leaves, NodeArray<DPoint>& F_local_exp) {
+	for (const QuadTreeNodeNM* leaf_ptr : quad_tree_leaves) {
+		transform_local_exp_to_forces_of_leaf(A, leaf_ptr, F_local_exp);
+	}
+}
+
+void NewMultipoleMethod::transform_local_exp_to_forces_of_leaf(NodeArray<NodeAttributes>& A,
+		const QuadTreeNodeNM* leaf_ptr, NodeArray<DPoint>& F_local_exp) {
 	complex<double> sum;
 	complex<double> complex_null(0, 0);
 	complex<double> z_0;
@@ -1825,127 +1975,181 @@ void NewMultipoleMethod::transform_local_exp_to_forces(NodeArray<NodeAttributes>
 	//and evaluate it for each node in contained_nodes()
 	//and transform the complex number back to the real-world, to obtain the force
 
-	for (const QuadTreeNodeNM* leaf_ptr : quad_tree_leaves) {
-		List<node> contained_nodes;
-		leaf_ptr->get_contained_nodes(contained_nodes);
-		z_0 = leaf_ptr->get_Sm_center();
+	List<node> contained_nodes;
+	leaf_ptr->get_contained_nodes(contained_nodes);
+	z_0 = leaf_ptr->get_Sm_center();
 
-		for (node v : contained_nodes) {
-			complex<double> z_v(A[v].get_x(), A[v].get_y());
-			sum = complex_null;
-			z_v_minus_z_0_over_k_minus_1 = 1;
-			for (int k = 1; k <= precision(); k++) {
-				sum += double(k) * leaf_ptr->get_local_exp()[k] * z_v_minus_z_0_over_k_minus_1;
-				z_v_minus_z_0_over_k_minus_1 *= z_v - z_0;
-			}
-			force_vector.m_x = sum.real();
-			force_vector.m_y = (-1) * sum.imag();
-			F_local_exp[v] = force_vector;
+	for (node v : contained_nodes) {
+		complex<double> z_v(A[v].get_x(), A[v].get_y());
+		sum = complex_null;
+		z_v_minus_z_0_over_k_minus_1 = 1;
+		for (int k = 1; k <= precision(); k++) {
+			sum += double(k) * leaf_ptr->get_local_exp()[k] * z_v_minus_z_0_over_k_minus_1;
+			z_v_minus_z_0_over_k_minus_1 *= z_v - z_0;
 		}
+		force_vector.m_x = sum.real();
+		force_vector.m_y = (-1) * sum.imag();
+		F_local_exp[v] = force_vector;
 	}
 }
 
 void NewMultipoleMethod::transform_multipole_exp_to_forces(NodeArray<NodeAttributes>& A,
 		List<QuadTreeNodeNM*>& quad_tree_leaves, NodeArray<DPoint>& F_multipole_exp) {
+	for (const QuadTreeNodeNM* leaf_ptr : quad_tree_leaves) {
+		transform_multipole_exp_to_forces_of_leaf(A, leaf_ptr, F_multipole_exp);
+	}
+}
+
+void NewMultipoleMethod::transform_multipole_exp_to_forces_of_leaf(NodeArray<NodeAttributes>& A,
+		const QuadTreeNodeNM* act_leaf_ptr, NodeArray<DPoint>& F_multipole_exp) {
 	complex<double> sum;
 	complex<double> z_0;
 	complex<double> z_v_minus_z_0_over_minus_k_minus_1;
 	DPoint force_vector;
 
-	//for each leaf u in the M-List of an actual leaf v do:
+	//for each leaf u in the M-List of the actual leaf v do:
 	//calculate derivative of the multipole expansion function at u
 	//and evaluate it for each node in v.get_contained_nodes()
 	//and transform the complex number back to the real-world, to obtain the force
 
-	for (QuadTreeNodeNM* act_leaf_ptr : quad_tree_leaves) {
-		List<node> act_contained_nodes;
-		act_leaf_ptr->get_contained_nodes(act_contained_nodes);
+	List<node> act_contained_nodes;
+	act_leaf_ptr->get_contained_nodes(act_contained_nodes);
 
-		List<QuadTreeNodeNM*> M;
-		act_leaf_ptr->get_M(M);
+	List<QuadTreeNodeNM*> M;
+	act_leaf_ptr->get_M(M);
 
-		for (const QuadTreeNodeNM* M_node_ptr : M) {
-			z_0 = M_node_ptr->get_Sm_center();
-			for (node v : act_contained_nodes) {
-				complex<double> z_v(A[v].get_x(), A[v].get_y());
-				z_v_minus_z_0_over_minus_k_minus_1 = 1.0 / (z_v - z_0);
-				sum = M_node_ptr->get_multipole_exp()[0] * z_v_minus_z_0_over_minus_k_minus_1;
-
-				for (int k = 1; k <= precision(); k++) {
-					z_v_minus_z_0_over_minus_k_minus_1 /= z_v - z_0;
-					sum -= double(k) * M_node_ptr->get_multipole_exp()[k]
-							* z_v_minus_z_0_over_minus_k_minus_1;
-				}
-				force_vector.m_x = sum.real();
-				force_vector.m_y = (-1) * sum.imag();
-				F_multipole_exp[v] = F_multipole_exp[v] + force_vector;
+	for (const QuadTreeNodeNM* M_node_ptr : M) {
+		z_0 = M_node_ptr->get_Sm_center();
+		for (node v : act_contained_nodes) {
+			complex<double> z_v(A[v].get_x(), A[v].get_y());
+			z_v_minus_z_0_over_minus_k_minus_1 = 1.0 / (z_v - z_0);
+			sum = M_node_ptr->get_multipole_exp()[0] * z_v_minus_z_0_over_minus_k_minus_1;
+
+			for (int k = 1; k <= precision(); k++) {
+				z_v_minus_z_0_over_minus_k_minus_1 /= z_v - z_0;
+				sum -= double(k) * M_node_ptr->get_multipole_exp()[k]
+						* z_v_minus_z_0_over_minus_k_minus_1;
 			}
+			force_vector.m_x = sum.real();
+			force_vector.m_y = (-1) * sum.imag();
+			F_multipole_exp[v] = F_multipole_exp[v] + force_vector;
 		}
 	}
 }
 
 void NewMultipoleMethod::calculate_neighbourcell_forces(NodeArray<NodeAttributes>& A,
 		List<QuadTreeNodeNM*>& quad_tree_leaves, NodeArray<DPoint>& F_direct) {
+	for (const QuadTreeNodeNM* act_leaf : quad_tree_leaves) {
+		calculate_neighbourcell_forces_of_leaf(A, act_leaf, F_direct);
+	}
+}
+
+void NewMultipoleMethod::calculate_neighbourcell_forces_of_leaf(NodeArray<NodeAttributes>& A,
+		const QuadTreeNodeNM* act_leaf, NodeArray<DPoint>& F_direct) {
 	List<node> act_contained_nodes, neighbour_contained_nodes, non_neighbour_contained_nodes;
 	List<QuadTreeNodeNM*> neighboured_leaves;
 	List<QuadTreeNodeNM*> non_neighboured_leaves;
 	double act_leaf_boxlength, neighbour_leaf_boxlength;
 	DPoint act_leaf_dlc, neighbour_leaf_dlc;
 
-	for (QuadTreeNodeNM* act_leaf : quad_tree_leaves) {
-		act_leaf->get_contained_nodes(act_contained_nodes);
+	act_leaf->get_contained_nodes(act_contained_nodes);
 
-		if (act_contained_nodes.size() <= particles_in_leaves()) { // usual case
-			// Step 1: calculate forces inside act_contained_nodes
-			calculate_forces_inside_contained_nodes(F_direct, A, act_contained_nodes);
+	if (act_contained_nodes.size() <= particles_in_leaves()) { // usual case
+		// Step 1: calculate forces inside act_contained_nodes
+		calculate_forces_inside_contained_nodes(F_direct, A, act_contained_nodes);
 
-			//Step 2: calculated forces to nodes in act_contained_nodes() of
-			//leaf_ptr->get_D1()
+		//Step 2: calculated forces to nodes in act_contained_nodes() of
+		//leaf_ptr->get_D1()
 
-			act_leaf->get_D1(neighboured_leaves);
-			act_leaf_boxlength = act_leaf->get_Sm_boxlength();
-			act_leaf_dlc = act_leaf->get_Sm_downleftcorner();
+		act_leaf->get_D1(neighboured_leaves);
+		act_leaf_boxlength = act_leaf->get_Sm_boxlength();
+		act_leaf_dlc = act_leaf->get_Sm_downleftcorner();
 
-			for (const QuadTreeNodeNM* neighbour_leaf : neighboured_leaves) {
-				//forget boxes that have already been looked at
+		for (const QuadTreeNodeNM* neighbour_leaf : neighboured_leaves) {
+			//forget boxes that have already been looked at
 
-				neighbour_leaf_boxlength = neighbour_leaf->get_Sm_boxlength();
-				neighbour_leaf_dlc = neighbour_leaf->get_Sm_downleftcorner();
+			neighbour_leaf_boxlength = neighbour_leaf->get_Sm_boxlength();
+			neighbour_leaf_dlc = neighbour_leaf->get_Sm_downleftcorner();
 
-				if ((act_leaf_boxlength > neighbour_leaf_boxlength)
-						|| (act_leaf_boxlength == neighbour_leaf_boxlength
-								&& act_leaf_dlc < neighbour_leaf_dlc)) {
-					neighbour_leaf->get_contained_nodes(neighbour_contained_nodes);
-
-					for (node v : act_contained_nodes) {
-						for (node u : neighbour_contained_nodes) {
-							DPoint f_rep_u_on_v = numexcept::f_rep_u_on_v(A[u].get_position(),
-									A[v].get_position());
-							F_direct[v] += f_rep_u_on_v;
-							F_direct[u] -= f_rep_u_on_v;
-						}
-					}
-				}
-			}
+			if ((act_leaf_boxlength > neighbour_leaf_boxlength)
+					|| (act_leaf_boxlength == neighbour_leaf_boxlength
+							&& act_leaf_dlc < neighbour_leaf_dlc)) {
+				neighbour_leaf->get_contained_nodes(neighbour_contained_nodes);
 
-			//Step 3: calculated forces to nodes in act_contained_nodes() of
-			//leaf_ptr->get_D2()
-
-			act_leaf->get_D2(non_neighboured_leaves);
-			for (const QuadTreeNodeNM* non_neighbour_leaf : non_neighboured_leaves) {
-				non_neighbour_leaf->get_contained_nodes(non_neighbour_contained_nodes);
 				for (node v : act_contained_nodes) {
-					for (node u : non_neighbour_contained_nodes) {
-						F_direct[v] +=
+					for (node u : neighbour_contained_nodes) {
+						DPoint f_rep_u_on_v =
 								numexcept::f_rep_u_on_v(A[u].get_position(), A[v].get_position());
+						F_direct[v] += f_rep_u_on_v;
+						F_direct[u] -= f_rep_u_on_v;
 					}
 				}
 			}
-		} else { // special case (more than particles_in_leaves() particles in this leaf)
+		}
+
+		//Step 3: calculated forces to nodes in act_contained_nodes() of
+		//leaf_ptr->get_D2()
+
+		act_leaf->get_D2(non_neighboured_leaves);
+		for (const QuadTreeNodeNM* non_neighbour_leaf : non_neighboured_leaves) {
+			non_neighbour_leaf->get_contained_nodes(non_neighbour_contained_nodes);
 			for (node v : act_contained_nodes) {
-				F_direct[v] += numexcept::f_rep_u_on_v(A[v].get_position(), A[v].get_position());
+				for (node u : non_neighbour_contained_nodes) {
+					F_direct[v] += numexcept::f_rep_u_on_v(A[u].get_position(), A[v].get_position());
+				}
 			}
 		}
+	} else { // special case (more than particles_in_leaves() particles in this leaf)
+		for (node v : act_contained_nodes) {
+			F_direct[v] += numexcept::f_rep_u_on_v(A[v].get_position(), A[v].get_position());
+		}
+	}
+}
+
+void NewMultipoleMethod::calculate_leaf_forces_in_parallel(const Graph& G,
+		NodeArray<NodeAttributes>& A, List<QuadTreeNodeNM*>& quad_tree_leaves,
+		NodeArray<DPoint>& F_direct, NodeArray<DPoint>& F_multipole_exp,
+		NodeArray<DPoint>& F_local_exp) {
+	// Leaves with more than particles_in_leaves() particles only occur if nodes share
+	// their position; their forces are random and thus computed sequentially afterwards.
+	Array<const QuadTreeNodeNM*> leaves(quad_tree_leaves.size());
+	List<const QuadTreeNodeNM*> crowded_leaves;
+	List<node> contained_nodes;
+	int number_of_leaves = 0;
+	for (const QuadTreeNodeNM* leaf_ptr : quad_tree_leaves) {
+		leaf_ptr->get_contained_nodes(contained_nodes);
+		if (contained_nodes.size() <= particles_in_leaves()) {
+			leaves[number_of_leaves++] = leaf_ptr;
+		} else {
+			crowded_leaves.pushBack(leaf_ptr);
+		}
+	}
+
+	const int number_of_chunks = max(1, min(int(max_threads()), number_of_leaves));
+	Array<NodeArray<DPoint>> F_direct_of_chunk(number_of_chunks);
+	for (NodeArray<DPoint>& F : F_direct_of_chunk) {
+		F.init(G, DPoint(0, 0));
+	}
+
+	auto calculate_forces = [&](int chunk, int first, int last) {
+		for (int i = first; i < last; i++) {
+			transform_local_exp_to_forces_of_leaf(A, leaves[i], F_local_exp);
+			transform_multipole_exp_to_forces_of_leaf(A, leaves[i], F_multipole_exp);
+			calculate_neighbourcell_forces_of_leaf(A, leaves[i], F_direct_of_chunk[chunk]);
+		}
+	};
+	for_each_chunk(number_of_leaves, number_of_chunks, calculate_forces);
+
+	for (node v : G.nodes) {
+		for (const NodeArray<DPoint>& F : F_direct_of_chunk) {
+			F_direct[v] += F[v];
+		}
+	}
+
+	for (const QuadTreeNodeNM* leaf_ptr : crowded_leaves) {
+		transform_local_exp_to_forces_of_leaf(A, leaf_ptr, F_local_exp);
+		transform_multipole_exp_to_forces_of_leaf(A, leaf_ptr, F_multipole_exp);
+		calculate_neighbourcell_forces_of_leaf(A, leaf_ptr, F_direct);
 	}
 }
 
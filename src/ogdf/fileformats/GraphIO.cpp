@@ -76,6 +76,7 @@ namespace ogdf {
 
 char GraphIO::s_indentChar = '\t';
 int GraphIO::s_indentWidth = 1;
+int GraphIO::s_maxEdgeListNodes = 100000000;
 Logger GraphIO::logger;
 
 GraphIO::FileType::FileType(std::vector<std::string> _extensions, GraphIO::ReaderFunc readerFunc,
@@ -96,7 +97,8 @@ GraphIO::FileType::FileType(std::vector<std::string> _extensions, GraphIO::Reade
 	, cluster_writer_func(clusterWriterFunc)
 	, cluster_attr_reader_func(clusterAttrReaderFunc)
 	, auto_cluster_attr_reader_func(clusterAttrReaderFunc)
-	, cluster_attr_writer_func(clusterAttrWriterFunc) { }
+	, cluster_attr_writer_func(clusterAttrWriterFunc)
+	, binary(false) { }
 
 GraphIO::FileType& GraphIO::FileType::replaceAutoReaders(GraphIO::ReaderFunc readerFunc,
 		GraphIO::AttrReaderFunc attrReaderFunc, GraphIO::ClusterReaderFunc clusterReaderFunc,
@@ -108,6 +110,11 @@ GraphIO::FileType& GraphIO::FileType::replaceAutoReaders(GraphIO::ReaderFunc rea
 	return *this;
 }
 
+GraphIO::FileType& GraphIO::FileType::markBinary() {
+	binary = true;
+	return *this;
+}
+
 bool readGraph6WithForcedHeader(Graph& G, std::istream& is) {
 	return GraphIO::readGraph6(G, is, true);
 }
@@ -168,6 +175,9 @@ const std::vector<GraphIO::FileType> GraphIO::FILE_TYPES = {
 		GraphIO::FileType({"dmf"}, GraphIO::readDMF, nullptr, GraphIO::readDMF, nullptr),
 		GraphIO::FileType({"pm", "pmd"}, GraphIO::readPMDissGraph, GraphIO::writePMDissGraph),
 		GraphIO::FileType({"rudy"}, GraphIO::readRudy, nullptr, GraphIO::readRudy, GraphIO::writeRudy),
+		GraphIO::FileType({"ogdfbin"}, GraphIO::readBinary, GraphIO::writeBinary,
+				GraphIO::readBinary, GraphIO::writeBinary)
+				.markBinary(),
 
 		// SVG and TikZ can only write GraphAttributes and ClusterGraphAttributes
 		GraphIO::FileType({"svg"}, nullptr, nullptr, nullptr, GraphIO::drawSVG, nullptr, nullptr,
@@ -183,6 +193,8 @@ const std::vector<GraphIO::FileType> GraphIO::FILE_TYPES = {
 		GraphIO::FileType({"mtx"}, GraphIO::readMatrixMarket)
 				.replaceAutoReaders(
 						nullptr), // otherwise accepts many (~42) invalid files of other formats
+		GraphIO::FileType({"edgelist", "edges"}, GraphIO::readEdgeList, GraphIO::writeEdgeList)
+				.replaceAutoReaders(nullptr), // accepts most files consisting of numbers only
 
 		// The following graph formats have no corresponding generic ReaderFunc:
 		//		GraphIO::FileType( {}, GraphIO::readBENCH, nullptr,GraphIO::readBENCH), // (Hypergraph)
@@ -237,19 +249,24 @@ std::ostream& GraphIO::indent(std::ostream& os, int depth) {
 	return os;
 }
 
-#define READ_FILENAME(FUNC, ...)                       \
-	{                                                  \
-		if (reader == nullptr) {                       \
-			const FileType* t = getFileType(filename); \
-			if (t == nullptr) {                        \
-				reader = GraphIO::read;                \
-			} else {                                   \
-				reader = t->FUNC;                      \
-			}                                          \
-		}                                              \
-		OGDF_ASSERT(reader);                           \
-		std::ifstream is(filename);                    \
-		return is.good() && reader(__VA_ARGS__, is);   \
+//! Returns \p mode, extended by std::ios::binary if files of type \p t are binary.
+static std::ios::openmode openMode(const GraphIO::FileType* t, std::ios::openmode mode) {
+	return t != nullptr && t->binary ? mode | std::ios::binary : mode;
+}
+
+#define READ_FILENAME(FUNC, ...)                               \
+	{                                                          \
+		const FileType* t = getFileType(filename);             \
+		if (reader == nullptr) {                               \
+			if (t == nullptr) {                                \
+				reader = GraphIO::read;                        \
+			} else {                                           \
+				reader = t->FUNC;                              \
+			}                                                  \
+		}                                                      \
+		OGDF_ASSERT(reader);                                   \
+		std::ifstream is(filename, openMode(t, std::ios::in)); \
+		return is.good() && reader(__VA_ARGS__, is);           \
 	}
 
 bool GraphIO::read(Graph& G, const string& filename, GraphIO::ReaderFunc reader)
@@ -266,8 +283,8 @@ bool GraphIO::read(ClusterGraphAttributes& GA, ClusterGraph& CG, Graph& G, const
 
 #define WRITE_FILENAME(FUNC, ARG)                                                                      \
 	{                                                                                                  \
+		const FileType* t = getFileType(filename);                                                     \
 		if (writer == nullptr) {                                                                       \
-			const FileType* t = getFileType(filename);                                                 \
 			if (t == nullptr) {                                                                        \
 				logger.lout()                                                                          \
 						<< "Can't determine type of file " << filename << " for writing, "             \
@@ -279,7 +296,7 @@ bool GraphIO::read(ClusterGraphAttributes& GA, ClusterGraph& CG, Graph& G, const
 			}                                                                                          \
 		}                                                                                              \
 		OGDF_ASSERT(writer);                                                                           \
-		std::ofstream os(filename);                                                                    \
+		std::ofstream os(filename, openMode(t, std::ios::out));                                        \
 		return os.good() && writer(ARG, os);                                                           \
 	}
 
@@ -1647,6 +1664,9 @@ bool GraphIO::readEdgeListSubgraph(Graph& G, List<edge>& delEdges, std::istream&
 		return false;
 	}
 
+	G.reserveNodes(n);
+	G.reserveEdges(m + m_del);
+
 	Array<node> indexToNode(n);
 	for (int i = 0; i < n; ++i) {
 		indexToNode[i] = G.newNode();
@@ -0,0 +1,599 @@
+/** \file
+ * \brief Implements read and write functionality for OGDF's binary format.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphAttributes.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/List.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/geometry.h>
+#include <ogdf/basic/graphics.h>
+#include <ogdf/fileformats/GraphIO.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ogdf {
+
+namespace {
+
+const char signature[8] = {'\x89', 'O', 'G', 'D', 'F', '\r', '\n', '\x1a'};
+const uint32_t byteOrderMark = 0x01020304;
+const uint32_t formatVersion = 1;
+const uint32_t flagDirected = 1;
+
+//! Types of blocks in the binary format. Never change the values of existing types.
+enum class BlockType : uint32_t {
+	End = 0,
+	Edges = 1, //!< pairs of 32 bit source and target indices
+	NodeX = 2, //!< doubles
+	NodeY = 3, //!< doubles
+	NodeZ = 4, //!< doubles
+	NodeWidth = 5, //!< doubles
+	NodeHeight = 6, //!< doubles
+	NodeShape = 7, //!< 32 bit integers
+	NodeWeight = 8, //!< 32 bit integers
+	NodeLabel = 9, //!< strings
+	EdgeBends = 10, //!< 64 bit offsets into the array of (x, y) pairs of doubles
+	EdgeIntWeight = 11, //!< 32 bit integers
+	EdgeDoubleWeight = 12, //!< doubles
+	EdgeLabel = 13, //!< strings (64 bit offsets into the array of characters)
+};
+
+//! Source and target index of an edge as stored in a BlockType::Edges block.
+struct EdgeRecord {
+	int32_t first;
+	int32_t second;
+};
+
+//! Header of the binary format.
+struct FileHeader {
+	char signature[8];
+	uint32_t byteOrderMark;
+	uint32_t version;
+	uint32_t flags;
+	uint32_t reserved;
+	uint64_t numberOfNodes;
+	uint64_t numberOfEdges;
+};
+
+//! Header of a block.
+struct BlockHeader {
+	uint32_t type;
+	uint32_t reserved;
+	uint64_t length;
+};
+
+static_assert(sizeof(EdgeRecord) == 8, "unexpected padding in EdgeRecord");
+static_assert(sizeof(FileHeader) == 40, "unexpected padding in FileHeader");
+static_assert(sizeof(BlockHeader) == 16, "unexpected padding in BlockHeader");
+
+//! Returns the number of zero bytes needed to pad \p length to a multiple of 8.
+inline uint64_t paddingOf(uint64_t length) { return (8 - length % 8) % 8; }
+
+class BinaryWriter {
+public:
+	explicit BinaryWriter(std::ostream& os) : m_os(os) { }
+
+	template<typename T>
+	void write(const T& value) {
+		static_assert(std::is_trivially_copyable<T>::value, "only plain values can be written");
+		m_os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	//! Writes a block of type \p type consisting of the array \p data.
+	template<typename T>
+	void writeBlock(BlockType type, const std::vector<T>& data) {
+		static_assert(std::is_trivially_copyable<T>::value, "only plain values can be written");
+		const uint64_t length = data.size() * sizeof(T);
+		write(BlockHeader {static_cast<uint32_t>(type), 0, length});
+		m_os.write(reinterpret_cast<const char*>(data.data()), length);
+		writePadding(length);
+	}
+
+	//! Writes a block of type \p type consisting of \p offsets followed by \p values.
+	template<typename T>
+	void writeBlock(BlockType type, const std::vector<uint64_t>& offsets,
+			const std::vector<T>& values) {
+		const uint64_t offsetsLength = offsets.size() * sizeof(uint64_t);
+		const uint64_t valuesLength = values.size() * sizeof(T);
+		write(BlockHeader {static_cast<uint32_t>(type), 0, offsetsLength + valuesLength});
+		m_os.write(reinterpret_cast<const char*>(offsets.data()), offsetsLength);
+		m_os.write(reinterpret_cast<const char*>(values.data()), valuesLength);
+		writePadding(offsetsLength + valuesLength);
+	}
+
+	//! Writes a node attribute block with value \p f(v) for every node v of \p G.
+	template<typename T, typename Func>
+	void writeNodeBlock(BlockType type, const Graph& G, Func f) {
+		std::vector<T> data;
+		data.reserve(G.numberOfNodes());
+		for (node v : G.nodes) {
+			data.push_back(static_cast<T>(f(v)));
+		}
+		writeBlock(type, data);
+	}
+
+	//! Writes an edge attribute block with value \p f(e) for every edge e of \p G.
+	template<typename T, typename Func>
+	void writeEdgeBlock(BlockType type, const Graph& G, Func f) {
+		std::vector<T> data;
+		data.reserve(G.numberOfEdges());
+		for (edge e : G.edges) {
+			data.push_back(static_cast<T>(f(e)));
+		}
+		writeBlock(type, data);
+	}
+
+	//! Writes a block of strings with value \p f(x) for every element x of \p container.
+	template<typename Container, typename Func>
+	void writeStringBlock(BlockType type, const Container& container, Func f) {
+		std::vector<uint64_t> offsets {0};
+		std::vector<char> chars;
+		for (auto x : container) {
+			const string& str = f(x);
+			chars.insert(chars.end(), str.begin(), str.end());
+			offsets.push_back(chars.size());
+		}
+		writeBlock(type, offsets, chars);
+	}
+
+	bool good() const { return m_os.good(); }
+
+private:
+	std::ostream& m_os;
+
+	void writePadding(uint64_t length) {
+		static const char zeros[8] = {0};
+		m_os.write(zeros, paddingOf(length));
+	}
+};
+
+class BinaryReader {
+public:
+	explicit BinaryReader(std::istream& is) : m_is(is) { }
+
+	template<typename T>
+	bool read(T& value) {
+		static_assert(std::is_trivially_copyable<T>::value, "only plain values can be read");
+		return readBytes(reinterpret_cast<char*>(&value), sizeof(T));
+	}
+
+	//! Reads the payload of a block of \p length bytes consisting of \p count values.
+	template<typename T>
+	bool readArray(std::vector<T>& data, uint64_t length, uint64_t count) {
+		if (length != count * sizeof(T)) {
+			return false;
+		}
+		return readValues(data, count) && skip(paddingOf(length));
+	}
+
+	//! Reads the payload of a block of \p length bytes consisting of \p count + 1 offsets
+	//! followed by values.
+	template<typename T>
+	bool readArray(std::vector<uint64_t>& offsets, std::vector<T>& values, uint64_t length,
+			uint64_t count) {
+		const uint64_t offsetsLength = (count + 1) * sizeof(uint64_t);
+		if (length < offsetsLength) {
+			return false;
+		}
+		if (!readValues(offsets, count + 1) || offsets[0] != 0) {
+			return false;
+		}
+		for (uint64_t i = 0; i < count; ++i) {
+			if (offsets[i + 1] < offsets[i]) {
+				return false;
+			}
+		}
+		if (offsets[count] > length / sizeof(T)
+				|| length - offsetsLength != offsets[count] * sizeof(T)) {
+			return false;
+		}
+		return readValues(values, offsets[count]) && skip(paddingOf(length));
+	}
+
+	//! Skips the payload of a block of \p length bytes.
+	bool skipBlock(uint64_t length) { return skip(length + paddingOf(length)); }
+
+	//! Returns the number of bytes left in the stream, or the maximum value if unknown.
+	uint64_t bytesLeft() {
+		const uint64_t unknown = std::numeric_limits<uint64_t>::max();
+		const std::streampos pos = m_is.tellg();
+		if (pos == std::streampos(-1)) {
+			return unknown;
+		}
+		m_is.seekg(0, std::ios::end);
+		const std::streampos end = m_is.tellg();
+		m_is.clear();
+		m_is.seekg(pos);
+		return end == std::streampos(-1) || end < pos ? unknown : uint64_t(end - pos);
+	}
+
+private:
+	//! Number of bytes read at once, so that corrupt lengths cannot cause huge allocations.
+	static constexpr uint64_t chunkSize = uint64_t(1) << 20;
+
+	std::istream& m_is;
+
+	//! Reads \p count values into \p data, which only grows as far as the stream provides data.
+	template<typename T>
+	bool readValues(std::vector<T>& data, uint64_t count) {
+		const uint64_t valuesPerChunk = std::max<uint64_t>(chunkSize / sizeof(T), 1);
+		data.clear();
+		while (data.size() < count) {
+			const size_t old = data.size();
+			data.resize(old + std::min(valuesPerChunk, count - old));
+			if (!readBytes(reinterpret_cast<char*>(data.data() + old),
+						(data.size() - old) * sizeof(T))) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool readBytes(char* data, uint64_t length) {
+		m_is.read(data, length);
+		return static_cast<uint64_t>(m_is.gcount()) == length;
+	}
+
+	bool skip(uint64_t length) {
+		m_is.ignore(length);
+		return static_cast<uint64_t>(m_is.gcount()) == length;
+	}
+};
+
+bool writeBinaryGraph(const Graph& G, const GraphAttributes* GA, std::ostream& os) {
+	if (!os.good()) {
+		return false;
+	}
+
+	BinaryWriter writer(os);
+
+	FileHeader header;
+	std::memcpy(header.signature, signature, sizeof(signature));
+	header.byteOrderMark = byteOrderMark;
+	header.version = formatVersion;
+	header.flags = GA != nullptr && GA->directed() ? flagDirected : 0;
+	header.reserved = 0;
+	header.numberOfNodes = G.numberOfNodes();
+	header.numberOfEdges = G.numberOfEdges();
+	writer.write(header);
+
+	NodeArray<int32_t> index(G);
+	int32_t i = 0;
+	for (node v : G.nodes) {
+		index[v] = i++;
+	}
+	writer.writeEdgeBlock<EdgeRecord>(BlockType::Edges, G, [&](edge e) {
+		return EdgeRecord {index[e->source()], index[e->target()]};
+	});
+
+	if (GA != nullptr) {
+		if (GA->has(GraphAttributes::nodeGraphics)) {
+			writer.writeNodeBlock<double>(BlockType::NodeX, G, [&](node v) { return GA->x(v); });
+			writer.writeNodeBlock<double>(BlockType::NodeY, G, [&](node v) { return GA->y(v); });
+			if (GA->has(GraphAttributes::threeD)) {
+				writer.writeNodeBlock<double>(BlockType::NodeZ, G, [&](node v) { return GA->z(v); });
+			}
+			writer.writeNodeBlock<double>(BlockType::NodeWidth, G,
+					[&](node v) { return GA->width(v); });
+			writer.writeNodeBlock<double>(BlockType::NodeHeight, G,
+					[&](node v) { return GA->height(v); });
+			writer.writeNodeBlock<int32_t>(BlockType::NodeShape, G,
+					[&](node v) { return static_cast<int>(GA->shape(v)); });
+		}
+		if (GA->has(GraphAttributes::nodeWeight)) {
+			writer.writeNodeBlock<int32_t>(BlockType::NodeWeight, G,
+					[&](node v) { return GA->weight(v); });
+		}
+		if (GA->has(GraphAttributes::nodeLabel)) {
+			writer.writeStringBlock(BlockType::NodeLabel, G.nodes,
+					[&](node v) -> const string& { return GA->label(v); });
+		}
+		if (GA->has(GraphAttributes::edgeGraphics)) {
+			std::vector<uint64_t> offsets {0};
+			std::vector<double> coords;
+			for (edge e : G.edges) {
+				for (const DPoint& p : GA->bends(e)) {
+					coords.push_back(p.m_x);
+					coords.push_back(p.m_y);
+				}
+				offsets.push_back(coords.size());
+			}
+			writer.writeBlock(BlockType::EdgeBends, offsets, coords);
+		}
+		if (GA->has(GraphAttributes::edgeIntWeight)) {
+			writer.writeEdgeBlock<int32_t>(BlockType::EdgeIntWeight, G,
+					[&](edge e) { return GA->intWeight(e); });
+		}
+		if (GA->has(GraphAttributes::edgeDoubleWeight)) {
+			writer.writeEdgeBlock<double>(BlockType::EdgeDoubleWeight, G,
+					[&](edge e) { return GA->doubleWeight(e); });
+		}
+		if (GA->has(GraphAttributes::edgeLabel)) {
+			writer.writeStringBlock(BlockType::EdgeLabel, G.edges,
+					[&](edge e) -> const string& { return GA->label(e); });
+		}
+	}
+
+	writer.write(BlockHeader {static_cast<uint32_t>(BlockType::End), 0, 0});
+
+	return writer.good();
+}
+
+bool readBinaryGraph(Graph& G, GraphAttributes* GA, std::istream& is) {
+	if (!is.good()) {
+		return false;
+	}
+
+	BinaryReader reader(is);
+
+	FileHeader header;
+	if (!reader.read(header) || std::memcmp(header.signature, signature, sizeof(signature)) != 0
+			|| header.byteOrderMark != byteOrderMark || header.version == 0
+			|| header.version > formatVersion
+			|| header.numberOfNodes > uint64_t(std::numeric_limits<int>::max())
+			|| header.numberOfEdges > uint64_t(std::numeric_limits<int>::max())) {
+		return false;
+	}
+	const int n = static_cast<int>(header.numberOfNodes);
+	const int m = static_cast<int>(header.numberOfEdges);
+	if (uint64_t(m) * sizeof(EdgeRecord) > reader.bytesLeft()) {
+		return false;
+	}
+
+	// The graph is only built once a block has been read that refers to its nodes or edges,
+	// so a corrupt header cannot cause huge allocations before the payload is checked.
+	G.clear();
+	std::vector<node> nodes;
+	std::vector<edge> edges;
+	std::vector<EdgeRecord> records;
+	bool hasEdgeBlock = false;
+
+	auto buildNodes = [&] {
+		if (nodes.empty() && n > 0) {
+			G.reserveNodes(n);
+			nodes.resize(n);
+			for (node& v : nodes) {
+				v = G.newNode();
+			}
+		}
+	};
+	auto buildEdges = [&] {
+		buildNodes();
+		if (edges.empty() && m > 0) {
+			G.reserveEdges(m);
+			G.insertEdges(nodes, records.begin(), records.end());
+			records = std::vector<EdgeRecord>();
+			edges.reserve(m);
+			for (edge e : G.edges) {
+				edges.push_back(e);
+			}
+		}
+	};
+
+	if (GA != nullptr) {
+		GA->directed() = (header.flags & flagDirected) != 0;
+	}
+
+	auto has = [&](long attr) { return GA != nullptr && GA->has(attr); };
+
+	// assigns the values of data to the nodes / edges using assign
+	auto assignNodes = [&](const auto& data, auto assign) {
+		buildNodes();
+		for (int i = 0; i < n; ++i) {
+			assign(nodes[i], data[i]);
+		}
+	};
+	auto assignEdges = [&](const auto& data, auto assign) {
+		buildEdges();
+		for (int i = 0; i < m; ++i) {
+			assign(edges[i], data[i]);
+		}
+	};
+
+	std::vector<double> doubles;
+	std::vector<int32_t> ints;
+	std::vector<uint64_t> offsets;
+	std::vector<char> chars;
+
+	for (;;) {
+		BlockHeader block;
+		if (!reader.read(block)) {
+			return false;
+		}
+
+		bool ok = true;
+		switch (static_cast<BlockType>(block.type)) {
+		case BlockType::End:
+			if (!hasEdgeBlock && m > 0) {
+				return false;
+			}
+			buildEdges();
+			return true;
+
+		case BlockType::Edges:
+			if (hasEdgeBlock || !reader.readArray(records, block.length, m)) {
+				return false;
+			}
+			for (const EdgeRecord& r : records) {
+				if (r.first < 0 || r.first >= n || r.second < 0 || r.second >= n) {
+					return false;
+				}
+			}
+			hasEdgeBlock = true;
+			break;
+
+		case BlockType::NodeX:
+		case BlockType::NodeY:
+		case BlockType::NodeZ:
+		case BlockType::NodeWidth:
+		case BlockType::NodeHeight:
+			if (!has(GraphAttributes::nodeGraphics)
+					|| (block.type == uint32_t(BlockType::NodeZ) && !has(GraphAttributes::threeD))) {
+				ok = reader.skipBlock(block.length);
+			} else if ((ok = reader.readArray(doubles, block.length, n))) {
+				switch (static_cast<BlockType>(block.type)) {
+				case BlockType::NodeX:
+					assignNodes(doubles, [&](node v, double x) { GA->x(v) = x; });
+					break;
+				case BlockType::NodeY:
+					assignNodes(doubles, [&](node v, double y) { GA->y(v) = y; });
+					break;
+				case BlockType::NodeZ:
+					assignNodes(doubles, [&](node v, double z) { GA->z(v) = z; });
+					break;
+				case BlockType::NodeWidth:
+					assignNodes(doubles, [&](node v, double w) { GA->width(v) = w; });
+					break;
+				default:
+					assignNodes(doubles, [&](node v, double h) { GA->height(v) = h; });
+					break;
+				}
+			}
+			break;
+
+		case BlockType::NodeShape:
+			if (!has(GraphAttributes::nodeGraphics)) {
+				ok = reader.skipBlock(block.length);
+			} else if ((ok = reader.readArray(ints, block.length, n))) {
+				assignNodes(ints, [&](node v, int s) { GA->shape(v) = static_cast<Shape>(s); });
+			}
+			break;
+
+		case BlockType::NodeWeight:
+			if (!has(GraphAttributes::nodeWeight)) {
+				ok = reader.skipBlock(block.length);
+			} else if ((ok = reader.readArray(ints, block.length, n))) {
+				assignNodes(ints, [&](node v, int w) { GA->weight(v) = w; });
+			}
+			break;
+
+		case BlockType::NodeLabel:
+			if (!has(GraphAttributes::nodeLabel)) {
+				ok = reader.skipBlock(block.length);
+			} else if ((ok = reader.readArray(offsets, chars, block.length, n))) {
+				buildNodes();
+				for (int i = 0; i < n; ++i) {
+					GA->label(nodes[i]).assign(chars.data() + offsets[i], offsets[i + 1] - offsets[i]);
+				}
+			}
+			break;
+
+		case BlockType::EdgeBends:
+			if (!has(GraphAttributes::edgeGraphics)) {
+				ok = reader.skipBlock(block.length);
+			} else if (!hasEdgeBlock) {
+				ok = false;
+			} else if ((ok = reader.readArray(offsets, doubles, block.length, m))) {
+				buildEdges();
+				for (int i = 0; i < m; ++i) {
+					if ((offsets[i + 1] - offsets[i]) % 2 != 0) {
+						return false;
+					}
+					DPolyline& bends = GA->bends(edges[i]);
+					bends.clear();
+					for (uint64_t j = offsets[i]; j < offsets[i + 1]; j += 2) {
+						bends.pushBack(DPoint(doubles[j], doubles[j + 1]));
+					}
+				}
+			}
+			break;
+
+		case BlockType::EdgeIntWeight:
+			if (!has(GraphAttributes::edgeIntWeight)) {
+				ok = reader.skipBlock(block.length);
+			} else if (!hasEdgeBlock) {
+				ok = false;
+			} else if ((ok = reader.readArray(ints, block.length, m))) {
+				assignEdges(ints, [&](edge e, int w) { GA->intWeight(e) = w; });
+			}
+			break;
+
+		case BlockType::EdgeDoubleWeight:
+			if (!has(GraphAttributes::edgeDoubleWeight)) {
+				ok = reader.skipBlock(block.length);
+			} else if (!hasEdgeBlock) {
+				ok = false;
+			} else if ((ok = reader.readArray(doubles, block.length, m))) {
+				assignEdges(doubles, [&](edge e, double w) { GA->doubleWeight(e) = w; });
+			}
+			break;
+
+		case BlockType::EdgeLabel:
+			if (!has(GraphAttributes::edgeLabel)) {
+				ok = reader.skipBlock(block.length);
+			} else if (!hasEdgeBlock) {
+				ok = false;
+			} else if ((ok = reader.readArray(offsets, chars, block.length, m))) {
+				buildEdges();
+				for (int i = 0; i < m; ++i) {
+					GA->label(edges[i]).assign(chars.data() + offsets[i], offsets[i + 1] - offsets[i]);
+				}
+			}
+			break;
+
+		default:
+			// blocks of unknown type are written by newer versions and can be ignored
+			ok = reader.skipBlock(block.length);
+			break;
+		}
+
+		if (!ok) {
+			return false;
+		}
+	}
+}
+
+}
+
+bool GraphIO::readBinary(Graph& G, std::istream& is) {
+	return readBinaryGraph(G, nullptr, is);
+}
+
+bool GraphIO::readBinary(GraphAttributes& GA, Graph& G, std::istream& is) {
+	return readBinaryGraph(G, &GA, is);
+}
+
+bool GraphIO::writeBinary(const Graph& G, std::ostream& os) {
+	return writeBinaryGraph(G, nullptr, os);
+}
+
+bool GraphIO::writeBinary(const GraphAttributes& GA, std::ostream& os) {
+	return writeBinaryGraph(GA.constGraph(), &GA, os);
+}
+
+}
@@ -0,0 +1,425 @@
+/** \file
+ * \brief Implements read and write functionality for plain edge lists.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/Math.h>
+#include <ogdf/basic/ThreadPool.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/fileformats/GraphIO.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if defined(OGDF_SYSTEM_WINDOWS)
+#	define WIN32_EXTRA_LEAN
+#	define WIN32_LEAN_AND_MEAN
+#	undef NOMINMAX
+#	define NOMINMAX
+#	include <windows.h>
+#elif defined(OGDF_SYSTEM_UNIX)
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#else
+#	include <fstream>
+#	include <iterator>
+#endif
+
+namespace ogdf {
+
+namespace {
+
+//! Read-only view of the contents of a file, memory-mapped if the system supports it.
+class MappedFile {
+public:
+	explicit MappedFile(const string& filename);
+
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	//! Returns true if the file could be opened.
+	bool good() const { return m_good; }
+
+	const char* begin() const { return m_data; }
+
+	const char* end() const { return m_data + m_size; }
+
+private:
+	const char* m_data = nullptr;
+	size_t m_size = 0;
+	bool m_good = false;
+
+#if defined(OGDF_SYSTEM_WINDOWS)
+	HANDLE m_file = INVALID_HANDLE_VALUE;
+	HANDLE m_mapping = nullptr;
+#elif !defined(OGDF_SYSTEM_UNIX)
+	string m_buffer;
+#endif
+};
+
+#if defined(OGDF_SYSTEM_WINDOWS)
+MappedFile::MappedFile(const string& filename) {
+	m_file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	LARGE_INTEGER size;
+	if (m_file == INVALID_HANDLE_VALUE || !GetFileSizeEx(m_file, &size)) {
+		return;
+	}
+	m_size = static_cast<size_t>(size.QuadPart);
+	if (m_size > 0) {
+		m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (m_mapping == nullptr) {
+			return;
+		}
+		m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+		if (m_data == nullptr) {
+			return;
+		}
+	}
+	m_good = true;
+}
+
+MappedFile::~MappedFile() {
+	if (m_data != nullptr) {
+		UnmapViewOfFile(m_data);
+	}
+	if (m_mapping != nullptr) {
+		CloseHandle(m_mapping);
+	}
+	if (m_file != INVALID_HANDLE_VALUE) {
+		CloseHandle(m_file);
+	}
+}
+#elif defined(OGDF_SYSTEM_UNIX)
+MappedFile::MappedFile(const string& filename) {
+	int fd = open(filename.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return;
+	}
+	struct stat info;
+	if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+		m_size = static_cast<size_t>(info.st_size);
+		if (m_size == 0) {
+			m_good = true;
+		} else {
+			void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (data != MAP_FAILED) {
+				posix_madvise(data, m_size, POSIX_MADV_SEQUENTIAL);
+				m_data = static_cast<const char*>(data);
+				m_good = true;
+			}
+		}
+	}
+	close(fd);
+}
+
+MappedFile::~MappedFile() {
+	if (m_data != nullptr) {
+		munmap(const_cast<char*>(m_data), m_size);
+	}
+}
+#else
+MappedFile::MappedFile(const string& filename) {
+	std::ifstream is(filename, std::ios::binary);
+	if (is.good()) {
+		m_buffer.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+		m_data = m_buffer.data();
+		m_size = m_buffer.size();
+		m_good = !is.bad();
+	}
+}
+
+MappedFile::~MappedFile() { }
+#endif
+
+//! Kinds of lines of an edge list.
+enum class LineType { Blank, NodeCount, Edge, Invalid };
+
+//! Parses the line [\p first, \p last) of an edge list.
+/**
+ * For an edge line, the indices of its end nodes are assigned to \p u and \p v.
+ * For a comment specifying the number of nodes, this number is assigned to \p u.
+ * Lines implying more than \p maxNodes nodes are invalid.
+ */
+LineType parseLine(const char* first, const char* last, int maxNodes, int& u, int& v) {
+	auto isBlank = [](char c) { return c == ' ' || c == '\t' || c == '\r' || c == ','; };
+	auto skipBlanks = [&] {
+		while (first != last && isBlank(*first)) {
+			++first;
+		}
+	};
+	auto readIndex = [&](int& x) {
+		auto result = std::from_chars(first, last, x);
+		if (result.ec != std::errc() || x < 0 || x == std::numeric_limits<int>::max()
+				|| (result.ptr != last && !isBlank(*result.ptr))) {
+			return false;
+		}
+		first = result.ptr;
+		return true;
+	};
+
+	skipBlanks();
+	if (first == last) {
+		return LineType::Blank;
+	}
+
+	if (*first == '#' || *first == '%') {
+		static const char tag[] = "Nodes:";
+		first = std::search(first, last, tag, tag + sizeof(tag) - 1);
+		if (first == last) {
+			return LineType::Blank;
+		}
+		first += sizeof(tag) - 1;
+		skipBlanks();
+		if (!readIndex(u)) {
+			return LineType::Blank;
+		}
+		return u <= maxNodes ? LineType::NodeCount : LineType::Invalid;
+	}
+
+	if (!readIndex(u) || u >= maxNodes) {
+		return LineType::Invalid;
+	}
+	skipBlanks();
+	return readIndex(v) && v < maxNodes ? LineType::Edge : LineType::Invalid;
+}
+
+//! Returns the end of the line starting at \p first (i.e., the next newline or \p last).
+inline const char* endOfLine(const char* first, const char* last) {
+	const void* eol = std::memchr(first, '\n', last - first);
+	return eol == nullptr ? last : static_cast<const char*>(eol);
+}
+
+//! Returns the start of the line following the line ending at \p eol.
+inline const char* nextLine(const char* eol, const char* last) {
+	return eol == last ? last : eol + 1;
+}
+
+//! Adds the nodes and edges of an edge list to a graph while it is parsed.
+class EdgeListBuilder {
+public:
+	explicit EdgeListBuilder(Graph& G) : m_G(G), m_maxNodes(GraphIO::maxEdgeListNodes()) { }
+
+	//! Processes the line [\p first, \p last) and returns false iff it is invalid.
+	bool processLine(const char* first, const char* last) {
+		int u = 0, v = 0;
+		switch (parseLine(first, last, m_maxNodes, u, v)) {
+		case LineType::Invalid:
+			return false;
+		case LineType::NodeCount:
+			m_G.reserveNodes(u - static_cast<int>(m_nodes.size()));
+			ensureNodes(u);
+			break;
+		case LineType::Edge:
+			ensureNodes(std::max(u, v) + 1);
+			m_G.newEdge(m_nodes[u], m_nodes[v]);
+			break;
+		case LineType::Blank:
+			break;
+		}
+		return true;
+	}
+
+	//! Makes sure that the graph has at least \p n nodes.
+	void ensureNodes(int n) {
+		while (static_cast<int>(m_nodes.size()) < n) {
+			m_nodes.push_back(m_G.newNode());
+		}
+	}
+
+private:
+	Graph& m_G;
+	const int m_maxNodes;
+	std::vector<node> m_nodes;
+};
+
+//! The edges of a range of lines of an edge list, parsed by a single thread.
+struct EdgeListChunk {
+	const char* begin = nullptr;
+	const char* end = nullptr;
+	std::vector<std::pair<int, int>> edges; //!< source and target index of every edge
+	int numberOfNodes = 0; //!< lower bound on the number of nodes implied by the range
+	bool valid = true;
+
+	void parse(int maxNodes) {
+		edges.reserve(std::count(begin, end, '\n') + 1);
+		for (const char* line = begin; line < end;) {
+			const char* eol = endOfLine(line, end);
+			int u = 0, v = 0;
+			switch (parseLine(line, eol, maxNodes, u, v)) {
+			case LineType::Invalid:
+				valid = false;
+				return;
+			case LineType::NodeCount:
+				Math::updateMax(numberOfNodes, u);
+				break;
+			case LineType::Edge:
+				edges.emplace_back(u, v);
+				Math::updateMax(numberOfNodes, std::max(u, v) + 1);
+				break;
+			case LineType::Blank:
+				break;
+			}
+			line = nextLine(eol, end);
+		}
+	}
+};
+
+bool readEdgeListInParallel(Graph& G, const char* begin, const char* end, unsigned int numChunks,
+		unsigned int numThreads) {
+	// split the file into ranges of complete lines
+	std::vector<EdgeListChunk> chunks(numChunks);
+	const size_t size = end - begin;
+	const char* first = begin;
+	for (unsigned int i = 0; i < numChunks; ++i) {
+		const char* last = end;
+		if (i + 1 < numChunks) {
+			last = std::max(first, begin + size * (i + 1) / numChunks);
+			last = nextLine(endOfLine(last, end), end);
+		}
+		chunks[i].begin = first;
+		chunks[i].end = last;
+		first = last;
+	}
+
+	const int maxNodes = GraphIO::maxEdgeListNodes();
+	ThreadPool::global().parallelFor(0, static_cast<int>(numChunks), numThreads,
+			[&](int i) { chunks[i].parse(maxNodes); });
+
+	int n = 0;
+	for (const EdgeListChunk& chunk : chunks) {
+		if (!chunk.valid) {
+			return false;
+		}
+		Math::updateMax(n, chunk.numberOfNodes);
+	}
+
+	size_t m = 0;
+	for (const EdgeListChunk& chunk : chunks) {
+		m += chunk.edges.size();
+	}
+	G.reserveNodes(n);
+	G.reserveEdges(static_cast<int>(m));
+
+	std::vector<node> nodes(n);
+	for (node& v : nodes) {
+		v = G.newNode();
+	}
+	for (EdgeListChunk& chunk : chunks) {
+		G.insertEdges(nodes, chunk.edges.begin(), chunk.edges.end());
+		// release the memory as early as possible
+		std::vector<std::pair<int, int>>().swap(chunk.edges);
+	}
+
+	return true;
+}
+
+}
+
+bool GraphIO::readEdgeList(Graph& G, std::istream& is) {
+	if (!is.good()) {
+		return false;
+	}
+
+	G.clear();
+
+	EdgeListBuilder builder(G);
+	string buffer;
+	while (std::getline(is, buffer)) {
+		if (!builder.processLine(buffer.data(), buffer.data() + buffer.size())) {
+			return false;
+		}
+	}
+
+	return !is.bad();
+}
+
+bool GraphIO::readEdgeList(Graph& G, const string& filename, unsigned int numThreads) {
+	MappedFile file(filename);
+	if (!file.good()) {
+		return false;
+	}
+
+	G.clear();
+
+	// do not bother splitting tiny files
+	const size_t minChunkSize = 1 << 16;
+	size_t size = file.end() - file.begin();
+	const unsigned int numChunks = static_cast<unsigned int>(
+			std::min<size_t>(std::max(numThreads, 1u), std::max<size_t>(size / minChunkSize, 1)));
+
+	if (numChunks > 1) {
+		return readEdgeListInParallel(G, file.begin(), file.end(), numChunks, numThreads);
+	}
+
+	EdgeListBuilder builder(G);
+	for (const char* line = file.begin(); line < file.end();) {
+		const char* eol = endOfLine(line, file.end());
+		if (!builder.processLine(line, eol)) {
+			return false;
+		}
+		line = nextLine(eol, file.end());
+	}
+
+	return true;
+}
+
+bool GraphIO::writeEdgeList(const Graph& G, std::ostream& os) {
+	if (!os.good()) {
+		return false;
+	}
+
+	os << "# Nodes: " << G.numberOfNodes() << " Edges: " << G.numberOfEdges() << "\n";
+
+	NodeArray<int> index(G);
+	int i = 0;
+	for (node v : G.nodes) {
+		index[v] = i++;
+	}
+
+	for (edge e : G.edges) {
+		os << index[e->source()] << "\t" << index[e->target()] << "\n";
+	}
+
+	return os.good();
+}
+
+}
@@ -37,6 +37,8 @@
 #include <ogdf/basic/Stopwatch.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/graphalg/MaxFlowGoldbergTarjan.h>
+#include <ogdf/graphalg/MaxFlowModule.h>
+#include <ogdf/graphalg/MaxFlowParallelPushRelabel.h>
 #include <ogdf/graphalg/MaximumDensitySubgraph.h>
 #include <ogdf/graphalg/MinSTCutMaxFlow.h>
 
@@ -46,7 +48,7 @@
 namespace ogdf {
 
 bool maximumDensitySubgraph(Graph& G, NodeSet& subgraphNodes,
-		std::function<node(node)> resultNodeMap, int64_t timelimit) {
+		std::function<node(node)> resultNodeMap, int64_t timelimit, unsigned int maxThreads) {
 	StopwatchCPU watch;
 	watch.start();
 
@@ -106,8 +108,15 @@ bool maximumDensitySubgraph(Graph& G, NodeSet& subgraphNodes,
 			OGDF_ASSERT(weights[e] >= 0);
 		}
 
-		MinSTCutMaxFlow<double> mstc(true, new MaxFlowGoldbergTarjan<double>(), true, false,
-				new EpsilonTest());
+		MaxFlowModule<double>* maxFlow;
+		if (maxThreads > 1) {
+			auto parallelMaxFlow = new MaxFlowParallelPushRelabel<double>();
+			parallelMaxFlow->maxThreads(maxThreads);
+			maxFlow = parallelMaxFlow;
+		} else {
+			maxFlow = new MaxFlowGoldbergTarjan<double>();
+		}
+		MinSTCutMaxFlow<double> mstc(true, maxFlow, true, false, new EpsilonTest());
 
 		List<edge> cutEdges;
 		mstc.call(G, weights, s, t, cutEdges);
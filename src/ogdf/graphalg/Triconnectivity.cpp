@@ -69,7 +69,6 @@ Triconnectivity::Triconnectivity(Graph* G)
 	std::cout << "n = " << n << ", m = " << m << std::endl << std::endl;
 #endif
 
-	m_component = Array<CompStruct>(3 * m - 6);
 	m_numComp = 0;
 
 	// special cases
@@ -102,7 +101,7 @@ Triconnectivity::Triconnectivity(Graph* G)
 	m_numCount = 0;
 	m_start = m_pG->firstNode();
 	node dummy;
-	DFS1(m_start, nullptr, dummy);
+	DFS1(m_start, dummy);
 
 	for (edge e : m_pG->edges) {
 		bool up = (m_NUMBER[e->target()] - m_NUMBER[e->source()] > 0);
@@ -124,16 +123,16 @@ Triconnectivity::Triconnectivity(Graph* G)
 	}
 #endif
 
-	m_A.init(*m_pG);
-	m_IN_ADJ.init(*m_pG, nullptr);
+	m_A.init(*m_pG, -1);
+	m_IN_ADJ.init(*m_pG, -1);
 	buildAcceptableAdjStruct();
 
 #ifdef OGDF_TRICONNECTIVITY_OUTPUT
 	std::cout << "\nadjaceny lists:" << std::endl;
 	for (node v : m_pG->nodes) {
 		std::cout << v << "\t";
-		for (edge ei : m_A[v]) {
-			printOs(ei);
+		for (int i = m_A[v]; i >= 0; i = m_adjSlots[i].next) {
+			printOs(m_adjSlots[i].e);
 		}
 		std::cout << std::endl;
 	}
@@ -146,8 +145,8 @@ Triconnectivity::Triconnectivity(Graph* G)
 	for (node v : m_pG->nodes) {
 		std::cout << GCoriginal(v) << ":  \t" << m_NEWNUM[v] << "   \t";
 		std::cout << m_LOWPT1[v] << "   \t" << m_LOWPT2[v] << "   \t";
-		for (int i : m_HIGHPT[v]) {
-			std::cout << i << " ";
+		for (int i = m_HIGHPT[v]; i >= 0; i = m_highItems[i].next) {
+			std::cout << m_highItems[i].value << " ";
 		}
 		std::cout << std::endl;
 	}
@@ -229,8 +228,11 @@ void Triconnectivity::clearStructures() {
 	m_ND.init();
 	m_TYPE.init();
 	m_A.init();
+	m_adjSlots.init();
 	m_NEWNUM.init();
 	m_HIGHPT.init();
+	m_highItems.clear();
+	m_highItems.shrink_to_fit();
 	m_START.init();
 	m_DEGREE.init();
 	m_TREE_ARC.init();
@@ -276,7 +278,7 @@ Triconnectivity::Triconnectivity(const Graph& G, bool& isTric, node& s1, node& s
 
 	m_numCount = 0;
 	m_start = m_pG->firstNode();
-	DFS1(m_start, nullptr, s1);
+	DFS1(m_start, s1);
 
 	// graph not even connected?
 	if (m_numCount < n) {
@@ -299,8 +301,8 @@ Triconnectivity::Triconnectivity(const Graph& G, bool& isTric, node& s1, node& s
 		}
 	}
 
-	m_A.init(*m_pG);
-	m_IN_ADJ.init(*m_pG, nullptr);
+	m_A.init(*m_pG, -1);
+	m_IN_ADJ.init(*m_pG, -1);
 	buildAcceptableAdjStruct();
 
 	DFS2();
@@ -322,6 +324,26 @@ Triconnectivity::Triconnectivity(const Graph& G, bool& isTric, node& s1, node& s
 // Splits bundles of multi-edges into bonds and creates
 // a new virtual edge in GC.
 void Triconnectivity::splitMultiEdges() {
+	// most inputs are simple, which can be checked without sorting all edges
+	NodeArray<node> neighborOf(*m_pG, nullptr);
+	bool parallelFree = true;
+	for (node v : m_pG->nodes) {
+		for (adjEntry adj : v->adjEntries) {
+			node w = adj->twinNode();
+			if (neighborOf[w] == v) {
+				parallelFree = false;
+				break;
+			}
+			neighborOf[w] = v;
+		}
+		if (!parallelFree) {
+			break;
+		}
+	}
+	if (parallelFree) {
+		return;
+	}
+
 	SListPure<edge> edges;
 	EdgeArray<int> minIndex(*m_pG), maxIndex(*m_pG);
 	parallelFreeSortUndirected(*m_pG, edges, minIndex, maxIndex);
@@ -567,37 +589,43 @@ void Triconnectivity::assembleTriconnectedComponents() {
 // The first dfs-search
 //  computes NUMBER[v], FATHER[v], LOWPT1[v], LOWPT2[v],
 //           ND[v], TYPE[e], DEGREE[v]
-void Triconnectivity::DFS1(node v, node u, node& s1) {
-	node firstSon = nullptr;
+void Triconnectivity::DFS1(node root, node& s1) {
+	struct Frame {
+		node v;
+		adjEntry adj; // next adjacency entry to be processed
+		node firstSon;
+	};
+	std::vector<Frame> stack;
 
-	m_NUMBER[v] = ++m_numCount;
-	m_FATHER[v] = u;
-	m_DEGREE[v] = v->degree();
+	auto discover = [&](node v, node u) {
+		m_NUMBER[v] = ++m_numCount;
+		m_FATHER[v] = u;
+		m_DEGREE[v] = v->degree();
 
-	m_LOWPT1[v] = m_LOWPT2[v] = m_NUMBER[v];
-	m_ND[v] = 1;
+		m_LOWPT1[v] = m_LOWPT2[v] = m_NUMBER[v];
+		m_ND[v] = 1;
 
-	for (adjEntry adj : v->adjEntries) {
-		edge e = adj->theEdge();
+		stack.push_back({v, v->firstAdj(), nullptr});
+	};
 
-		if (m_TYPE[e] != EdgeType::unseen) {
-			continue;
-		}
+	discover(root, nullptr);
 
-		node w = e->opposite(v);
+	while (!stack.empty()) {
+		Frame& f = stack.back();
+		node v = f.v;
 
-		if (m_NUMBER[w] == 0) {
-			m_TYPE[e] = EdgeType::tree;
-			if (firstSon == nullptr) {
-				firstSon = w;
+		if (f.adj == nullptr) {
+			// v is finished, continue with the tree arc (u,v) at its father u
+			stack.pop_back();
+			if (stack.empty()) {
+				break;
 			}
-
-			m_TREE_ARC[w] = e;
-
-			DFS1(w, v, s1);
+			node w = v;
+			v = stack.back().v;
+			node u = m_FATHER[v];
 
 			// check for cut vertex
-			if (m_LOWPT1[w] >= m_NUMBER[v] && (w != firstSon || u != nullptr)) {
+			if (m_LOWPT1[w] >= m_NUMBER[v] && (w != stack.back().firstSon || u != nullptr)) {
 				s1 = v;
 			}
 
@@ -613,6 +641,27 @@ void Triconnectivity::DFS1(node v, node u, node& s1) {
 			}
 
 			m_ND[v] += m_ND[w];
+			continue;
+		}
+
+		edge e = f.adj->theEdge();
+		f.adj = f.adj->succ();
+
+		if (m_TYPE[e] != EdgeType::unseen) {
+			continue;
+		}
+
+		node w = e->opposite(v);
+
+		if (m_NUMBER[w] == 0) {
+			m_TYPE[e] = EdgeType::tree;
+			if (f.firstSon == nullptr) {
+				f.firstSon = w;
+			}
+
+			m_TREE_ARC[w] = e;
+
+			discover(w, v);
 
 		} else {
 			m_TYPE[e] = EdgeType::frond;
@@ -630,34 +679,77 @@ void Triconnectivity::DFS1(node v, node u, node& s1) {
 
 // Construction of ordered adjaceny lists
 void Triconnectivity::buildAcceptableAdjStruct() {
-	int max = 3 * m_pG->numberOfNodes() + 2;
-	Array<List<edge>> BUCKET(1, max);
-
-	for (edge e : m_pG->edges) {
-		EdgeType t = m_TYPE[e];
-		if (t == EdgeType::removed) {
-			continue;
-		}
+	const int max = 3 * m_pG->numberOfNodes() + 2;
 
+	auto phi = [&](edge e) {
 		node w = e->target();
-		int phi = (t == EdgeType::frond)
+		return (m_TYPE[e] == EdgeType::frond)
 				? 3 * m_NUMBER[w] + 1
 				: ((m_LOWPT2[w] < m_NUMBER[e->source()]) ? 3 * m_LOWPT1[w] : 3 * m_LOWPT1[w] + 2);
-		BUCKET[phi].pushBack(e);
+	};
+
+	// stable bucket sort of the edges by phi; the sorted edges are the slots
+	Array<int> bucketStart(1, max + 1, 0);
+	int numSlots = 0;
+	for (edge e : m_pG->edges) {
+		if (m_TYPE[e] != EdgeType::removed) {
+			++bucketStart[phi(e) + 1];
+			++numSlots;
+		}
+	}
+	for (int i = 2; i <= max + 1; i++) {
+		bucketStart[i] += bucketStart[i - 1];
 	}
 
-	for (int i = 1; i <= max; i++) {
-		for (edge e : BUCKET[i]) {
-			m_IN_ADJ[e] = m_A[e->source()].pushBack(e);
+	m_adjSlots.init(numSlots);
+	for (edge e : m_pG->edges) {
+		if (m_TYPE[e] != EdgeType::removed) {
+			m_adjSlots[bucketStart[phi(e)]++].e = e;
 		}
 	}
+
+	// append the slots to the adjacency lists of their sources
+	NodeArray<int> last(*m_pG, -1);
+	for (int i = 0; i < numSlots; i++) {
+		AdjSlot& slot = m_adjSlots[i];
+		node v = slot.e->source();
+		slot.prev = last[v];
+		slot.next = -1;
+		if (last[v] >= 0) {
+			m_adjSlots[last[v]].next = i;
+		} else {
+			m_A[v] = i;
+		}
+		last[v] = i;
+		m_IN_ADJ[slot.e] = i;
+	}
 }
 
 // The second dfs-search
-void Triconnectivity::pathFinder(node v) {
-	m_NEWNUM[v] = m_numCount - m_ND[v] + 1;
+void Triconnectivity::pathFinder(node root) {
+	// last item of the HIGHPT list of each node
+	NodeArray<int> lastHigh(*m_pG, -1);
+
+	// pairs of a node and the next slot in its adjacency list
+	std::vector<std::pair<node, int>> stack;
 
-	for (edge e : m_A[v]) {
+	m_NEWNUM[root] = m_numCount - m_ND[root] + 1;
+	stack.emplace_back(root, m_A[root]);
+
+	while (!stack.empty()) {
+		const node v = stack.back().first;
+		int& slot = stack.back().second;
+
+		if (slot < 0) {
+			stack.pop_back();
+			if (!stack.empty()) {
+				m_numCount--;
+			}
+			continue;
+		}
+
+		edge e = m_adjSlots[slot].e;
+		slot = m_adjSlots[slot].next;
 		node w = e->opposite(v);
 
 		if (m_newPath) {
@@ -666,11 +758,19 @@ void Triconnectivity::pathFinder(node v) {
 		}
 
 		if (m_TYPE[e] == EdgeType::tree) {
-			pathFinder(w);
-			m_numCount--;
+			m_NEWNUM[w] = m_numCount - m_ND[w] + 1;
+			stack.emplace_back(w, m_A[w]);
 
 		} else {
-			m_IN_HIGH[e] = m_HIGHPT[w].pushBack(m_NEWNUM[v]);
+			int i = static_cast<int>(m_highItems.size());
+			m_highItems.push_back({m_NEWNUM[v], lastHigh[w], -1});
+			if (lastHigh[w] >= 0) {
+				m_highItems[lastHigh[w]].next = i;
+			} else {
+				m_HIGHPT[w] = i;
+			}
+			lastHigh[w] = i;
+			m_IN_HIGH[e] = i;
 			m_newPath = true;
 		}
 	}
@@ -678,8 +778,10 @@ void Triconnectivity::pathFinder(node v) {
 
 void Triconnectivity::DFS2() {
 	m_NEWNUM.init(*m_pG, 0);
-	m_HIGHPT.init(*m_pG);
-	m_IN_HIGH.init(*m_pG, ListIterator<int>());
+	m_HIGHPT.init(*m_pG, -1);
+	m_highItems.clear();
+	m_highItems.reserve(m_pG->numberOfEdges());
+	m_IN_HIGH.init(*m_pG, -1);
 	m_START.init(*m_pG, false);
 
 	m_numCount = m_pG->numberOfNodes();
@@ -705,39 +807,38 @@ struct StackEntry {
 	const int vnum;
 	int outv;
 
-	ListIterator<edge> it;
-	ListIterator<edge> itNext;
+	int slot;
+	int slotNext;
 	edge e;
 	node w;
 	int wnum;
 
 	bool after;
 
-	StackEntry(node p_v, int p_vnum, int p_outv, const ListIterator<edge>& p_it, edge p_e, node p_w,
+	StackEntry(node p_v, int p_vnum, int p_outv, int p_slot, int p_slotNext, edge p_e, node p_w,
 			int p_wnum, bool p_after = false)
 		: v(p_v)
 		, vnum(p_vnum)
 		, outv(p_outv)
-		, it(p_it)
-		, itNext()
+		, slot(p_slot)
+		, slotNext(p_slotNext)
 		, e(p_e)
 		, w(p_w)
 		, wnum(p_wnum)
-		, after(p_after) {
-		if (it.valid()) {
-			itNext = it.succ();
-		}
-	}
+		, after(p_after) { }
 };
 
 // recognition of split components
 bool Triconnectivity::pathSearch(node init_v, bool fail_fast, node& s1, node& s2) {
 	std::vector<StackEntry> stack;
-	{
-		auto it = m_A[init_v].begin();
-		node w = (*it)->target();
-		stack.emplace_back(init_v, m_NEWNUM[init_v], m_A[init_v].size(), it, *it, w, m_NEWNUM[w]);
-	}
+	auto push = [&](node v) {
+		int slot = m_A[v];
+		edge e = m_adjSlots[slot].e;
+		node w = e->target();
+		stack.emplace_back(v, m_NEWNUM[v], adjSize(v), slot, m_adjSlots[slot].next, e, w,
+				m_NEWNUM[w]);
+	};
+	push(init_v);
 
 	while (!stack.empty()) {
 		StackEntry& se = stack.back();
@@ -757,11 +858,7 @@ bool Triconnectivity::pathSearch(node init_v, bool fail_fast, node& s1, node& s2
 			}
 
 			se.after = true;
-			{
-				auto it = m_A[se.w].begin();
-				node w = (*it)->target();
-				stack.emplace_back(se.w, m_NEWNUM[se.w], m_A[se.w].size(), it, *it, w, m_NEWNUM[w]);
-			}
+			push(se.w);
 			continue;
 		} else if (se.after) {
 			if (fail_fast) {
@@ -769,7 +866,7 @@ bool Triconnectivity::pathSearch(node init_v, bool fail_fast, node& s1, node& s2
 					return false;
 				}
 			} else {
-				afterRecursivePathSearch(se.v, se.vnum, se.outv, se.it, se.e, se.w, se.wnum);
+				afterRecursivePathSearch(se.v, se.vnum, se.outv, se.slot, se.e, se.w, se.wnum);
 			}
 			se.outv--;
 			se.after = false;
@@ -791,10 +888,10 @@ bool Triconnectivity::pathSearch(node init_v, bool fail_fast, node& s1, node& s2
 			m_ESTACK.push(se.e); // add (v,w) to ESTACK
 		}
 
-		se.it = se.itNext;
-		if (se.it.valid()) {
-			se.itNext = se.it.succ();
-			se.e = *se.it;
+		se.slot = se.slotNext;
+		if (se.slot >= 0) {
+			se.slotNext = m_adjSlots[se.slot].next;
+			se.e = m_adjSlots[se.slot].e;
 			se.w = se.e->target();
 			se.wnum = m_NEWNUM[se.w];
 		} else {
@@ -806,14 +903,14 @@ bool Triconnectivity::pathSearch(node init_v, bool fail_fast, node& s1, node& s2
 }
 
 void Triconnectivity::afterRecursivePathSearch(const node v, const int vnum, const int outv,
-		const ListIterator<edge> it, const edge e, node w, int wnum) {
+		const int slot, const edge e, node w, int wnum) {
 	m_ESTACK.push(m_TREE_ARC[w]); // add (v,w) to ESTACK (can differ from e!)
 
 	node x;
 
 	while (vnum != 1
 			&& ((m_TSTACK_a[m_top] == vnum)
-					|| (m_DEGREE[w] == 2 && m_NEWNUM[m_A[w].front()->target()] > wnum))) {
+					|| (m_DEGREE[w] == 2 && m_NEWNUM[firstAdj(w)->target()] > wnum))) {
 		int a = m_TSTACK_a[m_top];
 		int b = m_TSTACK_b[m_top];
 
@@ -826,16 +923,16 @@ void Triconnectivity::afterRecursivePathSearch(const node v, const int vnum, con
 		else {
 			edge e_ab = nullptr;
 
-			if (m_DEGREE[w] == 2 && m_NEWNUM[m_A[w].front()->target()] > wnum) {
+			if (m_DEGREE[w] == 2 && m_NEWNUM[firstAdj(w)->target()] > wnum) {
 #ifdef OGDF_TRICONNECTIVITY_OUTPUT
 				std::cout << std::endl
 						  << "\nfound type-2 separation pair " << GCoriginal(v) << ", "
-						  << GCoriginal(m_A[w].front()->target());
+						  << GCoriginal(firstAdj(w)->target());
 #endif
 
 				edge e1 = m_ESTACK.popRet();
 				edge e2 = m_ESTACK.popRet();
-				m_A[w].del(m_IN_ADJ[e2]);
+				delAdj(w, m_IN_ADJ[e2]);
 
 				x = e2->target();
 
@@ -851,7 +948,7 @@ void Triconnectivity::afterRecursivePathSearch(const node v, const int vnum, con
 					e1 = m_ESTACK.top();
 					if (e1->source() == x && e1->target() == v) {
 						e_ab = m_ESTACK.popRet();
-						m_A[x].del(m_IN_ADJ[e_ab]);
+						delAdj(x, m_IN_ADJ[e_ab]);
 						delHigh(e_ab);
 					}
 				}
@@ -877,13 +974,13 @@ void Triconnectivity::afterRecursivePathSearch(const node v, const int vnum, con
 					if ((m_NEWNUM[x] == a && m_NEWNUM[xyTarget] == b)
 							|| (m_NEWNUM[xyTarget] == a && m_NEWNUM[x] == b)) {
 						e_ab = m_ESTACK.popRet();
-						m_A[e_ab->source()].del(m_IN_ADJ[e_ab]);
+						delAdj(e_ab->source(), m_IN_ADJ[e_ab]);
 						delHigh(e_ab);
 
 					} else {
 						edge eh = m_ESTACK.popRet();
-						if (it != m_IN_ADJ[eh]) {
-							m_A[eh->source()].del(m_IN_ADJ[eh]);
+						if (slot != m_IN_ADJ[eh]) {
+							delAdj(eh->source(), m_IN_ADJ[eh]);
 							delHigh(eh);
 						}
 						C << eh;
@@ -909,8 +1006,8 @@ void Triconnectivity::afterRecursivePathSearch(const node v, const int vnum, con
 			}
 
 			m_ESTACK.push(eVirt);
-			*it = eVirt;
-			m_IN_ADJ[eVirt] = it;
+			m_adjSlots[slot].e = eVirt;
+			m_IN_ADJ[eVirt] = slot;
 
 			m_DEGREE[x]++;
 			m_DEGREE[v]++;
@@ -953,8 +1050,8 @@ void Triconnectivity::afterRecursivePathSearch(const node v, const int vnum, con
 		if ((xx == vnum && y == m_LOWPT1[w]) || (y == vnum && xx == m_LOWPT1[w])) {
 			CompStruct& compBond = newComp(CompType::bond);
 			edge eh = m_ESTACK.popRet();
-			if (m_IN_ADJ[eh] != it) {
-				m_A[eh->source()].del(m_IN_ADJ[eh]);
+			if (m_IN_ADJ[eh] != slot) {
+				delAdj(eh->source(), m_IN_ADJ[eh]);
 			}
 			compBond << eh << eVirt;
 			eVirt = m_pG->newEdge(v, m_NODEAT[m_LOWPT1[w]]);
@@ -966,17 +1063,25 @@ void Triconnectivity::afterRecursivePathSearch(const node v, const int vnum, con
 
 		if (m_NODEAT[m_LOWPT1[w]] != m_FATHER[v]) {
 			m_ESTACK.push(eVirt);
-			*it = eVirt;
-			m_IN_ADJ[eVirt] = it;
-			if (!m_IN_HIGH[eVirt].valid() && high(m_NODEAT[m_LOWPT1[w]]) < vnum) {
-				m_IN_HIGH[eVirt] = m_HIGHPT[m_NODEAT[m_LOWPT1[w]]].pushFront(vnum);
+			m_adjSlots[slot].e = eVirt;
+			m_IN_ADJ[eVirt] = slot;
+			node lowpt1 = m_NODEAT[m_LOWPT1[w]];
+			if (m_IN_HIGH[eVirt] < 0 && high(lowpt1) < vnum) {
+				// push vnum to the front of HIGHPT(lowpt1)
+				int i = static_cast<int>(m_highItems.size());
+				m_highItems.push_back({vnum, -1, m_HIGHPT[lowpt1]});
+				if (m_HIGHPT[lowpt1] >= 0) {
+					m_highItems[m_HIGHPT[lowpt1]].prev = i;
+				}
+				m_HIGHPT[lowpt1] = i;
+				m_IN_HIGH[eVirt] = i;
 			}
 
 			m_DEGREE[v]++;
 			m_DEGREE[m_NODEAT[m_LOWPT1[w]]]++;
 
 		} else {
-			m_A[v].del(it);
+			delAdj(v, slot);
 
 			CompStruct& compBond = newComp(CompType::bond);
 			compBond << eVirt;
@@ -991,7 +1096,7 @@ void Triconnectivity::afterRecursivePathSearch(const node v, const int vnum, con
 			m_TYPE[eVirt] = EdgeType::tree;
 
 			m_IN_ADJ[eVirt] = m_IN_ADJ[eh];
-			*m_IN_ADJ[eh] = eVirt;
+			m_adjSlots[m_IN_ADJ[eh]].e = eVirt;
 		}
 	}
 
@@ -1011,16 +1116,16 @@ bool Triconnectivity::afterRecursivePathSearch(const node v, const int vnum, con
 		const edge e, const node w, const int wnum, node& s1, node& s2) {
 	while (vnum != 1
 			&& ((m_TSTACK_a[m_top] == vnum)
-					|| (m_DEGREE[w] == 2 && m_NEWNUM[m_A[w].front()->target()] > wnum))) {
+					|| (m_DEGREE[w] == 2 && m_NEWNUM[firstAdj(w)->target()] > wnum))) {
 		int a = m_TSTACK_a[m_top];
 		int b = m_TSTACK_b[m_top];
 
 		if (a == vnum && m_FATHER[m_NODEAT[b]] == m_NODEAT[a]) {
 			m_top--;
 
-		} else if (m_DEGREE[w] == 2 && m_NEWNUM[m_A[w].front()->target()] > wnum) {
+		} else if (m_DEGREE[w] == 2 && m_NEWNUM[firstAdj(w)->target()] > wnum) {
 			s1 = v;
-			s2 = m_A[w].front()->target();
+			s2 = firstAdj(w)->target();
 			return false;
 
 		} else {
@@ -31,6 +31,7 @@
 
 #include <ogdf/basic/Array.h>
 #include <ogdf/basic/Graph.h>
+#include <ogdf/basic/ThreadPool.h>
 #include <ogdf/layered/BarycenterHeuristic.h>
 #include <ogdf/layered/HierarchyLevels.h>
 #include <ogdf/layered/Level.h>
@@ -40,7 +41,8 @@ namespace ogdf {
 void BarycenterHeuristic::call(Level& L) {
 	const HierarchyLevels& levels = L.levels();
 
-	for (int i = 0; i <= L.high(); ++i) {
+	// weights of different nodes are independent of each other
+	auto computeWeight = [&](int i) {
 		node v = L[i];
 		long sumpos = 0L;
 
@@ -50,7 +52,9 @@ void BarycenterHeuristic::call(Level& L) {
 		}
 
 		m_weight[v] = (adjNodes.high() < 0) ? 0.0 : double(sumpos) / double(adjNodes.size());
-	}
+	};
+	ThreadPool::global().parallelFor(0, L.size(), numberOfThreads(), computeWeight,
+			s_minNodesPerThread);
 
 	L.sort(m_weight);
 }
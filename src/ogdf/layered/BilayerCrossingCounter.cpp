@@ -0,0 +1,148 @@
+/** \file
+ * \brief Implementation of class BilayerCrossingCounter.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphCopy.h>
+#include <ogdf/layered/BilayerCrossingCounter.h>
+#include <ogdf/layered/CrossingMinInterfaces.h>
+#include <ogdf/layered/Hierarchy.h>
+#include <ogdf/layered/HierarchyLevels.h>
+#include <ogdf/layered/Level.h>
+
+#include <algorithm>
+
+namespace ogdf {
+
+int BilayerCrossingCounter::count(const HierarchyLevelsBase& levels, int i) {
+	const LevelBase& L = levels[i];
+
+	m_targets.clear();
+	for (int j = 0; j < L.size(); ++j) {
+		for (node adjNode : levels.adjNodes(L[j], HierarchyLevelsBase::TraversingDir::upward)) {
+			m_targets.push(levels.pos(adjNode));
+		}
+	}
+
+	return countInversions(levels[i + 1].size());
+}
+
+int BilayerCrossingCounter::countSimDraw(const HierarchyLevels& levels, int i,
+		const EdgeArray<uint32_t>& edgeSubGraphs) {
+	const Level& L = levels[i];
+	const GraphCopy& GC = levels.hierarchy();
+
+	// Collect the edges in lexicographic order of the positions of their endpoints.
+	m_edges.clear();
+	uint32_t allSubGraphs = 0;
+	for (int j = 0; j < L.size(); ++j) {
+		node v = L[j];
+		const int first = m_edges.size();
+		for (adjEntry adj : v->adjEntries) {
+			edge e = adj->theEdge();
+			if (e->source() == v) {
+				uint32_t subGraphs = edgeSubGraphs[GC.original(e)];
+				m_edges.push({levels.pos(e->target()), subGraphs});
+				allSubGraphs |= subGraphs;
+			}
+		}
+		std::sort(m_edges.begin() + first, m_edges.end(),
+				[](const std::pair<int, uint32_t>& a, const std::pair<int, uint32_t>& b) {
+					return a.first < b.first;
+				});
+	}
+
+	// Each common subgraph of two crossing edges counts as a crossing, so
+	// count the crossings for every subgraph separately.
+	const int nUpper = levels[i + 1].size();
+	int nc = 0;
+	for (uint32_t bit = 1; allSubGraphs != 0; bit <<= 1) {
+		if ((allSubGraphs & bit) == 0) {
+			continue;
+		}
+		allSubGraphs &= ~bit;
+
+		m_targets.clear();
+		for (const std::pair<int, uint32_t>& edgeInfo : m_edges) {
+			if (edgeInfo.second & bit) {
+				m_targets.push(edgeInfo.first);
+			}
+		}
+		nc += countInversions(nUpper);
+	}
+
+	return nc;
+}
+
+int BilayerCrossingCounter::swapGain(const HierarchyLevelsBase& levels, node v, node w) {
+	auto pos = [&levels](node x) { return levels.pos(x); };
+	int gain = 0;
+	for (auto dir : {HierarchyLevelsBase::TraversingDir::upward,
+				 HierarchyLevelsBase::TraversingDir::downward}) {
+		const Array<node>& adjV = levels.adjNodes(v, dir);
+		const Array<node>& adjW = levels.adjNodes(w, dir);
+		gain += pairCrossings(adjV, adjW, pos) - pairCrossings(adjW, adjV, pos);
+	}
+	return gain;
+}
+
+// implementation by Michael Juenger, Decembre 2000, adapted by Carsten Gutwenger
+// implements the algorithm by Barth, Juenger, Mutzel
+int BilayerCrossingCounter::countInversions(int nUpper) {
+	int fa = 1;
+	while (fa < nUpper) {
+		fa *= 2;
+	}
+
+	int nTreeNodes = 2 * fa - 1; // number of tree nodes
+	--fa; // "first address:" index increment in tree
+
+	if (m_tree.size() < nTreeNodes) {
+		m_tree.init(nTreeNodes);
+	}
+	m_tree.fill(0, nTreeNodes - 1, 0);
+
+	int nc = 0; // number of crossings
+	for (int target : m_targets) {
+		// index of tree node for the target
+		int index = target + fa;
+		m_tree[index]++;
+
+		while (index > 0) {
+			if (index % 2) {
+				nc += m_tree[index + 1]; // new crossing
+			}
+			index = (index - 1) / 2;
+			m_tree[index]++;
+		}
+	}
+
+	return nc;
+}
+
+}
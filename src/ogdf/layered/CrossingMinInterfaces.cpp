@@ -31,70 +31,69 @@
 
 #include <ogdf/basic/Array.h>
 #include <ogdf/basic/Graph.h>
+#include <ogdf/basic/ThreadPool.h>
+#include <ogdf/layered/BilayerCrossingCounter.h>
 #include <ogdf/layered/CrossingMinInterfaces.h>
 
+#include <algorithm>
+
 namespace ogdf {
 
-// calculation of edge crossings between level i and i+1
-// implementation by Michael Juenger, Decembre 2000, adapted by Carsten Gutwenger
-// implements the algorithm by Barth, Juenger, Mutzel
 int HierarchyLevelsBase::calculateCrossings(int i) const {
-#if 0
-	const Level &L = *m_pLevel[i];             // level i
-	const int nUpper = m_pLevel[i+1]->size();  // number of nodes on level i+1
-#endif
-
-	const LevelBase& L = (*this)[i]; // level i
-	const int nUpper = (*this)[i + 1].size(); // number of nodes on level i+1
-
-	int nc = 0; // number of crossings
-
-	int fa = 1;
-	while (fa < nUpper) {
-		fa *= 2;
-	}
-
-	int nTreeNodes = 2 * fa - 1; // number of tree nodes
-	--fa; // "first address:" indexincrement in tree
-
-	Array<int> nin(0, nTreeNodes - 1, 0);
-
-	for (int j = 0; j < L.size(); ++j) {
-#if 0
-		const Array<node> &adjNodes = m_upperAdjNodes[L[j]];
-#endif
-		const Array<node>& adjNodes =
-				this->adjNodes(L[j], TraversingDir::upward); // m_upperAdjNodes[L[j]];
-
-		for (auto& adjNode : adjNodes) {
-			// index of tree node for vertex adjNode[k]
-#if 0
-			int index = m_pos[adjNodes[k]] + fa;
-#endif
-			int index = pos(adjNode) + fa;
-			nin[index]++;
-
-			while (index > 0) {
-				if (index % 2) {
-					nc += nin[index + 1]; // new crossing
-				}
-				index = (index - 1) / 2;
-				nin[index]++;
-			}
-		}
-	}
+	BilayerCrossingCounter counter;
+	return calculateCrossings(i, counter);
+}
 
-	return nc;
+int HierarchyLevelsBase::calculateCrossings(int i, BilayerCrossingCounter& counter) const {
+	return counter.count(*this, i);
 }
 
 int HierarchyLevelsBase::calculateCrossings() const {
+	BilayerCrossingCounter counter;
+	return calculateCrossings(counter);
+}
+
+int HierarchyLevelsBase::calculateCrossings(BilayerCrossingCounter& counter) const {
 	int nCrossings = 0;
 
 	for (int i = 0; i < this->high(); ++i) {
-		nCrossings += calculateCrossings(i);
+		nCrossings += counter.count(*this, i);
 	}
 
 	return nCrossings;
 }
 
+int HierarchyLevelsBase::calculateCrossingsInParallel(unsigned int numThreads,
+		BilayerCrossingCounter& counter) const {
+	// do not bother the thread pool for small hierarchies
+	const int minNodes = 1 << 14;
+	int numNodes = 0;
+	for (int i = 0; i <= high(); ++i) {
+		numNodes += (*this)[i].size();
+	}
+	const int numTasks =
+			std::min(static_cast<int>(ThreadPool::global().threadBudget(numThreads)), high());
+	if (numTasks <= 1 || numNodes < minNodes) {
+		return calculateCrossings(counter);
+	}
+
+	// every task counts a contiguous chunk of level pairs with a counter of its own
+	Array<int> nCrossings(0, numTasks - 1, 0);
+	ThreadPool::global().parallelFor(0, numTasks, numTasks, [&](int task) {
+		BilayerCrossingCounter taskCounter;
+		BilayerCrossingCounter& c = task == 0 ? counter : taskCounter;
+		const int first = static_cast<int>(static_cast<long long>(high()) * task / numTasks);
+		const int last = static_cast<int>(static_cast<long long>(high()) * (task + 1) / numTasks);
+		for (int i = first; i < last; ++i) {
+			nCrossings[task] += c.count(*this, i);
+		}
+	});
+
+	int sum = 0;
+	for (int nc : nCrossings) {
+		sum += nc;
+	}
+	return sum;
+}
+
 }
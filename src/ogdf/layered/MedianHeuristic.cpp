@@ -31,6 +31,7 @@
 
 #include <ogdf/basic/Array.h>
 #include <ogdf/basic/Graph.h>
+#include <ogdf/basic/ThreadPool.h>
 #include <ogdf/layered/HierarchyLevels.h>
 #include <ogdf/layered/Level.h>
 #include <ogdf/layered/MedianHeuristic.h>
@@ -40,7 +41,8 @@ namespace ogdf {
 void MedianHeuristic::call(Level& L) {
 	const HierarchyLevels& levels = L.levels();
 
-	for (int i = 0; i <= L.high(); ++i) {
+	// weights of different nodes are independent of each other
+	auto computeWeight = [&](int i) {
 		node v = L[i];
 
 		const Array<node>& adjNodes = L.adjNodes(v);
@@ -53,7 +55,9 @@ void MedianHeuristic::call(Level& L) {
 		} else {
 			m_weight[v] = 2 * levels.pos(adjNodes[high / 2]);
 		}
-	}
+	};
+	ThreadPool::global().parallelFor(0, L.size(), numberOfThreads(), computeWeight,
+			s_minNodesPerThread);
 
 	L.sort(m_weight, 0, 2 * levels.adjLevel(L.index()).high());
 }
@@ -0,0 +1,296 @@
+/** \file
+ * \brief Implementation of the network simplex based third phase of the
+ *        Sugiyama algorithm.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphAttributes.h>
+#include <ogdf/basic/GraphCopy.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/LayoutStandards.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/graphalg/MinCostFlowReinelt.h>
+#include <ogdf/layered/CrossingMinInterfaces.h>
+#include <ogdf/layered/Hierarchy.h>
+#include <ogdf/layered/NetworkSimplexHierarchyLayout.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ogdf {
+
+NetworkSimplexHierarchyLayout::NetworkSimplexHierarchyLayout() {
+	m_nodeDistance = LayoutStandards::defaultNodeSeparation();
+	m_layerDistance = 1.5 * LayoutStandards::defaultNodeSeparation();
+	m_fixedLayerDistance = false;
+	m_weightSegments = 2.0;
+}
+
+void NetworkSimplexHierarchyLayout::doCall(const HierarchyLevelsBase& levels, GraphAttributes& AGC) {
+	// trivial cases
+	const GraphCopy& GC = levels.hierarchy();
+	const int n = GC.numberOfNodes();
+
+	if (n == 0) {
+		return; // nothing to do
+	}
+
+	if (n == 1) {
+		node v = GC.firstNode();
+		AGC.x(v) = 0;
+		AGC.y(v) = 0;
+		return;
+	}
+
+	// actual computation
+	computeXCoordinates(levels, AGC);
+	computeYCoordinates(levels, AGC);
+}
+
+void NetworkSimplexHierarchyLayout::computeXCoordinates(const HierarchyLevelsBase& levels,
+		GraphAttributes& AGC) {
+	const Hierarchy& H = levels.hierarchy();
+	const GraphCopy& GC = H;
+	const int k = levels.size();
+
+	//
+	// preprocessing: determine nodes that are considered as virtual
+	// (same as in OptimalHierarchyLayout)
+	//
+	NodeArray<bool> isVirtual(GC);
+
+	for (int i = 0; i < k; ++i) {
+		const LevelBase& L = levels[i];
+		int last = -1;
+		for (int j = 0; j < L.size(); ++j) {
+			node v = L[j];
+
+			if (H.isLongEdgeDummy(v)) {
+				isVirtual[v] = true;
+
+				node u = v->firstAdj()->theEdge()->target();
+				if (u == v) {
+					u = v->lastAdj()->theEdge()->target();
+				}
+
+				if (H.isLongEdgeDummy(u)) {
+					int down = levels.pos(u);
+					if (last != -1 && last > down) {
+						isVirtual[v] = false;
+					} else {
+						last = down;
+					}
+				}
+			} else {
+				isVirtual[v] = false;
+			}
+		}
+	}
+
+	//
+	// auxiliary graph: the x-coordinate of each real vertex and vertical
+	// segment is the potential of a node; an arc (a,b) with length l
+	// requires x[b] - x[a] >= l, and the objective is the sum of
+	// weight * (x[b] - x[a]) over all arcs
+	//
+	Graph aux;
+	NodeArray<node> var(GC, nullptr); // node of aux representing the x-coordinate of v
+	EdgeArray<double> length(aux);
+	EdgeArray<int> weight(aux);
+
+	auto newArc = [&](node a, node b, double l, int w) {
+		edge arc = aux.newEdge(a, b);
+		length[arc] = l;
+		weight[arc] = w;
+	};
+
+	for (int i = 0; i < k; ++i) {
+		const LevelBase& L = levels[i];
+		for (int j = 0; j < L.size(); ++j) {
+			node v = L[j];
+			if (isVirtual[v]) {
+				continue;
+			}
+
+			// we've found a real vertex
+			var[v] = aux.newNode();
+
+			// a vertical segment starts at each outgoing edge to a virtual node
+			for (adjEntry adj : v->adjEntries) {
+				edge e = adj->theEdge();
+				node w = e->target();
+				if (w == v || !isVirtual[w]) {
+					continue;
+				}
+
+				node segment = aux.newNode();
+				do {
+					var[w] = segment;
+					e = e->adjTarget()->cyclicSucc()->theEdge();
+					w = e->target();
+				} while (isVirtual[w]);
+			}
+		}
+	}
+
+	// Gansner et al.: an edge (u,v) of weight w contributes w * |x_u - x_v|,
+	// which is modeled by a new node n_e and two arcs (n_e,u) and (n_e,v).
+	// Weights are scaled to integers, since they become supplies.
+	const double weightScale = 100.0;
+	const int weightOne = int(weightScale);
+	const int weightSegmentEdge = std::max(1, int(std::lround(weightScale * m_weightSegments)));
+
+	for (edge e : GC.edges) {
+		node u = var[e->source()], v = var[e->target()];
+		if (u == v) {
+			continue; // inside a vertical segment
+		}
+
+		// edge segments connecting to a vertical segment (i.e. the original
+		// edge is represented by at least three edges in GC) get a special weight
+		int w = GC.chain(GC.original(e)).size() >= 3 ? weightSegmentEdge : weightOne;
+		node n_e = aux.newNode();
+		newArc(n_e, u, 0.0, w);
+		newArc(n_e, v, 0.0, w);
+	}
+
+	// x[v_i] - x[v_(i-1)] >= nodeDistance + 0.5*(width(v_i)+width(v_(i-1)))
+	for (int i = 0; i < k; ++i) {
+		const LevelBase& L = levels[i];
+		for (int j = 1; j < L.size(); ++j) {
+			node u = L[j - 1];
+			node v = L[j];
+			newArc(var[u], var[v],
+					m_nodeDistance + 0.5 * (getWidth(AGC, levels, v) + getWidth(AGC, levels, u)), 0);
+		}
+	}
+
+	// The min-cost flow algorithm requires a connected graph. Since the
+	// positions of different components are independent, they can be
+	// connected by arbitrary (non-contradicting) constraints without weight.
+	NodeArray<int> component(aux);
+	int numCC = connectedComponents(aux, component);
+	if (numCC > 1) {
+		Array<node> representative(0, numCC - 1, nullptr);
+		for (node a : aux.nodes) {
+			if (representative[component[a]] == nullptr) {
+				representative[component[a]] = a;
+			}
+		}
+		for (int c = 1; c < numCC; ++c) {
+			newArc(representative[0], representative[c], 0.0, 0);
+		}
+	}
+
+	//
+	// solve the dual min-cost flow problem with the network simplex method
+	//
+	MinCostFlowReinelt<double> mcf;
+
+	EdgeArray<int> lowerBound(aux, 0);
+	EdgeArray<int> upperBound(aux, mcf.infinity());
+	EdgeArray<double> cost(aux);
+	NodeArray<int> supply(aux, 0);
+
+	for (edge arc : aux.edges) {
+		cost[arc] = -length[arc];
+		supply[arc->source()] += weight[arc];
+		supply[arc->target()] -= weight[arc];
+	}
+
+	EdgeArray<int> flow(aux);
+	NodeArray<double> dual(aux);
+#ifdef OGDF_DEBUG
+	bool feasible =
+#endif
+			mcf.call(aux, lowerBound, upperBound, cost, supply, flow, dual);
+	OGDF_ASSERT(feasible);
+
+	// assign x coordinates, the leftmost node starting at 0
+	double minX = std::numeric_limits<double>::max();
+	for (node v : GC.nodes) {
+		AGC.x(v) = dual[var[v]];
+		minX = std::min(minX, AGC.x(v) - 0.5 * getWidth(AGC, levels, v));
+	}
+	for (node v : GC.nodes) {
+		AGC.x(v) -= minX;
+	}
+}
+
+void NetworkSimplexHierarchyLayout::computeYCoordinates(const HierarchyLevelsBase& levels,
+		GraphAttributes& AGC) {
+	const int k = levels.size();
+
+	// compute height of each layer
+	Array<double> height(0, k - 1, 0.0);
+
+	for (int i = 0; i < k; ++i) {
+		const LevelBase& L = levels[i];
+		for (int j = 0; j < L.size(); ++j) {
+			height[i] = std::max(height[i], getHeight(AGC, levels, L[j]));
+		}
+	}
+
+	// assign y-coordinates
+	double yPos = 0.5 * height[0];
+
+	for (int i = 0;; ++i) {
+		const LevelBase& L = levels[i];
+		for (int j = 0; j < L.size(); ++j) {
+			AGC.y(L[j]) = yPos;
+		}
+
+		if (i == k - 1) {
+			break;
+		}
+
+		double dy = m_layerDistance;
+
+		if (!m_fixedLayerDistance) {
+			for (int j = 0; j < L.size(); ++j) {
+				node v = L[j];
+				for (adjEntry adj : v->adjEntries) {
+					edge e = adj->theEdge();
+					node w = e->target();
+					if (w != v) {
+						dy = std::max(dy, std::fabs(AGC.x(v) - AGC.x(w)) / 3.0);
+					}
+				}
+			}
+
+			dy = std::min(dy, 10 * m_layerDistance);
+		}
+
+		yPos += dy + 0.5 * (height[i] + height[i + 1]);
+	}
+}
+
+}
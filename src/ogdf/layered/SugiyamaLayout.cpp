@@ -42,6 +42,7 @@
 #include <ogdf/basic/SList.h>
 #include <ogdf/basic/System.h>
 #include <ogdf/basic/Thread.h>
+#include <ogdf/basic/ThreadPool.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/geometry.h>
 #include <ogdf/basic/simple_graph_alg.h>
@@ -49,6 +50,7 @@
 #include <ogdf/cluster/ClusterGraphAttributes.h>
 #include <ogdf/cluster/ClusterGraphCopyAttributes.h>
 #include <ogdf/layered/BarycenterHeuristic.h>
+#include <ogdf/layered/BilayerCrossingCounter.h>
 #include <ogdf/layered/CrossingMinInterfaces.h>
 #include <ogdf/layered/ExtendedNestingGraph.h>
 #include <ogdf/layered/FastHierarchyLayout.h>
@@ -90,6 +92,16 @@ using std::mutex;
 
 namespace ogdf {
 
+//! Returns the time at which a call of \p sugi started now has to stop, or -1 if there is no limit.
+static int64_t stopTimeOfCall(const SugiyamaLayout& sugi) {
+	return sugi.isTimeLimit() ? System::realTime() + int64_t(1000.0 * sugi.timeLimit()) : -1;
+}
+
+//! Returns whether \p stopTime is set and has passed.
+static bool stopTimeReached(int64_t stopTime) {
+	return stopTime >= 0 && System::realTime() >= stopTime;
+}
+
 void ClusterGraphCopyAttributes::transform() {
 	for (node v : m_pH->nodes) {
 		node vG = m_pH->origNode(v);
@@ -425,71 +437,28 @@ void HierarchyLevels::separateCCs(int numCC, const NodeArray<int>& component) {
 }
 
 int HierarchyLevels::calculateCrossingsSimDraw(const EdgeArray<uint32_t>* edgeSubGraphs) const {
+	BilayerCrossingCounter counter;
+	return calculateCrossingsSimDraw(edgeSubGraphs, counter);
+}
+
+int HierarchyLevels::calculateCrossingsSimDraw(const EdgeArray<uint32_t>* edgeSubGraphs,
+		BilayerCrossingCounter& counter) const {
 	int nCrossings = 0;
 
 	for (int i = 0; i < m_pLevel.high(); ++i) {
-		nCrossings += calculateCrossingsSimDraw(i, edgeSubGraphs);
+		nCrossings += counter.countSimDraw(*this, i, *edgeSubGraphs);
 	}
 
 	return nCrossings;
 }
 
-// naive calculation of edge crossings between level i and i+1
-// for SimDraw-calculation by Michael Schulz
-
 int HierarchyLevels::calculateCrossingsSimDraw(int i, const EdgeArray<uint32_t>* edgeSubGraphs) const {
-	const int maxGraphs = 32;
-
-	const Level& level = *m_pLevel[i]; // level i
-	const GraphCopy& GC = m_H;
-
-	int nc = 0; // number of crossings
-
-	for (int j = 0; j < level.size(); ++j) {
-		node v = level[j];
-		for (adjEntry adj : v->adjEntries) {
-			edge e = adj->theEdge();
-			if (e->source() == v) {
-				int pos_adj_e = pos(e->target());
-				for (int k = j + 1; k < level.size(); k++) {
-					node w = level[k];
-					for (adjEntry adjW : w->adjEntries) {
-						edge f = adjW->theEdge();
-						if (f->source() == w) {
-							int pos_adj_f = pos(f->target());
-							if (pos_adj_f < pos_adj_e) {
-								int graphCounter = 0;
-								for (int numGraphs = 0; numGraphs < maxGraphs; numGraphs++) {
-									if ((1 << numGraphs) & (*edgeSubGraphs)[GC.original(e)]
-											& (*edgeSubGraphs)[GC.original(f)]) {
-										graphCounter++;
-									}
-								}
-								nc += graphCounter;
-							}
-						}
-					}
-				}
-			}
-		}
-	}
-
-	return nc;
+	BilayerCrossingCounter counter;
+	return counter.countSimDraw(*this, i, *edgeSubGraphs);
 }
 
 int HierarchyLevels::transposePart(const Array<node>& adjV, const Array<node>& adjW) {
-	const int vSize = adjV.size();
-	int iW = 0, iV = 0, sum = 0;
-
-	for (; iW <= adjW.high(); ++iW) {
-		int p = m_pos[adjW[iW]];
-		while (iV < vSize && m_pos[adjV[iV]] <= p) {
-			++iV;
-		}
-		sum += vSize - iV;
-	}
-
-	return sum;
+	return BilayerCrossingCounter::pairCrossings(adjV, adjW, [this](node x) { return m_pos[x]; });
 }
 
 bool HierarchyLevels::transpose(node v) {
@@ -553,18 +522,36 @@ class LayerByLayerSweep::CrossMinMaster {
 	const Hierarchy& m_H;
 
 	atomic<int> m_runs;
+	int64_t m_stopTime; //!< Time at which no further traversals are started (-1 if none).
+	ArrayBuffer<int> m_crossingsPerRun; //!< Best number of crossings of each finished run.
 	mutex m_mutex;
 
+	unsigned int m_threadsPerRun = 1; //!< Number of threads used within a single run.
+
 public:
+	//! Creates a master for \p runs further runs, which are unlimited if \p sugi has a stop time.
 	CrossMinMaster(const SugiyamaLayout& sugi, const Hierarchy& H, int runs);
 
+	//! Returns the number of threads for executing the runs of \p sugi concurrently.
+	static unsigned int numberOfThreads(const SugiyamaLayout& sugi) {
+		return sugi.crossMinStopTime() >= 0 ? sugi.maxThreads()
+											: min(sugi.maxThreads(), (unsigned int)sugi.runs());
+	}
+
 	const Hierarchy& hierarchy() const { return m_H; }
 
+	//! Returns the best number of crossings of each finished run.
+	const ArrayBuffer<int>& crossingsPerRun() const { return m_crossingsPerRun; }
+
+	//! Sets the number of threads used within a single run to \p n.
+	void threadsPerRun(unsigned int n) { m_threadsPerRun = max(1u, n); }
+
 	void restore(HierarchyLevels& levels, int& cr);
 
+	//! Performs runs on \p levels, counting crossings with \p counter of the calling worker.
 	void doWorkHelper(LayerByLayerSweep* pCrossMin, TwoLayerCrossMinSimDraw* pCrossMinSimDraw,
-			HierarchyLevels& levels, NodeArray<int>& bestPos, bool permuteFirst,
-			std::minstd_rand& rng);
+			HierarchyLevels& levels, NodeArray<int>& bestPos, BilayerCrossingCounter& counter,
+			bool permuteFirst, std::minstd_rand& rng);
 
 private:
 	const EdgeArray<uint32_t>* subgraphs() const { return m_sugi.subgraphs(); }
@@ -584,14 +571,27 @@ private:
 	void doTransposeRev(HierarchyLevels& levels, Array<bool>& levelChanged);
 
 	int traverseTopDown(HierarchyLevels& levels, LayerByLayerSweep* pCrossMin,
-			TwoLayerCrossMinSimDraw* pCrossMinSimDraw, Array<bool>* pLevelChanged);
+			TwoLayerCrossMinSimDraw* pCrossMinSimDraw, Array<bool>* pLevelChanged,
+			BilayerCrossingCounter& counter);
 
 	int traverseBottomUp(HierarchyLevels& levels, LayerByLayerSweep* pCrossMin,
-			TwoLayerCrossMinSimDraw* pCrossMinSimDraw, Array<bool>* pLevelChanged);
+			TwoLayerCrossMinSimDraw* pCrossMinSimDraw, Array<bool>* pLevelChanged,
+			BilayerCrossingCounter& counter);
+
+	//! Computes the crossings of \p levels, restricted to common subgraphs if \p simDraw is set.
+	int calculateCrossings(const HierarchyLevels& levels, bool simDraw,
+			BilayerCrossingCounter& counter) const {
+		return simDraw ? levels.calculateCrossingsSimDraw(subgraphs(), counter)
+					   : levels.calculateCrossingsInParallel(m_threadsPerRun, counter);
+	}
 
 	int queryBestKnown() const { return m_bestCR; }
 
+	//! Returns whether the time limit is exceeded.
+	bool timeIsUp() const { return stopTimeReached(m_stopTime); }
+
 	bool postNewResult(int cr, NodeArray<int>* pPos);
+	void postRunResult(int cr);
 	bool getNextRun();
 };
 
@@ -601,7 +601,8 @@ LayerByLayerSweep::CrossMinMaster::CrossMinMaster(const SugiyamaLayout& sugi, co
 	, m_bestCR(std::numeric_limits<int>::max())
 	, m_sugi(sugi)
 	, m_H(H)
-	, m_runs(runs) { }
+	, m_runs(sugi.crossMinStopTime() >= 0 ? std::numeric_limits<int>::max() : runs)
+	, m_stopTime(sugi.crossMinStopTime()) { }
 
 bool LayerByLayerSweep::CrossMinMaster::postNewResult(int cr, NodeArray<int>* pPos) {
 	bool storeResult = false;
@@ -621,7 +622,12 @@ bool LayerByLayerSweep::CrossMinMaster::postNewResult(int cr, NodeArray<int>* pP
 	return storeResult;
 }
 
-bool LayerByLayerSweep::CrossMinMaster::getNextRun() { return --m_runs >= 0; }
+void LayerByLayerSweep::CrossMinMaster::postRunResult(int cr) {
+	lock_guard<mutex> guard(m_mutex);
+	m_crossingsPerRun.push(cr);
+}
+
+bool LayerByLayerSweep::CrossMinMaster::getNextRun() { return !timeIsUp() && --m_runs >= 0; }
 
 void LayerByLayerSweep::CrossMinMaster::restore(HierarchyLevels& levels, int& cr) {
 	levels.restorePos(*m_pBestPos);
@@ -678,7 +684,7 @@ void LayerByLayerSweep::CrossMinMaster::doTransposeRev(HierarchyLevels& levels,
 
 int LayerByLayerSweep::CrossMinMaster::traverseTopDown(HierarchyLevels& levels,
 		LayerByLayerSweep* pCrossMin, TwoLayerCrossMinSimDraw* pCrossMinSimDraw,
-		Array<bool>* pLevelChanged) {
+		Array<bool>* pLevelChanged, BilayerCrossingCounter& counter) {
 	levels.direction(HierarchyLevels::TraversingDir::downward);
 
 	for (int i = 1; i <= levels.high(); ++i) {
@@ -696,13 +702,12 @@ int LayerByLayerSweep::CrossMinMaster::traverseTopDown(HierarchyLevels& levels,
 		levels.separateCCs(arrange_numCC(), arrange_compGC());
 	}
 
-	return (pCrossMin != nullptr) ? levels.calculateCrossings()
-								  : levels.calculateCrossingsSimDraw(subgraphs());
+	return calculateCrossings(levels, pCrossMin == nullptr, counter);
 }
 
 int LayerByLayerSweep::CrossMinMaster::traverseBottomUp(HierarchyLevels& levels,
 		LayerByLayerSweep* pCrossMin, TwoLayerCrossMinSimDraw* pCrossMinSimDraw,
-		Array<bool>* pLevelChanged) {
+		Array<bool>* pLevelChanged, BilayerCrossingCounter& counter) {
 	levels.direction(HierarchyLevels::TraversingDir::upward);
 
 	for (int i = levels.high() - 1; i >= 0; i--) {
@@ -720,28 +725,28 @@ int LayerByLayerSweep::CrossMinMaster::traverseBottomUp(HierarchyLevels& levels,
 		levels.separateCCs(arrange_numCC(), arrange_compGC());
 	}
 
-	return (pCrossMin != nullptr) ? levels.calculateCrossings()
-								  : levels.calculateCrossingsSimDraw(subgraphs());
+	return calculateCrossings(levels, pCrossMin == nullptr, counter);
 }
 
 void LayerByLayerSweep::CrossMinMaster::doWorkHelper(LayerByLayerSweep* pCrossMin,
 		TwoLayerCrossMinSimDraw* pCrossMinSimDraw, HierarchyLevels& levels, NodeArray<int>& bestPos,
-		bool permuteFirst, minstd_rand& rng) {
+		BilayerCrossingCounter& counter, bool permuteFirst, minstd_rand& rng) {
 	if (permuteFirst) {
 		levels.permute(rng);
 	}
 
-	int nCrossingsOld = (pCrossMin != nullptr) ? levels.calculateCrossings()
-											   : levels.calculateCrossingsSimDraw(subgraphs());
+	int nCrossingsOld = calculateCrossings(levels, pCrossMin == nullptr, counter);
 	if (postNewResult(nCrossingsOld, &bestPos)) {
 		levels.storePos(bestPos);
 	}
 
-	if (queryBestKnown() == 0) {
+	if (queryBestKnown() == 0 || timeIsUp()) {
+		postRunResult(nCrossingsOld);
 		return;
 	}
 
 	if (pCrossMin != nullptr) {
+		pCrossMin->m_numThreads = m_threadsPerRun;
 		pCrossMin->init(levels);
 	} else {
 		pCrossMinSimDraw->init(levels);
@@ -758,7 +763,8 @@ void LayerByLayerSweep::CrossMinMaster::doWorkHelper(LayerByLayerSweep* pCrossMi
 		int nFails = maxFails + 1;
 		do {
 			// top-down traversal
-			int nCrossingsNew = traverseTopDown(levels, pCrossMin, pCrossMinSimDraw, pLevelChanged);
+			int nCrossingsNew =
+					traverseTopDown(levels, pCrossMin, pCrossMinSimDraw, pLevelChanged, counter);
 			if (nCrossingsNew < nCrossingsOld) {
 				if (nCrossingsNew < queryBestKnown() && postNewResult(nCrossingsNew, &bestPos)) {
 					levels.storePos(bestPos);
@@ -770,8 +776,13 @@ void LayerByLayerSweep::CrossMinMaster::doWorkHelper(LayerByLayerSweep* pCrossMi
 				--nFails;
 			}
 
+			if (timeIsUp()) {
+				break;
+			}
+
 			// bottom-up traversal
-			nCrossingsNew = traverseBottomUp(levels, pCrossMin, pCrossMinSimDraw, pLevelChanged);
+			nCrossingsNew =
+					traverseBottomUp(levels, pCrossMin, pCrossMinSimDraw, pLevelChanged, counter);
 			if (nCrossingsNew < nCrossingsOld) {
 				if (nCrossingsNew < queryBestKnown() && postNewResult(nCrossingsNew, &bestPos)) {
 					levels.storePos(bestPos);
@@ -783,7 +794,10 @@ void LayerByLayerSweep::CrossMinMaster::doWorkHelper(LayerByLayerSweep* pCrossMi
 				--nFails;
 			}
 
-		} while (nFails > 0);
+		} while (nFails > 0 && !timeIsUp());
+
+		// nCrossingsOld only decreases within a run
+		postRunResult(nCrossingsOld);
 
 		if (!getNextRun()) {
 			break;
@@ -791,8 +805,7 @@ void LayerByLayerSweep::CrossMinMaster::doWorkHelper(LayerByLayerSweep* pCrossMi
 
 		levels.permute(rng);
 
-		nCrossingsOld = (pCrossMin != nullptr) ? levels.calculateCrossings()
-											   : levels.calculateCrossingsSimDraw(subgraphs());
+		nCrossingsOld = calculateCrossings(levels, pCrossMin == nullptr, counter);
 		if (nCrossingsOld < queryBestKnown() && postNewResult(nCrossingsOld, &bestPos)) {
 			levels.storePos(bestPos);
 		}
@@ -809,12 +822,13 @@ void LayerByLayerSweep::CrossMinMaster::doWorkHelper(LayerByLayerSweep* pCrossMi
 
 // LayerByLayerSweep::CrossMinWorker
 
-class LayerByLayerSweep::CrossMinWorker : public Thread {
+class LayerByLayerSweep::CrossMinWorker {
 	LayerByLayerSweep::CrossMinMaster& m_master;
 	LayerByLayerSweep* m_pCrossMin;
 	TwoLayerCrossMinSimDraw* m_pCrossMinSimDraw;
 
 	NodeArray<int> m_bestPos;
+	BilayerCrossingCounter m_counter; //!< Counts crossings throughout all runs of this worker.
 
 public:
 	CrossMinWorker(LayerByLayerSweep::CrossMinMaster& master, LayerByLayerSweep* pCrossMin,
@@ -837,7 +851,7 @@ void LayerByLayerSweep::CrossMinWorker::operator()() {
 	HierarchyLevels levels(m_master.hierarchy());
 
 	minstd_rand rng(randomSeed()); // different seeds per worker
-	m_master.doWorkHelper(m_pCrossMin, m_pCrossMinSimDraw, levels, m_bestPos, true, rng);
+	m_master.doWorkHelper(m_pCrossMin, m_pCrossMinSimDraw, levels, m_bestPos, m_counter, true, rng);
 }
 
 SugiyamaLayout::SugiyamaLayout() {
@@ -884,10 +898,13 @@ void SugiyamaLayout::doCall(GraphAttributes& AG, bool umlCall) {
 
 void SugiyamaLayout::doCall(GraphAttributes& AG, bool umlCall, NodeArray<int>& rank) {
 	const Graph& G = AG.constGraph();
+	m_crossingsPerRun.clear();
 	if (G.numberOfNodes() == 0) {
 		return;
 	}
 
+	const int64_t stopTime = stopTimeOfCall(*this);
+
 	// compute connected component of G
 	NodeArray<int> component(G);
 	m_numCC = connectedComponents(G, component);
@@ -906,7 +923,7 @@ void SugiyamaLayout::doCall(GraphAttributes& AG, bool umlCall, NodeArray<int>& r
 		}
 	}
 
-	if (m_arrangeCCs) {
+	if (m_arrangeCCs && m_newNodes == nullptr) {
 		// intialize the array of lists of nodes contained in a CC
 		Array<List<node>> nodesInCC(m_numCC);
 
@@ -924,6 +941,7 @@ void SugiyamaLayout::doCall(GraphAttributes& AG, bool umlCall, NodeArray<int>& r
 		m_numLevels = m_maxLevelSize = 0;
 
 		int totalCrossings = 0;
+		int remainingNodes = G.numberOfNodes();
 		for (int i = 0; i < m_numCC; ++i) {
 			// adjust ranks in cc to start with 0
 			int minRank = std::numeric_limits<int>::max();
@@ -940,6 +958,15 @@ void SugiyamaLayout::doCall(GraphAttributes& AG, bool umlCall, NodeArray<int>& r
 			}
 			H.createEmpty(G);
 			H.initByNodes(nodesInCC[i], auxCopy, rank);
+
+			if (stopTime >= 0) {
+				// share the remaining time among the remaining components by size
+				int64_t remainingTime = max(stopTime - System::realTime(), int64_t(0));
+				m_crossMinStopTime = System::realTime()
+						+ remainingTime * nodesInCC[i].size() / remainingNodes;
+				remainingNodes -= nodesInCC[i].size();
+			}
+
 			//HierarchyLevels levels(H);
 			//reduceCrossings(levels);
 			const HierarchyLevelsBase* pLevels = reduceCrossings(H);
@@ -1118,7 +1145,9 @@ void SugiyamaLayout::doCall(GraphAttributes& AG, bool umlCall, NodeArray<int>& r
 			}
 		}
 
-		const HierarchyLevelsBase* pLevels = reduceCrossings(H);
+		m_crossMinStopTime = stopTime;
+		const HierarchyLevelsBase* pLevels =
+				m_newNodes != nullptr ? reduceCrossingsIncremental(H, AG) : reduceCrossings(H);
 		const HierarchyLevelsBase& levels = *pLevels;
 		//HierarchyLevels levels(H);
 		//reduceCrossings(levels);
@@ -1177,6 +1206,7 @@ void SugiyamaLayout::doCall(GraphAttributes& AG, bool umlCall, NodeArray<int>& r
 		}
 		delete pLevels;
 	}
+	m_crossMinStopTime = -1;
 
 	for (edge e : G.edges) {
 		AG.bends(e).normalize();
@@ -1198,6 +1228,225 @@ void SugiyamaLayout::doCall(GraphAttributes& AG, bool umlCall, NodeArray<int>& r
 
 void SugiyamaLayout::callUML(GraphAttributes& AG) { doCall(AG, true); }
 
+//! Assigns a rank to each node \p v with \p isNew[\p v] next to its already ranked neighbors.
+static void rankNewNodes(const Graph& G, const NodeArray<bool>& isNew, NodeArray<int>& rank) {
+	NodeArray<bool> ranked(G);
+	ArrayBuffer<node> unranked;
+	int minRank = std::numeric_limits<int>::max();
+	for (node v : G.nodes) {
+		ranked[v] = !isNew[v];
+		if (isNew[v]) {
+			unranked.push(v);
+		} else {
+			Math::updateMin(minRank, rank[v]);
+		}
+	}
+	if (minRank == std::numeric_limits<int>::max()) {
+		minRank = 0;
+	}
+
+	while (!unranked.empty()) {
+		ArrayBuffer<node> remaining;
+		for (node v : unranked) {
+			int maxPred = std::numeric_limits<int>::min();
+			int minSucc = std::numeric_limits<int>::max();
+			for (adjEntry adj : v->adjEntries) {
+				node u = adj->twinNode();
+				if (ranked[u] && u != v) {
+					if (adj->isSource()) {
+						Math::updateMin(minSucc, rank[u]);
+					} else {
+						Math::updateMax(maxPred, rank[u]);
+					}
+				}
+			}
+
+			if (maxPred != std::numeric_limits<int>::min()) {
+				rank[v] = maxPred + 1;
+			} else if (minSucc != std::numeric_limits<int>::max()) {
+				rank[v] = minSucc - 1;
+			} else {
+				remaining.push(v);
+				continue;
+			}
+			ranked[v] = true;
+		}
+
+		if (remaining.size() == unranked.size()) {
+			// the remaining nodes have no ranked neighbors, start at the lowest level
+			rank[remaining[0]] = minRank;
+			ranked[remaining[0]] = true;
+			remaining[0] = remaining[remaining.size() - 1];
+			remaining.pop();
+		}
+		unranked = std::move(remaining);
+	}
+}
+
+//! Sets \p x to the x-coordinates in \p AG, estimating those of nodes \p v with \p isNew[\p v].
+/**
+ * A new node is placed at the barycenter of its placed neighbors; new nodes
+ * without any placed neighbors are placed to the right of all other nodes.
+ */
+static void placeNewNodes(const GraphAttributes& AG, const NodeArray<bool>& isNew,
+		NodeArray<double>& x) {
+	const Graph& G = AG.constGraph();
+	NodeArray<bool> placed(G);
+	ArrayBuffer<node> unplaced;
+	double maxX = 0;
+	for (node v : G.nodes) {
+		placed[v] = !isNew[v];
+		if (isNew[v]) {
+			unplaced.push(v);
+		} else {
+			x[v] = AG.x(v);
+			Math::updateMax(maxX, x[v]);
+		}
+	}
+
+	while (!unplaced.empty()) {
+		ArrayBuffer<node> remaining;
+		for (node v : unplaced) {
+			double sum = 0;
+			int num = 0;
+			for (adjEntry adj : v->adjEntries) {
+				if (placed[adj->twinNode()]) {
+					sum += x[adj->twinNode()];
+					++num;
+				}
+			}
+
+			if (num > 0) {
+				x[v] = sum / num;
+				placed[v] = true;
+			} else {
+				remaining.push(v);
+			}
+		}
+
+		if (remaining.size() == unplaced.size()) {
+			node v = remaining[0];
+			x[v] = ++maxX;
+			placed[v] = true;
+			remaining[0] = remaining[remaining.size() - 1];
+			remaining.pop();
+		}
+		unplaced = std::move(remaining);
+	}
+}
+
+//! Moves \p v to the position on \p level with the fewest crossings, preferring its current position.
+static void siftNode(HierarchyLevels& levels, Level& level, node v) {
+	const int start = levels.pos(v);
+
+	// move v to the front, keeping track of the change of crossings
+	int crossings = 0;
+	for (int p = start; p > 0; --p) {
+		crossings -= BilayerCrossingCounter::swapGain(levels, level[p - 1], v);
+		level.swap(p - 1, p);
+	}
+
+	int best = 0, bestCrossings = crossings;
+	for (int p = 1; p < level.size(); ++p) {
+		crossings -= BilayerCrossingCounter::swapGain(levels, v, level[p]);
+		level.swap(p - 1, p);
+		if (crossings < bestCrossings
+				|| (crossings == bestCrossings && std::abs(p - start) < std::abs(best - start))) {
+			best = p;
+			bestCrossings = crossings;
+		}
+	}
+
+	for (int p = level.high(); p > best; --p) {
+		level.swap(p - 1, p);
+	}
+}
+
+void SugiyamaLayout::callIncremental(GraphAttributes& AG, NodeArray<int>& rank) {
+	const Graph& G = AG.constGraph();
+	OGDF_ASSERT(rank.valid());
+	OGDF_ASSERT(rank.graphOf() == &G);
+	OGDF_ASSERT(!useSubgraphs());
+
+	NodeArray<bool> isNew(G);
+	for (node v : G.nodes) {
+		isNew[v] = rank[v] < 0;
+	}
+	rankNewNodes(G, isNew, rank);
+
+	m_newNodes = &isNew;
+	doCall(AG, false, rank);
+	m_newNodes = nullptr;
+}
+
+const HierarchyLevelsBase* SugiyamaLayout::reduceCrossingsIncremental(const Hierarchy& H,
+		const GraphAttributes& AG) {
+	int64_t t;
+	System::usedRealTime(t);
+
+	const GraphCopy& GC = H;
+	const NodeArray<bool>& isNew = *m_newNodes;
+
+	NodeArray<double> x(AG.constGraph());
+	placeNewNodes(AG, isNew, x);
+
+	// order the levels as in the previous layout, interpolating along long edges
+	NodeArray<double> key(GC);
+	NodeArray<bool> movable(GC);
+	for (node v : GC.nodes) {
+		node vOrig = GC.original(v);
+		if (vOrig != nullptr) {
+			key[v] = x[vOrig];
+			movable[v] = isNew[vOrig];
+			continue;
+		}
+
+		edge e = GC.original(v->firstAdj()->theEdge());
+		OGDF_ASSERT(e != nullptr);
+		node src = e->source(), tgt = e->target();
+		int rankSrc = H.rank(GC.copy(src)), rankTgt = H.rank(GC.copy(tgt));
+		double ratio = rankSrc == rankTgt ? 0.5 : double(H.rank(v) - rankSrc) / (rankTgt - rankSrc);
+		key[v] = x[src] + ratio * (x[tgt] - x[src]);
+		movable[v] = isNew[src] || isNew[tgt];
+	}
+
+	HierarchyLevels* pLevels = new HierarchyLevels(H);
+	HierarchyLevels& levels = *pLevels;
+	for (int i = 0; i <= levels.high(); ++i) {
+		levels[i].sortByWeightOnly(key);
+	}
+
+	// place the new nodes and the dummies of their edges top-down, then bottom-up
+	ArrayBuffer<node> sifted;
+	for (int pass = 0; pass < 2; ++pass) {
+		for (int k = 0; k <= levels.high(); ++k) {
+			int i = pass == 0 ? k : levels.high() - k;
+			Level& level = levels[i];
+
+			sifted.clear();
+			for (int j = 0; j < level.size(); ++j) {
+				if (movable[level[j]]) {
+					sifted.push(level[j]);
+				}
+			}
+
+			if (!sifted.empty()) {
+				for (node v : sifted) {
+					siftNode(levels, level, v);
+				}
+				levels.buildAdjNodes(i);
+			}
+		}
+	}
+
+	m_nCrossings = levels.calculateCrossings();
+
+	t = System::usedRealTime(t);
+	m_timeReduceCrossings = double(t) / 1000;
+
+	return pLevels;
+}
+
 #if 0
 void SugiyamaLayout::reduceCrossings(HierarchyLevels &levels)
 {
@@ -1252,27 +1501,29 @@ const HierarchyLevels* LayerByLayerSweep::reduceCrossings(const SugiyamaLayout&
 
 	OGDF_ASSERT(sugi.runs() >= 1);
 
-	unsigned int nThreads = min(sugi.maxThreads(), (unsigned int)sugi.runs());
+	ThreadPool::TaskGroup tasks(LayerByLayerSweep::CrossMinMaster::numberOfThreads(sugi));
+	unsigned int nThreads = tasks.budget();
 
 	minstd_rand rng(randomSeed());
 
 	LayerByLayerSweep::CrossMinMaster master(sugi, levels->hierarchy(), sugi.runs() - nThreads);
+	master.threadsPerRun(sugi.maxThreads() / nThreads);
 
 	Array<LayerByLayerSweep::CrossMinWorker*> worker(nThreads - 1);
-	Array<Thread> thread(nThreads - 1);
 	for (unsigned int i = 0; i < nThreads - 1; ++i) {
 		worker[i] = new LayerByLayerSweep::CrossMinWorker(master, clone(), nullptr);
-		thread[i] = Thread(*worker[i]);
+		LayerByLayerSweep::CrossMinWorker* pWorker = worker[i];
+		tasks.run([pWorker] { (*pWorker)(); });
 	}
 
 	NodeArray<int> bestPos;
-	master.doWorkHelper(this, nullptr, *levels, bestPos, sugi.permuteFirst(), rng);
+	BilayerCrossingCounter counter;
+	master.doWorkHelper(this, nullptr, *levels, bestPos, counter, sugi.permuteFirst(), rng);
 
-	for (unsigned int i = 0; i < nThreads - 1; ++i) {
-		thread[i].join();
-	}
+	tasks.wait();
 
 	master.restore(*levels, nCrossings);
+	m_crossingsPerRun = master.crossingsPerRun();
 
 	for (unsigned int i = 0; i < nThreads - 1; ++i) {
 		delete worker[i];
@@ -1290,6 +1541,11 @@ const HierarchyLevelsBase* SugiyamaLayout::reduceCrossings(Hierarchy& H) {
 		const HierarchyLevelsBase* levels = m_crossMin->reduceCrossings(*this, H, m_nCrossings);
 		t = System::usedRealTime(t);
 		m_timeReduceCrossings = double(t) / 1000;
+		if (auto pSweep = dynamic_cast<const LayerByLayerSweep*>(m_crossMin.get())) {
+			for (int cr : pSweep->crossingsPerRun()) {
+				m_crossingsPerRun.push(cr);
+			}
+		}
 		m_nCrossings = levels->calculateCrossings();
 		return levels;
 	}
@@ -1307,7 +1563,8 @@ const HierarchyLevelsBase* SugiyamaLayout::reduceCrossings(Hierarchy& H) {
 
 	pCrossMinSimDraw = m_crossMinSimDraw.get();
 
-	unsigned int nThreads = min(m_maxThreads, (unsigned int)m_runs);
+	ThreadPool::TaskGroup tasks(LayerByLayerSweep::CrossMinMaster::numberOfThreads(*this));
+	unsigned int nThreads = tasks.budget();
 
 	int seed = rand();
 	minstd_rand rng(seed);
@@ -1315,22 +1572,24 @@ const HierarchyLevelsBase* SugiyamaLayout::reduceCrossings(Hierarchy& H) {
 	LayerByLayerSweep::CrossMinMaster master(*this, levels.hierarchy(), m_runs - nThreads);
 
 	Array<LayerByLayerSweep::CrossMinWorker*> worker(nThreads - 1);
-	Array<Thread> thread(nThreads - 1);
 	for (unsigned int i = 0; i < nThreads - 1; ++i) {
 		worker[i] = new LayerByLayerSweep::CrossMinWorker(master,
 				(pCrossMin != nullptr) ? pCrossMin->clone() : nullptr,
 				(pCrossMinSimDraw != nullptr) ? pCrossMinSimDraw->clone() : nullptr);
-		thread[i] = Thread(*worker[i]);
+		LayerByLayerSweep::CrossMinWorker* pWorker = worker[i];
+		tasks.run([pWorker] { (*pWorker)(); });
 	}
 
 	NodeArray<int> bestPos;
-	master.doWorkHelper(pCrossMin, pCrossMinSimDraw, levels, bestPos, m_permuteFirst, rng);
+	BilayerCrossingCounter counter;
+	master.doWorkHelper(pCrossMin, pCrossMinSimDraw, levels, bestPos, counter, m_permuteFirst, rng);
 
-	for (unsigned int i = 0; i < nThreads - 1; ++i) {
-		thread[i].join();
-	}
+	tasks.wait();
 
 	master.restore(levels, m_nCrossings);
+	for (int cr : master.crossingsPerRun()) {
+		m_crossingsPerRun.push(cr);
+	}
 
 	for (unsigned int i = 0; i < nThreads - 1; ++i) {
 		delete worker[i];
@@ -1349,6 +1608,8 @@ void SugiyamaLayout::call(ClusterGraphAttributes& AG) {
 	const Graph &G = AG.constGraph();
 #endif
 	const ClusterGraph& CG = AG.constClusterGraph();
+	m_crossingsPerRun.clear();
+	const int64_t stopTime = stopTimeOfCall(*this);
 #if 0
 	if (G.numberOfNodes() == 0) {
 		os << "Empty graph." << std::endl;
@@ -1482,7 +1743,9 @@ void SugiyamaLayout::call(ClusterGraphAttributes& AG) {
 #endif
 
 	// 2. Phase: Crossing Reduction
+	m_crossMinStopTime = stopTime;
 	reduceCrossings(H);
+	m_crossMinStopTime = -1;
 #if 0
 	os << "\nLayers:\n";
 	for(int i = 0; i < H.numberOfLayers(); ++i) {
@@ -1550,6 +1813,10 @@ void SugiyamaLayout::reduceCrossings(ExtendedNestingGraph& H) {
 				--nFails;
 			}
 
+			if (stopTimeReached(m_crossMinStopTime)) {
+				break;
+			}
+
 			// bottom-up traversal
 			nCrossingsNew = traverseBottomUp(H);
 
@@ -1567,9 +1834,11 @@ void SugiyamaLayout::reduceCrossings(ExtendedNestingGraph& H) {
 				--nFails;
 			}
 
-		} while (nFails > 0);
+		} while (nFails > 0 && !stopTimeReached(m_crossMinStopTime));
 
-		if (m_nCrossingsCluster.isZero() || i >= m_runs) {
+		// with a time limit, runs are started until it is exceeded
+		bool lastRun = m_crossMinStopTime >= 0 ? stopTimeReached(m_crossMinStopTime) : i >= m_runs;
+		if (m_nCrossingsCluster.isZero() || lastRun) {
 			break;
 		}
 
@@ -41,6 +41,7 @@
 #include <ogdf/basic/SList.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/geometry.h>
+#include <ogdf/graphalg/MinCostFlowModule.h>
 #include <ogdf/graphalg/MinCostFlowReinelt.h>
 #include <ogdf/orthogonal/CompactionConstraintGraph.h>
 #include <ogdf/orthogonal/FlowCompaction.h>
@@ -83,7 +84,8 @@ void writeGridDrawing(const char* name, PlanRep& PG, GridLayoutMapped& drawing)
 }
 
 // constructor
-FlowCompaction::FlowCompaction(int maxImprovementSteps, int costGen, int costAssoc) {
+FlowCompaction::FlowCompaction(int maxImprovementSteps, int costGen, int costAssoc)
+	: m_minCostFlowComputer(new MinCostFlowReinelt<int>) {
 	m_maxImprovementSteps = maxImprovementSteps;
 	m_costGen = costGen;
 	m_costAssoc = costAssoc;
@@ -391,9 +393,9 @@ void FlowCompaction::computeCoords(CompactionConstraintGraph<int>& D, NodeArray<
 	}
 
 
-	MinCostFlowReinelt<int> mcf;
+	MinCostFlowModule<int>& mcf = *m_minCostFlowComputer;
 
-	const int infinity = mcf.infinity();
+	const int infinity = std::numeric_limits<int>::max();
 
 	NodeArray<int> supply(dual, 0);
 	EdgeArray<int> lowerBound(dual), upperBound(dual, infinity);
@@ -38,13 +38,14 @@
 #include <ogdf/basic/SList.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/exceptions.h>
-#include <ogdf/graphalg/MinCostFlowReinelt.h>
+#include <ogdf/graphalg/MinCostFlowModule.h>
 #include <ogdf/orthogonal/OrthoRep.h>
 #include <ogdf/orthogonal/OrthoShaper.h>
 #include <ogdf/planarity/PlanRep.h>
 #include <ogdf/uml/PlanRepUML.h>
 
 #include <algorithm>
+#include <limits>
 #include <ostream>
 #include <string>
 
@@ -72,8 +73,8 @@ void OrthoShaper::call(PlanRepUML& PG, CombinatorialEmbedding& E, OrthoRep& OR,
 
 
 	// the min cost flow we use
-	MinCostFlowReinelt<int> flowModule;
-	const int infinity = flowModule.infinity();
+	MinCostFlowModule<int>& flowModule = *m_minCostFlowComputer;
+	const int infinity = std::numeric_limits<int>::max();
 
 
 	//fix some values depending on traditional or progressive mode
@@ -1534,8 +1535,8 @@ void OrthoShaper::call(PlanRep& PG, CombinatorialEmbedding& E, OrthoRep& OR, boo
 
 
 	// the min cost flow we use
-	MinCostFlowReinelt<int> flowModule;
-	const int infinity = flowModule.infinity();
+	MinCostFlowModule<int>& flowModule = *m_minCostFlowComputer;
+	const int infinity = std::numeric_limits<int>::max();
 
 
 	//fix some values depending on traditional or progressive mode
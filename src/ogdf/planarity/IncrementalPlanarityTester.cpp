@@ -0,0 +1,324 @@
+/** \file
+ * \brief Implementation of IncrementalPlanarityTester
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/DisjointSets.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/SList.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/extended_graph_alg.h>
+#include <ogdf/decomposition/BCTree.h>
+#include <ogdf/planarity/BoyerMyrvold.h>
+#include <ogdf/planarity/IncrementalPlanarityTester.h>
+
+namespace ogdf {
+
+void IncrementalPlanarityTester::init(const Graph& G, const List<edge>& initialEdges,
+		const List<edge>& insertionOrder) {
+	m_rigid.init();
+	m_forest.reset();
+	m_subgraph.clear();
+	m_rigidOnPath.clear();
+	m_splitNode = nullptr;
+
+	m_pGraph = &G;
+	m_contained.init(G, false);
+	m_copy.init(G);
+
+	DisjointSets<> components(max(G.numberOfNodes(), 1));
+	NodeArray<int> component(G);
+	for (node v : G.nodes) {
+		m_copy[v] = m_subgraph.newNode();
+		component[v] = components.makeSet();
+	}
+
+	// self-loops and multi-edges do not matter for planarity
+	auto add = [&](edge e) {
+		m_contained[e] = true;
+		node u = m_copy[e->source()];
+		node v = m_copy[e->target()];
+		if (u != v && m_subgraph.searchEdge(u, v) == nullptr) {
+			m_subgraph.newEdge(u, v);
+		}
+	};
+
+	for (edge e : initialEdges) {
+		components.quickUnion(component[e->source()], component[e->target()]);
+		add(e);
+	}
+
+	// edges joining two connected components of the subgraph can be added right away
+	auto connect = [&](edge e) {
+		if (!m_contained[e]
+				&& components.quickUnion(component[e->source()], component[e->target()])) {
+			add(e);
+		}
+	};
+	for (edge e : insertionOrder) {
+		connect(e);
+	}
+	for (edge e : G.edges) {
+		connect(e);
+	}
+
+	// the remaining connected components are those of G
+	node first = G.firstNode();
+	for (node v : G.nodes) {
+		if (components.quickUnion(component[first], component[v])) {
+			m_subgraph.newEdge(m_copy[first], m_copy[v]);
+		}
+	}
+
+	if (first != nullptr) {
+		m_forest.reset(new DynamicSPQRForest(m_subgraph));
+		m_rigid.init(m_forest->spqrTree());
+	}
+}
+
+void IncrementalPlanarityTester::initWithout(const Graph& G, const List<edge>& deleted) {
+	EdgeArray<bool> isDeleted(G, false);
+	for (edge e : deleted) {
+		isDeleted[e] = true;
+	}
+	List<edge> kept;
+	for (edge e : G.edges) {
+		if (!isDeleted[e]) {
+			kept.pushBack(e);
+		}
+	}
+	init(G, kept, deleted);
+}
+
+bool IncrementalPlanarityTester::isPlanarWith(edge e) {
+	return m_contained[e] || test(m_copy[e->source()], m_copy[e->target()]);
+}
+
+bool IncrementalPlanarityTester::insert(edge e) {
+	if (m_contained[e]) {
+		return true;
+	}
+	node u = m_copy[e->source()];
+	node v = m_copy[e->target()];
+	if (!test(u, v)) {
+		return false;
+	}
+	m_contained[e] = true;
+
+	if (u != v && m_subgraph.searchEdge(u, v) == nullptr) {
+		int maxEdgeIndex = m_forest->auxiliaryGraph().maxEdgeIndex();
+		m_forest->updateInsertedEdge(m_subgraph.newEdge(u, v));
+		updateRigidSkeletons(maxEdgeIndex);
+	}
+	return true;
+}
+
+bool IncrementalPlanarityTester::test(node u, node v) {
+	m_rigidOnPath.clear();
+	m_splitNode = nullptr;
+	if (u == v || m_subgraph.searchEdge(u, v) != nullptr) {
+		return true;
+	}
+
+	SList<node>& pathB = m_forest->findPath(u, v);
+	bool planar = true;
+	int numberOfBlocks = 0;
+	node prevB = nullptr;
+	for (SListIterator<node> itB = pathB.begin(); planar && itB.valid(); ++itB) {
+		node vB = *itB;
+		SListIterator<node> nextB = itB.succ();
+		if (m_forest->typeOfBNode(vB) == BCTree::BNodeType::BComp) {
+			++numberOfBlocks;
+			if (m_forest->numberOfEdges(vB) > 2) {
+				node sH = prevB ? m_forest->cutVertex(prevB, vB) : m_forest->repVertex(u, vB);
+				node tH = nextB.valid() ? m_forest->cutVertex(*nextB, vB)
+										: m_forest->repVertex(v, vB);
+				planar = testBlock(sH, tH);
+			}
+		}
+		prevB = vB;
+	}
+	delete &pathB;
+
+	if (!planar || numberOfBlocks != 1) {
+		m_splitNode = nullptr;
+	}
+	return planar;
+}
+
+bool IncrementalPlanarityTester::testBlock(node sH, node tH) {
+	SList<node>& pathT = m_forest->findPathSPQR(sH, tH);
+	bool planar = true;
+	node prevT = nullptr;
+	for (SListIterator<node> itT = pathT.begin(); planar && itT.valid(); ++itT) {
+		node vT = *itT;
+		SListIterator<node> nextT = itT.succ();
+		if (m_forest->typeOfTNode(vT) == DynamicSPQRForest::TNodeType::RComp) {
+			m_rigidOnPath.push(vT);
+
+			Representative a, b;
+			if (prevT == nullptr) {
+				a.v = sH;
+			} else {
+				a.e = m_forest->virtualEdge(prevT, vT);
+			}
+			if (nextT.valid()) {
+				b.e = m_forest->virtualEdge(*nextT, vT);
+			} else {
+				b.v = tH;
+			}
+
+			adjEntry adjA, adjB;
+			planar = commonFace(rigidSkeleton(vT), a, b, adjA, adjB);
+			if (planar && prevT == nullptr && !nextT.valid()) {
+				m_splitNode = vT;
+				m_splitSource = adjA;
+				m_splitTarget = adjB;
+			}
+		}
+		prevT = vT;
+	}
+	delete &pathT;
+	return planar;
+}
+
+IncrementalPlanarityTester::RigidSkeleton& IncrementalPlanarityTester::rigidSkeleton(node vT) {
+	std::unique_ptr<RigidSkeleton>& R = m_rigid[vT];
+	if (R) {
+		return *R;
+	}
+
+	R.reset(new RigidSkeleton);
+	for (edge eH : m_forest->hEdgesSPQR(vT)) {
+		node ends[2] = {eH->source(), eH->target()};
+		for (node vH : ends) {
+			if (!R->skeletonNode.isDefined(vH)) {
+				R->skeletonNode[vH] = R->graph.newNode();
+			}
+		}
+		R->skeletonEdge[eH] =
+				R->graph.newEdge(R->skeletonNode[eH->source()], R->skeletonNode[eH->target()]);
+	}
+
+	// the skeleton is triconnected and planar, since the subgraph is
+#ifdef OGDF_DEBUG
+	bool planar =
+#endif
+			ogdf::planarEmbed(R->graph);
+	OGDF_ASSERT(planar);
+
+	R->embedding.init(R->graph);
+	R->stamp.init(R->embedding, 0);
+	return *R;
+}
+
+bool IncrementalPlanarityTester::commonFace(RigidSkeleton& R, const Representative& a,
+		const Representative& b, adjEntry& adjA, adjEntry& adjB) {
+	// calls pred for the adjacency entries whose right faces contain rep until it returns true
+	auto find = [&R](const Representative& rep, auto pred) -> adjEntry {
+		if (rep.v != nullptr) {
+			for (adjEntry adj : R.skeletonNode[rep.v]->adjEntries) {
+				if (pred(adj)) {
+					return adj;
+				}
+			}
+		} else {
+			edge e = R.skeletonEdge[rep.e];
+			if (pred(e->adjSource())) {
+				return e->adjSource();
+			}
+			if (pred(e->adjTarget())) {
+				return e->adjTarget();
+			}
+		}
+		return nullptr;
+	};
+
+	int stamp = ++R.currentStamp;
+	find(a, [&](adjEntry adj) {
+		R.stamp[R.embedding.rightFace(adj)] = stamp;
+		return false;
+	});
+	adjB = find(b, [&](adjEntry adj) { return R.stamp[R.embedding.rightFace(adj)] == stamp; });
+	if (adjB == nullptr) {
+		return false;
+	}
+
+	face f = R.embedding.rightFace(adjB);
+	adjA = find(a, [&](adjEntry adj) { return R.embedding.rightFace(adj) == f; });
+	return true;
+}
+
+void IncrementalPlanarityTester::updateRigidSkeletons(int maxEdgeIndex) {
+	const Graph& H = m_forest->auxiliaryGraph();
+	edge lastH = H.lastEdge();
+
+	// an edge inserted into a single R-node splits the common face of its endpoints
+	if (lastH->index() > maxEdgeIndex
+			&& (lastH->pred() == nullptr || lastH->pred()->index() <= maxEdgeIndex)
+			&& m_splitNode != nullptr && m_forest->spqrproper(lastH) == m_splitNode
+			&& m_rigid[m_splitNode]) {
+		RigidSkeleton& R = *m_rigid[m_splitNode];
+		edge e = R.embedding.splitFace(m_splitSource, m_splitTarget);
+		R.skeletonEdge[lastH] = e;
+		R.stamp[R.embedding.rightFace(e->adjSource())] = 0;
+		R.stamp[R.embedding.rightFace(e->adjTarget())] = 0;
+		return;
+	}
+
+	// otherwise, the skeletons on the paths have changed
+	for (node vT : m_rigidOnPath) {
+		m_rigid[vT].reset();
+	}
+	for (edge eH = lastH; eH != nullptr && eH->index() > maxEdgeIndex; eH = eH->pred()) {
+		node vT = m_forest->spqrproper(eH);
+		if (vT != nullptr) {
+			m_rigid[vT].reset();
+		}
+	}
+}
+
+bool IncrementalPlanarityTester::isPlanar(const Graph& G) {
+	init(G);
+	for (edge e : G.edges) {
+		if (!insert(e)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool IncrementalPlanarityTester::planarEmbed(Graph& G) {
+	return isPlanar(G) && planarEmbedPlanarGraph(G);
+}
+
+bool IncrementalPlanarityTester::planarEmbedPlanarGraph(Graph& G) {
+	return BoyerMyrvold().planarEmbedPlanarGraph(G);
+}
+
+}
@@ -0,0 +1,423 @@
+/** \file
+ * \brief Implementation of PlanarityTester
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/planarity/PlanarityTester.h>
+
+#include <utility>
+#include <vector>
+
+namespace ogdf {
+
+bool PlanarityTester::isPlanar(const Graph& G) {
+	// less than 9 edges are always planar
+	if (G.numberOfEdges() < 9) {
+		return true;
+	}
+
+	m_numNodes = G.numberOfNodes();
+	m_nodeIndex.resize(G.maxNodeIndex() + 1);
+	int i = 0;
+	for (node v : G.nodes) {
+		m_nodeIndex[v->index()] = i++;
+	}
+
+	m_endpoints.clear();
+	for (edge e : G.edges) {
+		if (!e->isSelfLoop()) {
+			m_endpoints.push_back(m_nodeIndex[e->source()->index()]);
+			m_endpoints.push_back(m_nodeIndex[e->target()->index()]);
+		}
+	}
+	return test();
+}
+
+bool PlanarityTester::isPlanar(int numberOfNodes, const std::vector<std::pair<int, int>>& edges) {
+	if (edges.size() < 9) {
+		return true;
+	}
+
+	m_numNodes = numberOfNodes;
+	m_endpoints.clear();
+	for (const std::pair<int, int>& e : edges) {
+		OGDF_ASSERT(e.first >= 0);
+		OGDF_ASSERT(e.first < numberOfNodes);
+		OGDF_ASSERT(e.second >= 0);
+		OGDF_ASSERT(e.second < numberOfNodes);
+		if (e.first != e.second) {
+			m_endpoints.push_back(e.first);
+			m_endpoints.push_back(e.second);
+		}
+	}
+	return test();
+}
+
+bool PlanarityTester::test() {
+	if (m_endpoints.size() < 2 * 9) {
+		return true;
+	}
+
+	const int numEdges = buildAdjacency();
+	if (numEdges < 9) {
+		return true;
+	}
+	// Euler's formula for simple graphs
+	if (numEdges > 3 * m_numNodes - 6) {
+		return false;
+	}
+
+	orient();
+	sortByNestingDepth();
+	return testOrientation();
+}
+
+int PlanarityTester::buildAdjacency() {
+	const int n = m_numNodes;
+	int m = static_cast<int>(m_endpoints.size()) / 2;
+
+	// Two passes: the first one finds the multi-edges, the second one builds the
+	// adjacency arrays of the remaining edges.
+	for (int pass = 0; pass < 2; ++pass) {
+		m_first.assign(n + 1, 0);
+		for (int i = 0; i < 2 * m; ++i) {
+			++m_first[m_endpoints[i] + 1];
+		}
+		for (int v = 0; v < n; ++v) {
+			m_first[v + 1] += m_first[v];
+		}
+
+		m_iter.assign(m_first.begin(), m_first.end() - 1);
+		m_arcHead.resize(2 * m);
+		m_arcEdge.resize(2 * m);
+		for (int i = 0; i < m; ++i) {
+			const int u = m_endpoints[2 * i];
+			const int v = m_endpoints[2 * i + 1];
+			const int a = m_iter[u]++;
+			const int b = m_iter[v]++;
+			m_arcHead[a] = v;
+			m_arcEdge[a] = i;
+			m_arcHead[b] = u;
+			m_arcEdge[b] = i;
+		}
+
+		if (pass == 0) {
+			// keep one edge per pair of adjacent nodes
+			m_mark.assign(n, -1);
+			m = 0;
+			for (int v = 0; v < n; ++v) {
+				for (int a = m_first[v]; a < m_first[v + 1]; ++a) {
+					const int w = m_arcHead[a];
+					if (w > v && m_mark[w] != v) {
+						m_mark[w] = v;
+						m_endpoints[2 * m] = v;
+						m_endpoints[2 * m + 1] = w;
+						++m;
+					}
+				}
+			}
+			m_endpoints.resize(2 * m);
+		}
+	}
+
+	return m;
+}
+
+void PlanarityTester::orient() {
+	const int n = m_numNodes;
+	const int m = static_cast<int>(m_endpoints.size()) / 2;
+
+	m_height.assign(n, -1);
+	m_parentEdge.assign(n, -1);
+	m_iter.assign(m_first.begin(), m_first.end() - 1);
+	m_source.assign(m, -1);
+	m_target.resize(m);
+	m_lowpt.resize(m);
+	m_lowpt2.resize(m);
+	m_nestingDepth.resize(m);
+	m_roots.clear();
+	m_dfsStack.clear();
+
+	for (int r = 0; r < n; ++r) {
+		if (m_height[r] >= 0 || m_first[r] == m_first[r + 1]) {
+			continue;
+		}
+		m_height[r] = 0;
+		m_roots.push_back(r);
+		m_dfsStack.push_back(r);
+
+		while (!m_dfsStack.empty()) {
+			const int v = m_dfsStack.back();
+			const int e = m_parentEdge[v];
+			bool descended = false;
+
+			for (int& a = m_iter[v]; a < m_first[v + 1]; ++a) {
+				const int ei = m_arcEdge[a];
+				const int w = m_arcHead[a];
+				if (m_source[ei] < 0) {
+					m_source[ei] = v;
+					m_target[ei] = w;
+					m_lowpt[ei] = m_lowpt2[ei] = m_height[v];
+					if (m_height[w] < 0) {
+						// tree edge, finished when we return to v
+						m_parentEdge[w] = ei;
+						m_height[w] = m_height[v] + 1;
+						m_dfsStack.push_back(w);
+						descended = true;
+						break;
+					}
+					// back edge
+					m_lowpt[ei] = m_height[w];
+				} else if (m_source[ei] != v) {
+					// already oriented towards v
+					continue;
+				}
+
+				m_nestingDepth[ei] = 2 * m_lowpt[ei] + (m_lowpt2[ei] < m_height[v] ? 1 : 0);
+
+				if (e >= 0) {
+					if (m_lowpt[ei] < m_lowpt[e]) {
+						m_lowpt2[e] = min(m_lowpt[e], m_lowpt2[ei]);
+						m_lowpt[e] = m_lowpt[ei];
+					} else if (m_lowpt[ei] > m_lowpt[e]) {
+						m_lowpt2[e] = min(m_lowpt2[e], m_lowpt[ei]);
+					} else {
+						m_lowpt2[e] = min(m_lowpt2[e], m_lowpt2[ei]);
+					}
+				}
+			}
+
+			if (!descended) {
+				m_dfsStack.pop_back();
+			}
+		}
+	}
+}
+
+void PlanarityTester::sortByNestingDepth() {
+	const int n = m_numNodes;
+	const int m = static_cast<int>(m_endpoints.size()) / 2;
+
+	// bucket sort by nesting depth, which is less than 2n, into m_ref ...
+	m_bucket.assign(2 * n + 1, 0);
+	for (int ei = 0; ei < m; ++ei) {
+		++m_bucket[m_nestingDepth[ei] + 1];
+	}
+	for (int d = 0; d < 2 * n; ++d) {
+		m_bucket[d + 1] += m_bucket[d];
+	}
+	m_ref.resize(m);
+	for (int ei = 0; ei < m; ++ei) {
+		m_ref[m_bucket[m_nestingDepth[ei]]++] = ei;
+	}
+
+	// ... and distribute the edges stably to their sources
+	m_orderedFirst.assign(n + 1, 0);
+	for (int ei = 0; ei < m; ++ei) {
+		++m_orderedFirst[m_source[ei] + 1];
+	}
+	for (int v = 0; v < n; ++v) {
+		m_orderedFirst[v + 1] += m_orderedFirst[v];
+	}
+	m_iter.assign(m_orderedFirst.begin(), m_orderedFirst.end() - 1);
+	m_ordered.resize(m);
+	for (int ei : m_ref) {
+		m_ordered[m_iter[m_source[ei]]++] = ei;
+	}
+}
+
+bool PlanarityTester::testOrientation() {
+	const int m = static_cast<int>(m_endpoints.size()) / 2;
+
+	m_ref.assign(m, -1);
+	m_lowptEdge.resize(m);
+	m_stackBottom.resize(m);
+	m_iter.assign(m_orderedFirst.begin(), m_orderedFirst.end() - 1);
+	m_conflicts.clear();
+	m_nextId = 0;
+	m_dfsStack.clear();
+
+	for (int r : m_roots) {
+		m_dfsStack.push_back(r);
+
+		while (!m_dfsStack.empty()) {
+			const int v = m_dfsStack.back();
+
+			if (m_iter[v] < m_orderedFirst[v + 1]) {
+				const int ei = m_ordered[m_iter[v]];
+				const int w = m_target[ei];
+				m_stackBottom[ei] = topId();
+
+				if (ei == m_parentEdge[w]) {
+					// tree edge, integrated when w is finished
+					m_dfsStack.push_back(w);
+					continue;
+				}
+
+				// back edge
+				m_lowptEdge[ei] = ei;
+				ConflictPair P;
+				P.right.low = P.right.high = ei;
+				P.id = m_nextId++;
+				m_conflicts.push_back(P);
+				if (!integrate(v, ei)) {
+					return false;
+				}
+				++m_iter[v];
+
+			} else {
+				m_dfsStack.pop_back();
+				const int e = m_parentEdge[v];
+				if (e >= 0) {
+					const int u = m_source[e];
+					trimBackEdges(u);
+					if (!integrate(u, e)) {
+						return false;
+					}
+					++m_iter[u];
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+bool PlanarityTester::integrate(int v, int ei) {
+	if (m_lowpt[ei] < m_height[v]) {
+		// ei has a return edge
+		const int e = m_parentEdge[v];
+		if (m_iter[v] == m_orderedFirst[v]) {
+			m_lowptEdge[e] = m_lowptEdge[ei];
+		} else {
+			return addConstraints(ei, e);
+		}
+	}
+	return true;
+}
+
+bool PlanarityTester::addConstraints(int ei, int e) {
+	ConflictPair P;
+
+	// merge return edges of ei into P.right
+	do {
+		ConflictPair Q = m_conflicts.back();
+		m_conflicts.pop_back();
+		if (!Q.left.empty()) {
+			std::swap(Q.left, Q.right);
+		}
+		if (!Q.left.empty()) {
+			return false;
+		}
+		if (m_lowpt[Q.right.low] > m_lowpt[e]) {
+			// merge intervals
+			if (P.right.empty()) {
+				P.right = Q.right;
+			} else {
+				m_ref[P.right.low] = Q.right.high;
+			}
+			P.right.low = Q.right.low;
+		} else {
+			// align
+			m_ref[Q.right.low] = m_lowptEdge[e];
+		}
+	} while (topId() != m_stackBottom[ei]);
+
+	// merge conflicting return edges of the previous siblings of ei into P.left
+	while (!m_conflicts.empty()
+			&& (conflicting(m_conflicts.back().left, ei)
+					|| conflicting(m_conflicts.back().right, ei))) {
+		ConflictPair Q = m_conflicts.back();
+		m_conflicts.pop_back();
+		if (conflicting(Q.right, ei)) {
+			std::swap(Q.left, Q.right);
+		}
+		if (conflicting(Q.right, ei)) {
+			return false;
+		}
+
+		// merge interval below lowpt(ei) into P.right
+		if (P.right.low >= 0) {
+			m_ref[P.right.low] = Q.right.high;
+		}
+		if (Q.right.low >= 0) {
+			P.right.low = Q.right.low;
+		}
+
+		if (P.left.empty()) {
+			P.left = Q.left;
+		} else {
+			m_ref[P.left.low] = Q.left.high;
+		}
+		P.left.low = Q.left.low;
+	}
+
+	if (!P.left.empty() || !P.right.empty()) {
+		P.id = m_nextId++;
+		m_conflicts.push_back(P);
+	}
+	return true;
+}
+
+void PlanarityTester::trimBackEdges(int u) {
+	// drop entire conflict pairs
+	while (!m_conflicts.empty() && lowest(m_conflicts.back()) == m_height[u]) {
+		m_conflicts.pop_back();
+	}
+
+	if (m_conflicts.empty()) {
+		return;
+	}
+
+	// one more conflict pair to consider
+	ConflictPair& P = m_conflicts.back();
+
+	// trim left interval
+	while (P.left.high >= 0 && m_target[P.left.high] == u) {
+		P.left.high = m_ref[P.left.high];
+	}
+	if (P.left.high < 0 && P.left.low >= 0) {
+		// just emptied
+		m_ref[P.left.low] = P.right.low;
+		P.left.low = -1;
+	}
+
+	// trim right interval
+	while (P.right.high >= 0 && m_target[P.right.high] == u) {
+		P.right.high = m_ref[P.right.high];
+	}
+	if (P.right.high < 0 && P.right.low >= 0) {
+		// just emptied
+		m_ref[P.right.low] = P.left.low;
+		P.right.low = -1;
+	}
+}
+
+}
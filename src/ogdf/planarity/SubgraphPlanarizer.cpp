@@ -38,14 +38,17 @@
 #include <ogdf/basic/SList.h>
 #include <ogdf/basic/System.h>
 #include <ogdf/basic/Thread.h>
+#include <ogdf/basic/ThreadPool.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/extended_graph_alg.h>
+#include <ogdf/basic/simple_graph_alg.h>
 #include <ogdf/planarity/CrossingMinimizationModule.h>
 #include <ogdf/planarity/EdgeInsertionModule.h>
 #include <ogdf/planarity/PlanRep.h>
 #include <ogdf/planarity/PlanRepLight.h>
 #include <ogdf/planarity/PlanarSubgraphFast.h>
 #include <ogdf/planarity/PlanarSubgraphModule.h>
+#include <ogdf/planarity/PlanarityTester.h>
 #include <ogdf/planarity/RemoveReinsertType.h>
 #include <ogdf/planarity/SubgraphPlanarizer.h>
 #include <ogdf/planarity/VariableEmbeddingInserter.h>
@@ -60,6 +63,7 @@
 #include <mutex>
 #include <random>
 #include <utility>
+#include <vector>
 
 using std::atomic;
 using std::lock_guard;
@@ -134,6 +138,16 @@ private:
 	Worker& operator=(const Worker& other); // = delete
 };
 
+struct SubgraphPlanarizer::Block {
+	Graph graph; //!< The block.
+	EdgeArray<edge> original; //!< Maps the edges of #graph to the original graph.
+	std::unique_ptr<PlanRep> planRep; //!< The planarization of #graph.
+	int crossingNumber = 0;
+	ReturnType result = ReturnType::Error;
+
+	Block() : original(graph) { }
+};
+
 SubgraphPlanarizer::ThreadMaster::ThreadMaster(const PlanRep& pr, int cc, const EdgeArray<int>* pCost,
 		const EdgeArray<bool>* pForbid, const EdgeArray<uint32_t>* pEdgeSubGraphs,
 		const List<edge>& delEdges, int seed, int perms, int64_t stopTime)
@@ -300,7 +314,8 @@ Module::ReturnType SubgraphPlanarizer::doCall(PlanRep& pr, int cc, const EdgeArr
 	PlanarSubgraphModule<int>& subgraph = *m_subgraph;
 	EdgeInsertionModule& inserter = *m_inserter;
 
-	unsigned int nThreads = min(m_maxThreads, (unsigned int)m_permutations);
+	unsigned int nThreads =
+			ThreadPool::global().threadBudget(min(m_maxThreads, (unsigned int)m_permutations));
 
 	int64_t startTime;
 	System::usedRealTime(startTime);
@@ -315,6 +330,14 @@ Module::ReturnType SubgraphPlanarizer::doCall(PlanRep& pr, int cc, const EdgeArr
 
 	pr.initCC(cc);
 
+	ReturnType blockResult;
+	if (doCallBlocks(pr, cc, pCostOrig, pForbiddenOrig, pEdgeSubGraphs, stopTime, blockResult)) {
+		if (isSolution(blockResult)) {
+			crossingNumber = finishPlanarization(pr, pCostOrig, pEdgeSubGraphs);
+		}
+		return blockResult;
+	}
+
 	List<edge> delEdges;
 	ReturnType retValue;
 
@@ -356,17 +379,18 @@ Module::ReturnType SubgraphPlanarizer::doCall(PlanRep& pr, int cc, const EdgeArr
 		ThreadMaster master(pr, cc, pCostOrig, pForbiddenOrig, pEdgeSubGraphs, delEdges, seed,
 				m_permutations - nThreads, stopTime);
 
+		ThreadPool::TaskGroup tasks(nThreads);
 		Array<Worker*> worker(nThreads - 1);
-		Array<Thread> thread(nThreads - 1);
 		for (unsigned int i = 0; i < nThreads - 1; ++i) {
 			worker[i] = new Worker(i, &master, inserter.clone());
-			thread[i] = Thread(*worker[i]);
+			Worker* pWorker = worker[i];
+			tasks.run([pWorker] { (*pWorker)(); });
 		}
 
 		doWorkHelper(master, inserter, rng);
 
+		tasks.wait();
 		for (unsigned int i = 0; i < nThreads - 1; ++i) {
-			thread[i].join();
 			delete worker[i];
 		}
 
@@ -410,6 +434,137 @@ Module::ReturnType SubgraphPlanarizer::doCall(PlanRep& pr, int cc, const EdgeArr
 		OGDF_ASSERT(isPlanar(pr));
 	}
 
+	crossingNumber = finishPlanarization(pr, pCostOrig, pEdgeSubGraphs);
+	return ReturnType::Feasible;
+}
+
+bool SubgraphPlanarizer::doCallBlocks(PlanRep& pr, int cc, const EdgeArray<int>* pCostOrig,
+		const EdgeArray<bool>* pForbiddenOrig, const EdgeArray<uint32_t>* pEdgeSubGraphs,
+		int64_t stopTime, ReturnType& result) {
+	EdgeArray<int> component(pr);
+	const int numberOfBlocks = biconnectedComponents(pr, component);
+	if (numberOfBlocks < 2) {
+		return false;
+	}
+
+	Array<SListPure<edge>> blockEdges(numberOfBlocks);
+	for (edge e : pr.edges) {
+		blockEdges[component[e]].pushBack(e);
+	}
+
+	// copy the blocks that may be non-planar, i.e., have at least 9 edges
+	std::vector<std::unique_ptr<Block>> blocks;
+	NodeArray<node> copy(pr);
+	NodeArray<int> copiedFor(pr, -1);
+	for (int i = 0; i < numberOfBlocks; ++i) {
+		if (blockEdges[i].size() < 9) {
+			continue;
+		}
+		Block* pBlock = new Block;
+		blocks.emplace_back(pBlock);
+		for (edge e : blockEdges[i]) {
+			for (node v : e->nodes()) {
+				if (copiedFor[v] != i) {
+					copiedFor[v] = i;
+					copy[v] = pBlock->graph.newNode();
+				}
+			}
+			edge eBlock = pBlock->graph.newEdge(copy[e->source()], copy[e->target()]);
+			pBlock->original[eBlock] = pr.original(e);
+		}
+	}
+
+	if (blocks.size() < 2) {
+		return false;
+	}
+
+	std::vector<const Graph*> graphs;
+	for (const std::unique_ptr<Block>& pBlock : blocks) {
+		graphs.push_back(&pBlock->graph);
+	}
+	Array<bool> planar;
+	PlanarityTester::isPlanarBatch(graphs.begin(), graphs.end(), planar, m_maxThreads);
+
+	int numberOfNonPlanar = 0;
+	for (int i = 0; i < planar.size(); ++i) {
+		if (!planar[i]) {
+			blocks[numberOfNonPlanar++] = std::move(blocks[i]);
+		}
+	}
+	if (numberOfNonPlanar < 2) {
+		return false;
+	}
+	blocks.resize(numberOfNonPlanar);
+
+	// large blocks first for a better load balance
+	std::sort(blocks.begin(), blocks.end(),
+			[](const std::unique_ptr<Block>& a, const std::unique_ptr<Block>& b) {
+				return a->graph.numberOfEdges() > b->graph.numberOfEdges();
+			});
+
+	const int numTasks = min(
+			static_cast<int>(ThreadPool::global().threadBudget(m_maxThreads)), numberOfNonPlanar);
+	std::atomic<int> next(0);
+	ThreadPool::global().parallelFor(0, numTasks, numTasks, [&](int) {
+		SubgraphPlanarizer planarizer(*this);
+		if (numTasks > 1) {
+			planarizer.maxThreads(1);
+		}
+
+		for (int i = next++; i < numberOfNonPlanar; i = next++) {
+			Block& B = *blocks[i];
+			if (stopTime >= 0) {
+				planarizer.timeLimit(max(0.0, (stopTime - System::realTime()) / 1000.0));
+			}
+
+			std::unique_ptr<EdgeArray<int>> pCost;
+			std::unique_ptr<EdgeArray<bool>> pForbidden;
+			std::unique_ptr<EdgeArray<uint32_t>> pSubGraphs;
+			if (pCostOrig) {
+				pCost.reset(new EdgeArray<int>(B.graph));
+			}
+			if (pForbiddenOrig) {
+				pForbidden.reset(new EdgeArray<bool>(B.graph));
+			}
+			if (pEdgeSubGraphs) {
+				pSubGraphs.reset(new EdgeArray<uint32_t>(B.graph));
+			}
+			for (edge e : B.graph.edges) {
+				edge eOrig = B.original[e];
+				if (pCostOrig) {
+					(*pCost)[e] = (*pCostOrig)[eOrig];
+				}
+				if (pForbiddenOrig) {
+					(*pForbidden)[e] = (*pForbiddenOrig)[eOrig];
+				}
+				if (pEdgeSubGraphs) {
+					(*pSubGraphs)[e] = (*pEdgeSubGraphs)[eOrig];
+				}
+			}
+
+			B.planRep.reset(new PlanRep(B.graph));
+			B.result = planarizer.call(*B.planRep, 0, B.crossingNumber, pCost.get(),
+					pForbidden.get(), pSubGraphs.get());
+		}
+	});
+
+	// merge the planarizations at the cut vertices
+	CrossingStructure cs;
+	cs.init(pr.original());
+	result = ReturnType::Feasible;
+	for (const std::unique_ptr<Block>& pBlock : blocks) {
+		if (!isSolution(pBlock->result)) {
+			result = pBlock->result;
+			return true;
+		}
+		cs.add(*pBlock->planRep, pBlock->original, pBlock->crossingNumber);
+	}
+	cs.restore(pr, cc);
+	return true;
+}
+
+int SubgraphPlanarizer::finishPlanarization(PlanRep& pr, const EdgeArray<int>* pCostOrig,
+		const EdgeArray<uint32_t>* pEdgeSubGraphs) {
 	// Remove pseudo crossings and recompute crossing number.
 #ifdef OGDF_DEBUG
 	bool planar =
@@ -417,9 +572,7 @@ Module::ReturnType SubgraphPlanarizer::doCall(PlanRep& pr, int cc, const EdgeArr
 			planarEmbed(pr);
 	OGDF_ASSERT(planar);
 	pr.removePseudoCrossings();
-	crossingNumber = computeCrossingNumber(pr, pCostOrig, pEdgeSubGraphs);
-
-	return ReturnType::Feasible;
+	return computeCrossingNumber(pr, pCostOrig, pEdgeSubGraphs);
 }
 
 }
@@ -65,6 +65,31 @@ void CrossingStructure::init(GraphCopy& PG, int weightedCrossingNumber) {
 	}
 }
 
+void CrossingStructure::init(const Graph& G) {
+	m_numCrossings = 0;
+	m_weightedCrossingNumber = 0;
+	m_crossings.init(G);
+}
+
+void CrossingStructure::add(const GraphCopy& PG, const EdgeArray<edge>& original,
+		int weightedCrossingNumber) {
+	m_weightedCrossingNumber += weightedCrossingNumber;
+
+	NodeArray<int> index(PG, -1);
+	for (node v : PG.nodes) {
+		if (PG.isDummy(v)) {
+			index[v] = m_numCrossings++;
+		}
+	}
+
+	for (edge e : PG.original().edges) {
+		ListConstIterator<edge> it = PG.chain(e).begin();
+		for (++it; it.valid(); ++it) {
+			m_crossings[original[e]].pushBack(index[(*it)->source()]);
+		}
+	}
+}
+
 void CrossingStructure::restore(PlanRep& PG, int cc) {
 	Array<node> id2Node(0, m_numCrossings - 1, nullptr);
 
@@ -37,6 +37,7 @@
 #include <ogdf/basic/Module.h>
 #include <ogdf/basic/System.h>
 #include <ogdf/basic/Thread.h>
+#include <ogdf/basic/ThreadPool.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/extended_graph_alg.h>
 #include <ogdf/planarity/MaximalPlanarSubgraphSimple.h>
@@ -289,7 +290,8 @@ Module::ReturnType SubgraphPlanarizerUML::doCall(PlanRepUML& pr, int cc,
 	PlanarSubgraphModule<int>& subgraph = *m_subgraph;
 	UMLEdgeInsertionModule& inserter = *m_inserter;
 
-	unsigned int nThreads = min(m_maxThreads, (unsigned int)m_permutations);
+	unsigned int nThreads =
+			ThreadPool::global().threadBudget(min(m_maxThreads, (unsigned int)m_permutations));
 
 	int64_t startTime;
 	System::usedRealTime(startTime);
@@ -349,17 +351,18 @@ Module::ReturnType SubgraphPlanarizerUML::doCall(PlanRepUML& pr, int cc,
 		//
 		ThreadMaster master(pr, cc, pCostOrig, delEdges, seed, m_permutations - nThreads, stopTime);
 
+		ThreadPool::TaskGroup tasks(nThreads);
 		Array<Worker*> worker(nThreads - 1);
-		Array<Thread> thread(nThreads - 1);
 		for (unsigned int i = 0; i < nThreads - 1; ++i) {
 			worker[i] = new Worker(i, &master, inserter.clone());
-			thread[i] = Thread(*worker[i]);
+			Worker* pWorker = worker[i];
+			tasks.run([pWorker] { (*pWorker)(); });
 		}
 
 		doWorkHelper(master, inserter, rng);
 
+		tasks.wait();
 		for (unsigned int i = 0; i < nThreads - 1; ++i) {
-			thread[i].join();
 			delete worker[i];
 		}
 
@@ -0,0 +1,145 @@
+/** \file
+ * \brief Compares the running times of MinCostFlowReinelt and MinCostFlowCostScaling.
+ *
+ * Usage: bench-min-cost-flow [n ...]
+ *
+ * For every given number of nodes n (default: 1000 5000 20000), the networks
+ * OrthoShaper solves for three random planar connected graphs with n nodes and
+ * 2n edges are solved by both algorithms. The total time of each algorithm is
+ * reported, and the program fails if the optimal costs differ.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/CombinatorialEmbedding.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/extended_graph_alg.h>
+#include <ogdf/basic/graph_generators/randomized.h>
+#include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/graphalg/MinCostFlowCostScaling.h>
+#include <ogdf/graphalg/MinCostFlowModule.h>
+#include <ogdf/graphalg/MinCostFlowReinelt.h>
+#include <ogdf/orthogonal/OrthoRep.h>
+#include <ogdf/orthogonal/OrthoShaper.h>
+#include <ogdf/planarity/PlanRep.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace ogdf;
+
+//! Solves every network with both algorithms and accumulates their running times.
+class TimingMinCostFlow : public MinCostFlowModule<int> {
+public:
+	using MinCostFlowModule<int>::call;
+
+	bool call(const Graph& G, const EdgeArray<int>& lowerBound, const EdgeArray<int>& upperBound,
+			const EdgeArray<int>& cost, const NodeArray<int>& supply, EdgeArray<int>& flow,
+			NodeArray<int>& dual) override {
+		EdgeArray<int> otherFlow(G);
+		NodeArray<int> otherDual(G);
+
+		auto start = std::chrono::steady_clock::now();
+		bool feasible = m_reinelt.call(G, lowerBound, upperBound, cost, supply, flow, dual);
+		auto stop = std::chrono::steady_clock::now();
+		timeReinelt += stop - start;
+
+		start = stop;
+		bool otherFeasible = m_costScaling.call(G, lowerBound, upperBound, cost, supply, otherFlow,
+				otherDual);
+		timeCostScaling += std::chrono::steady_clock::now() - start;
+
+		int value = 0, otherValue = 0;
+		if (feasible) {
+			checkComputedFlow(G, lowerBound, upperBound, cost, supply, flow, value);
+			checkComputedFlow(G, lowerBound, upperBound, cost, supply, otherFlow, otherValue);
+		}
+		if (otherFeasible != feasible || otherValue != value) {
+			std::cerr << "MinCostFlowCostScaling differs from MinCostFlowReinelt" << std::endl;
+			std::exit(EXIT_FAILURE);
+		}
+		++numberOfNetworks;
+		return feasible;
+	}
+
+	std::chrono::steady_clock::duration timeReinelt {0};
+	std::chrono::steady_clock::duration timeCostScaling {0};
+	int numberOfNetworks = 0;
+
+private:
+	MinCostFlowReinelt<int> m_reinelt;
+	MinCostFlowCostScaling<int> m_costScaling;
+};
+
+//! Returns \p d in milliseconds.
+static double milliseconds(std::chrono::steady_clock::duration d) {
+	return std::chrono::duration<double, std::milli>(d).count();
+}
+
+int main(int argc, char** argv) {
+	std::vector<int> sizes;
+	for (int i = 1; i < argc; ++i) {
+		sizes.push_back(std::atoi(argv[i]));
+	}
+	if (sizes.empty()) {
+		sizes = {1000, 5000, 20000};
+	}
+
+	std::cout << std::setw(9) << "n" << std::setw(11) << "networks" << std::setw(25)
+			  << "MinCostFlowReinelt [ms]" << std::setw(29) << "MinCostFlowCostScaling [ms]"
+			  << std::endl;
+
+	for (int n : sizes) {
+		TimingMinCostFlow* mcf = new TimingMinCostFlow;
+		OrthoShaper shaper;
+		shaper.setMinCostFlowComputer(mcf);
+
+		for (int i = 0; i < 3; ++i) {
+			// the first phase of OrthoLayout
+			Graph G;
+			randomPlanarConnectedGraph(G, n, 2 * n);
+			makeSimpleUndirected(G);
+			PlanRep PG(G);
+			PG.initCC(0);
+			planarEmbed(PG);
+			adjEntry adjExternal = PG.firstEdge()->adjSource();
+			PG.expand();
+			CombinatorialEmbedding E(PG);
+			E.setExternalFace(E.rightFace(adjExternal));
+			OrthoRep OR;
+			shaper.call(PG, E, OR);
+		}
+
+		std::cout << std::setw(9) << n << std::setw(11) << mcf->numberOfNetworks << std::setw(25)
+				  << std::fixed << std::setprecision(1) << milliseconds(mcf->timeReinelt)
+				  << std::setw(29) << milliseconds(mcf->timeCostScaling) << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,106 @@
+/** \file
+ * \brief Measures the time and memory needed for building Triconnectivity and StaticSPQRTree.
+ *
+ * Usage: bench-triconnectivity [n ...]
+ *
+ * For every given number of nodes n (default: 100000 300000 1000000), a random
+ * planar biconnected graph with n nodes and 3n/2 edges is decomposed. The
+ * reported peak memory is that of the whole process so far, so pass a single
+ * n for measuring the memory of one instance.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/System.h>
+#include <ogdf/basic/graph_generators/randomized.h>
+#include <ogdf/decomposition/StaticSPQRTree.h>
+#include <ogdf/graphalg/Triconnectivity.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#if defined(OGDF_SYSTEM_UNIX)
+#	include <sys/resource.h>
+#endif
+
+using namespace ogdf;
+
+//! Returns the maximum resident set size of the process in MiB.
+static double peakMiB() {
+#if defined(OGDF_SYSTEM_WINDOWS) || defined(__CYGWIN__)
+	return System::peakMemoryUsedByProcess() / (1024.0 * 1024.0);
+#else
+	rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+#	ifdef OGDF_SYSTEM_OSX
+	return usage.ru_maxrss / (1024.0 * 1024.0); // in bytes
+#	else
+	return usage.ru_maxrss / 1024.0; // in KiB
+#	endif
+#endif
+}
+
+int main(int argc, char** argv) {
+	std::vector<int> sizes;
+	for (int i = 1; i < argc; ++i) {
+		sizes.push_back(std::atoi(argv[i]));
+	}
+	if (sizes.empty()) {
+		sizes = {100000, 300000, 1000000};
+	}
+
+	std::cout << std::setw(9) << "n" << std::setw(10) << "m" << std::setw(22)
+			  << "Triconnectivity [ms]" << std::setw(16) << "peak RSS [MiB]" << std::setw(21)
+			  << "StaticSPQRTree [ms]" << std::setw(16) << "peak RSS [MiB]" << std::endl;
+
+	for (int n : sizes) {
+		Graph G;
+		randomPlanarBiconnectedGraph(G, n, 3 * n / 2);
+
+		int64_t t;
+		System::usedRealTime(t);
+		{
+			Triconnectivity tric(G);
+		}
+		const int64_t tricTime = System::usedRealTime(t);
+		const double tricMemory = peakMiB();
+
+		{
+			StaticSPQRTree spqr(G);
+		}
+		const int64_t spqrTime = System::usedRealTime(t);
+
+		std::cout << std::setw(9) << n << std::setw(10) << G.numberOfEdges() << std::setw(22)
+				  << tricTime << std::setw(16) << std::fixed << std::setprecision(1) << tricMemory
+				  << std::setw(21) << spqrTime << std::setw(16) << peakMiB() << std::endl;
+	}
+
+	return 0;
+}
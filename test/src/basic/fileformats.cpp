@@ -48,8 +48,10 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <limits>
@@ -914,6 +916,139 @@ void describeMatrixMarket() {
 			[] { describeFormat("MatrixMarket", GraphIO::readMatrixMarket, nullptr, false); });
 }
 
+void describeEdgeList() {
+	describe("EdgeList", [] {
+		describeFormat("EdgeList", GraphIO::readEdgeList, GraphIO::writeEdgeList, false);
+
+		it("reads the same graph from a file with several threads", [] {
+			Graph out;
+			randomSimpleGraph(out, 10000, 50000);
+			const string filename = "edgelist-parallel.edgelist";
+			AssertThat(GraphIO::write(out, filename), IsTrue());
+
+			Graph sequential, parallel;
+			AssertThat(GraphIO::readEdgeList(sequential, filename), IsTrue());
+			AssertThat(GraphIO::readEdgeList(parallel, filename, 4), IsTrue());
+			std::remove(filename.c_str());
+
+			assertSeemsEqual(out, sequential);
+			AssertThat(parallel.numberOfNodes(), Equals(sequential.numberOfNodes()));
+			AssertThat(parallel.numberOfEdges(), Equals(sequential.numberOfEdges()));
+			for (edge e = sequential.firstEdge(), f = parallel.firstEdge(); e != nullptr;
+					e = e->succ(), f = f->succ()) {
+				AssertThat(f->source()->index(), Equals(e->source()->index()));
+				AssertThat(f->target()->index(), Equals(e->target()->index()));
+			}
+		});
+
+		it("returns false if the file does not exist", [] {
+			Graph G;
+			AssertThat(GraphIO::readEdgeList(G, "does-not-exist.edgelist", 2), IsFalse());
+		});
+
+		it("fails on too large node indices", [] {
+			for (const char* data :
+					{"0 2000000000\n", "2000000000 0\n", "# Nodes: 2000000000\n"}) {
+				std::istringstream is(data);
+				Graph G;
+				AssertThat(GraphIO::readEdgeList(G, is), IsFalse());
+				AssertThat(G.numberOfNodes(), IsLessThan(2));
+			}
+
+			const int maxNodes = GraphIO::maxEdgeListNodes();
+			GraphIO::setMaxEdgeListNodes(10);
+			const string filename = "edgelist-max-nodes.edgelist";
+			for (int index : {9, 10}) {
+				std::ofstream os(filename);
+				for (int i = 0; i < 50000; ++i) {
+					os << i % 9 << " " << (i == 40000 ? index : 0) << "\n";
+				}
+				os.close();
+				for (unsigned int numThreads : {1, 4}) {
+					Graph G;
+					AssertThat(GraphIO::readEdgeList(G, filename, numThreads), Equals(index < 10));
+				}
+			}
+			std::remove(filename.c_str());
+			GraphIO::setMaxEdgeListNodes(maxNodes);
+		});
+	});
+}
+
+void describeBinary() {
+	describe("Binary", [] {
+		const long attr = GraphAttributes::nodeGraphics | GraphAttributes::threeD
+				| GraphAttributes::edgeGraphics | GraphAttributes::nodeWeight
+				| GraphAttributes::nodeLabel | GraphAttributes::edgeLabel
+				| GraphAttributes::edgeIntWeight | GraphAttributes::edgeDoubleWeight;
+		describeGAFormat("Binary", GraphIO::readBinary, GraphIO::writeBinary, false, attr);
+
+		Graph G;
+		randomSimpleGraph(G, 20, 40);
+		GraphAttributes GA(G, attr);
+		createGraphAttributes(GA);
+		GA.directed() = false;
+
+		auto written = [&] {
+			std::ostringstream os;
+			AssertThat(GraphIO::writeBinary(GA, os), IsTrue());
+			return os.str();
+		};
+
+		it("skips the attributes that are not enabled", [&] {
+			std::istringstream is(written());
+			Graph G2;
+			GraphAttributes GA2(G2, GraphAttributes::edgeLabel);
+			AssertThat(GraphIO::readBinary(GA2, G2, is), IsTrue());
+			AssertThat(GA2.directed(), IsFalse());
+			AssertThat(G2.numberOfEdges(), Equals(G.numberOfEdges()));
+			for (edge e = G.firstEdge(), e2 = G2.firstEdge(); e != nullptr;
+					e = e->succ(), e2 = e2->succ()) {
+				AssertThat(GA2.label(e2), Equals(GA.label(e)));
+			}
+		});
+
+		it("detects truncated files", [&] {
+			string data = written();
+			for (size_t length : {size_t(0), size_t(39), data.size() / 2, data.size() - 1}) {
+				std::istringstream is(data.substr(0, length));
+				Graph G2;
+				AssertThat(GraphIO::readBinary(G2, is), IsFalse());
+			}
+		});
+
+		it("detects corrupt headers without building the graph", [&] {
+			// the numbers of nodes and edges are stored at offsets 24 and 32 of the header
+			auto corrupt = [](string data, uint64_t n, uint64_t m) {
+				std::memcpy(&data[24], &n, sizeof(n));
+				std::memcpy(&data[32], &m, sizeof(m));
+				return data;
+			};
+			const uint64_t huge = std::numeric_limits<int>::max();
+			const string data = written();
+			const uint64_t n = G.numberOfNodes();
+			const uint64_t m = G.numberOfEdges();
+			for (const string& corrupted : {corrupt(data.substr(0, 40), huge, huge),
+						 corrupt(data.substr(0, 40), huge, 0), corrupt(data, huge, m),
+						 corrupt(data, n, huge), corrupt(data, n, m + 1)}) {
+				std::istringstream is(corrupted);
+				Graph G2;
+				GraphAttributes GA2(G2, attr);
+				AssertThat(GraphIO::readBinary(GA2, G2, is), IsFalse());
+				AssertThat(G2.numberOfNodes(), Equals(0));
+			}
+		});
+
+		it("detects files that were written in text mode", [&] {
+			string data = written();
+			data.replace(5, 2, "\n");
+			std::istringstream is(data);
+			Graph G2;
+			AssertThat(GraphIO::readBinary(G2, is), IsFalse());
+		});
+	});
+}
+
 void describeRudy() {
 	describe("Rudy", [] {
 		describeGAFormatPerEdgeWeightType("Rudy", GraphIO::readRudy, GraphIO::writeRudy, false, 0);
@@ -1438,6 +1573,8 @@ void describeSpecificFormats() {
 	describeYGraph();
 	describeGraph6();
 	describeMatrixMarket();
+	describeEdgeList();
+	describeBinary();
 	describeRudy();
 	// TODO: BENCH (only very restrictive reader; point-based expansion of a hypergraph)
 	// TODO: PLA (only very restrictive reader; point-based expansion of a hypergraph)
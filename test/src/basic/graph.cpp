@@ -42,6 +42,7 @@
 #include <initializer_list>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <resources.h>
@@ -279,6 +280,51 @@ go_bandit([]() {
 			delete[] visited;
 		});
 
+		it("inserts edges in bulk", []() {
+			Graph graph;
+			NodeArray<int> nodeLabel(graph, -1);
+			EdgeArray<int> edgeLabel(graph, -1);
+			AdjEntryArray<int> adjLabel(graph, -1);
+
+			graph.reserveNodes(10);
+			graph.reserveEdges(100);
+			AssertThat(graph.nodeRegistry().getArraySize(), IsGreaterThan(9));
+			AssertThat(graph.edgeRegistry().getArraySize(), IsGreaterThan(99));
+			AssertThat(graph.adjEntryRegistry().getArraySize(), IsGreaterThan(199));
+
+			std::vector<node> nodes;
+			for (int i = 0; i < 10; i++) {
+				nodes.push_back(graph.newNode());
+			}
+			std::vector<std::pair<int, int>> pairs;
+			for (int i = 0; i < 10; i++) {
+				for (int j = 0; j < 10; j++) {
+					if ((i + j) % 3 == 0) {
+						pairs.emplace_back(i, j);
+					}
+				}
+			}
+			edge last = graph.newEdge(nodes[0], nodes[1]);
+
+			AssertThat(graph.insertEdges(nodes, pairs.begin(), pairs.end()),
+					Equals(static_cast<int>(pairs.size())));
+			AssertThat(graph.numberOfEdges(), Equals(static_cast<int>(pairs.size()) + 1));
+#ifdef OGDF_DEBUG
+			graph.consistencyCheck();
+#endif
+
+			auto it = pairs.begin();
+			for (edge e = last->succ(); e != nullptr; e = e->succ(), ++it) {
+				AssertThat(e->source(), Equals(nodes[it->first]));
+				AssertThat(e->target(), Equals(nodes[it->second]));
+				AssertThat(edgeLabel[e], Equals(-1));
+				AssertThat(adjLabel[e->adjTarget()], Equals(-1));
+			}
+			AssertThat(it == pairs.end(), IsTrue());
+
+			AssertThat(graph.insertEdges(nodes, pairs.end(), pairs.end()), Equals(0));
+		});
+
 		it("doesn't duplicate self-loops", []() {
 			Graph graph;
 
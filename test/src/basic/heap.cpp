@@ -39,6 +39,7 @@
 #include <ogdf/basic/heap/BinomialHeap.h>
 #include <ogdf/basic/heap/FibonacciHeap.h>
 #include <ogdf/basic/heap/HotQueue.h>
+#include <ogdf/basic/heap/MonotoneRadixHeap.h>
 #include <ogdf/basic/heap/PairingHeap.h>
 #include <ogdf/basic/heap/RMHeap.h>
 #include <ogdf/basic/heap/RadixHeap.h>
@@ -50,6 +51,7 @@
 #include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <queue>
@@ -686,6 +688,37 @@ void describeHeapBasic(bool supportsDecrease, bool supportsMerge) {
 	}
 }
 
+void monotoneRadixHeapScenarioTest() {
+	it("decreases values monotonically and pops in the right order", []() {
+		using Heap = MonotoneRadixHeap<int, std::less<int>>;
+		Heap heap;
+		heap.push(3);
+		Heap::Handle node10 = heap.push(10);
+		Heap::Handle node12 = heap.push(12);
+		heap.push(7);
+
+		AssertThat(heap.top(), Equals(3));
+		heap.pop();
+		heap.decrease(node10, 4);
+		AssertThat(heap.value(node10), Equals(4));
+		AssertThat(heap.top(), Equals(4));
+		heap.pop();
+		heap.push(4);
+		heap.decrease(node12, 5);
+		AssertThat(heap.top(), Equals(4));
+		heap.pop();
+		AssertThat(heap.top(), Equals(5));
+		heap.pop();
+		AssertThat(heap.top(), Equals(7));
+		heap.pop();
+		heap.push(std::numeric_limits<int>::max());
+		heap.push(8);
+		AssertThat(heap.top(), Equals(8));
+		heap.pop();
+		AssertThat(heap.top(), Equals(std::numeric_limits<int>::max()));
+	});
+}
+
 template<template<typename T, class C> class H>
 void describeHeap(const char* title, bool supportsDecrease = true, bool supportsMerge = true) {
 	describe(title, [&]() {
@@ -708,6 +741,16 @@ go_bandit([]() {
 		describeHeap<FibonacciHeap>("Fibonacci heap");
 		describeHeap<RMHeap>("Randomized mergable heap");
 
+		describe("Monotone radix heap", []() {
+			monotoneRadixHeapScenarioTest();
+			sortingRandomTest<MonotoneRadixHeap>(100);
+			sortingRandomTest<MonotoneRadixHeap>(10000);
+			sortingRandomTest<MonotoneRadixHeap>(1000000);
+			dijkstraTest<MonotoneRadixHeap>(10);
+			dijkstraTest<MonotoneRadixHeap>(100);
+			dijkstraTest<MonotoneRadixHeap>(1000);
+		});
+
 		describe("Radix heap", []() {
 			radixHeapSortingTest(1000);
 			radixHeapSortingTest(10000);
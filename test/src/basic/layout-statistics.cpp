@@ -0,0 +1,216 @@
+/** \file
+ * \brief Tests for ogdf::LayoutStatistics
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphAttributes.h>
+#include <ogdf/basic/LayoutStatistics.h>
+#include <ogdf/basic/Math.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/geometry.h>
+#include <ogdf/basic/graph_generators/deterministic.h>
+#include <ogdf/basic/graph_generators/randomized.h>
+#include <ogdf/basic/simple_graph_alg.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include <testing.h>
+
+//! Places the nodes of \p GA uniformly at random in a square of side length \p size.
+static void randomLayout(GraphAttributes& GA, double size) {
+	for (node v : GA.constGraph().nodes) {
+		GA.x(v) = randomDouble(0, size);
+		GA.y(v) = randomDouble(0, size);
+	}
+}
+
+//! Creates a \p side x \p side grid of slightly perturbed nodes in \p GA.
+/**
+ * Every node is connected to two random nodes at most two rows and columns
+ * away, so the graph has many crossings, but all of them between short edges.
+ */
+static void randomLocalGraph(Graph& G, GraphAttributes& GA, int side) {
+	Array<node> nodes(side * side);
+	for (int i = 0; i < side * side; i++) {
+		nodes[i] = G.newNode();
+		GA.x(nodes[i]) = i % side * 10 + randomDouble(-4, 4);
+		GA.y(nodes[i]) = i / side * 10 + randomDouble(-4, 4);
+	}
+	for (int i = 0; i < side * side; i++) {
+		for (int k = 0; k < 2; k++) {
+			int column = std::min(side - 1, std::max(0, i % side + randomNumber(-2, 2)));
+			int row = std::min(side - 1, std::max(0, i / side + randomNumber(-2, 2)));
+			if (row * side + column != i) {
+				G.newEdge(nodes[i], nodes[row * side + column]);
+			}
+		}
+	}
+	makeSimpleUndirected(G);
+}
+
+//! Counts node crossings by testing every edge segment against every node.
+static int64_t naiveNodeCrossings(const GraphAttributes& GA) {
+	const Graph& G = GA.constGraph();
+	NodeArray<DRect> nodeRects(G);
+	GA.nodeBoundingBoxes<DRect>(nodeRects);
+
+	int64_t crossings = 0;
+	for (edge e : G.edges) {
+		DPolyline targets = GA.bends(e);
+		targets.pushBack(GA.point(e->target()));
+		DPoint vPoint = GA.point(e->source());
+		int i = 0;
+		for (const DPoint& wPoint : targets) {
+			DSegment segment(vPoint, wPoint);
+			for (node u : G.nodes) {
+				if ((u != e->source() || i != 0) && (u != e->target() || i != targets.size() - 1)
+						&& nodeRects[u].intersection(segment)) {
+					crossings++;
+				}
+			}
+			vPoint = wPoint;
+			i++;
+		}
+	}
+	return crossings;
+}
+
+go_bandit([] {
+	describe("LayoutStatistics", [] {
+		describe("totalNumberOfCrossings", [] {
+			it("returns zero for graphs without edges", [] {
+				Graph G;
+				emptyGraph(G, 10);
+				GraphAttributes GA(G);
+				AssertThat(LayoutStatistics::totalNumberOfCrossings(GA), Equals(0));
+			});
+
+			it("counts the crossing of a square's diagonals", [] {
+				Graph G;
+				completeGraph(G, 4);
+				GraphAttributes GA(G);
+				const double coords[4][2] = {{0, 0}, {10, 0}, {10, 10}, {0, 10}};
+				int i = 0;
+				for (node v : G.nodes) {
+					GA.x(v) = coords[i][0];
+					GA.y(v) = coords[i][1];
+					i++;
+				}
+
+				AssertThat(LayoutStatistics::totalNumberOfCrossings(GA), Equals(1));
+				AssertThat(Math::sum(LayoutStatistics::numberOfCrossings(GA)), Equals(2));
+			});
+
+			it("counts crossings of edge segments", [] {
+				Graph G;
+				node u = G.newNode(), v = G.newNode();
+				node w = G.newNode(), x = G.newNode();
+				edge zigzag = G.newEdge(u, v);
+				G.newEdge(w, x);
+
+				GraphAttributes GA(G, GraphAttributes::nodeGraphics | GraphAttributes::edgeGraphics);
+				GA.x(u) = 0;
+				GA.y(u) = 0;
+				GA.x(v) = 30;
+				GA.y(v) = 0;
+				GA.x(w) = -5;
+				GA.y(w) = 5;
+				GA.x(x) = 35;
+				GA.y(x) = 5;
+				GA.bends(zigzag) = DPolyline({DPoint(10, 10), DPoint(20, 0)});
+
+				AssertThat(LayoutStatistics::totalNumberOfCrossings(GA), Equals(2));
+			});
+
+			// at least 1024 segments per thread are required for using several threads
+			for (unsigned int numThreads : {1, 4}) {
+				it("agrees with the intersection graph using " + to_string(numThreads)
+								+ " thread(s)",
+						[numThreads] {
+							setSeed(42);
+							Graph G;
+							GraphAttributes GA(G);
+							randomLocalGraph(G, GA, 55);
+
+							int64_t expected = Math::sum(LayoutStatistics::numberOfCrossings(GA)) / 2;
+							AssertThat(expected, IsGreaterThan(0));
+							AssertThat(LayoutStatistics::totalNumberOfCrossings(GA, numThreads),
+									Equals(expected));
+						});
+			}
+
+			it("handles long segments among many short ones", [] {
+				setSeed(42);
+				Graph G;
+				GraphAttributes GA(G);
+				randomLocalGraph(G, GA, 40);
+				Array<node> nodes;
+				G.allNodes(nodes);
+				for (int k = 0; k < 20; k++) {
+					G.newEdge(nodes[randomNumber(0, 39)], nodes[randomNumber(1560, 1599)]);
+				}
+
+				int64_t expected = Math::sum(LayoutStatistics::numberOfCrossings(GA)) / 2;
+				AssertThat(expected, IsGreaterThan(0));
+				for (unsigned int numThreads : {1, 4}) {
+					AssertThat(LayoutStatistics::totalNumberOfCrossings(GA, numThreads),
+							Equals(expected));
+				}
+			});
+		});
+
+		describe("totalNumberOfNodeCrossings", [] {
+			for (unsigned int numThreads : {1, 4}) {
+				it("agrees with testing all pairs using " + to_string(numThreads) + " thread(s)",
+						[numThreads] {
+							setSeed(42);
+							Graph G;
+							randomSimpleGraph(G, 1000, 5000);
+							GraphAttributes GA(G,
+									GraphAttributes::nodeGraphics | GraphAttributes::edgeGraphics);
+							randomLayout(GA, 1000);
+							for (edge e : G.edges) {
+								if (randomNumber(0, 3) == 0) {
+									GA.bends(e).pushBack(
+											DPoint(randomDouble(0, 1000), randomDouble(0, 1000)));
+								}
+							}
+
+							int64_t expected = naiveNodeCrossings(GA);
+							AssertThat(expected, IsGreaterThan(0));
+							AssertThat(Math::sum(LayoutStatistics::numberOfNodeCrossings(GA)),
+									Equals(expected));
+							AssertThat(LayoutStatistics::totalNumberOfNodeCrossings(GA, numThreads),
+									Equals(expected));
+						});
+			}
+		});
+	});
+});
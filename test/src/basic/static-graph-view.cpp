@@ -0,0 +1,172 @@
+/** \file
+ * \brief Tests for ogdf::StaticGraphView and the algorithms running on it
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/StaticGraphView.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/graph_generators/randomized.h>
+#include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/graphalg/ShortestPathAlgorithms.h>
+
+#include <limits>
+#include <vector>
+
+#include <graphs.h>
+
+#include <testing.h>
+
+static void assertConsistentView(const Graph& G, const StaticGraphView& view) {
+	AssertThat(view.graphOf(), Equals(&G));
+	AssertThat(view.numberOfNodes(), Equals(G.numberOfNodes()));
+	AssertThat(view.numberOfEdges(), Equals(G.numberOfEdges()));
+
+	for (node v : G.nodes) {
+		int i = view.index(v);
+		AssertThat(view.nodeOf(i), Equals(v));
+		AssertThat(view.degree(i), Equals(v->degree()));
+		AssertThat(view.outdeg(i), Equals(v->outdeg()));
+		AssertThat(view.indeg(i), Equals(v->indeg()));
+
+		int slot = view.adjBegin(i);
+		for (bool outgoing : {true, false}) {
+			for (adjEntry adj : v->adjEntries) {
+				if (adj->isSource() == outgoing) {
+					AssertThat(view.edgeOf(view.adjEdge(slot)), Equals(adj->theEdge()));
+					AssertThat(view.nodeOf(view.twinNode(slot)), Equals(adj->twinNode()));
+					++slot;
+				}
+			}
+			if (outgoing) {
+				AssertThat(slot, Equals(view.outEnd(i)));
+			}
+		}
+		AssertThat(slot, Equals(view.adjEnd(i)));
+	}
+
+	for (edge e : G.edges) {
+		int i = view.index(e);
+		AssertThat(view.edgeOf(i), Equals(e));
+		AssertThat(view.nodeOf(view.source(i)), Equals(e->source()));
+		AssertThat(view.nodeOf(view.target(i)), Equals(e->target()));
+	}
+}
+
+go_bandit([] {
+	describe("StaticGraphView", [] {
+		it("is empty by default", [] {
+			StaticGraphView view;
+			AssertThat(view.graphOf(), IsNull());
+			AssertThat(view.numberOfNodes(), Equals(0));
+			AssertThat(view.numberOfEdges(), Equals(0));
+		});
+
+		forEachGraphItWorks({}, [](const Graph& G) {
+			StaticGraphView view(G);
+			assertConsistentView(G, view);
+		});
+
+		it("can be reinitialized", [] {
+			Graph G;
+			randomSimpleGraph(G, 20, 40);
+			StaticGraphView view(G);
+			G.delNode(G.firstNode());
+			G.newEdge(G.firstNode(), G.lastNode());
+			view.init(G);
+			assertConsistentView(G, view);
+		});
+
+		describe("simple graph algorithms", [] {
+			forEachGraphItWorks({}, [](const Graph& G) {
+				StaticGraphView view(G);
+				AssertThat(isLoopFree(view), Equals(isLoopFree(G)));
+				AssertThat(isParallelFree(view), Equals(isParallelFree(G)));
+				AssertThat(isConnected(view), Equals(isConnected(G)));
+				AssertThat(isAcyclic(view), Equals(isAcyclic(G)));
+				AssertThat(isAcyclicUndirected(view), Equals(isAcyclicUndirected(G)));
+				AssertThat(isBipartite(view), Equals(isBipartite(G)));
+
+				NodeArray<int> component(G);
+				std::vector<int> viewComponent;
+				int nComponents = connectedComponents(G, component);
+				AssertThat(connectedComponents(view, viewComponent), Equals(nComponents));
+				for (edge e : G.edges) {
+					AssertThat(viewComponent[view.index(e->source())],
+							Equals(viewComponent[view.index(e->target())]));
+				}
+			});
+		});
+
+		describe("shortest paths", [] {
+			forEachGraphItWorks(
+					{GraphProperty::connected},
+					[](const Graph& G) {
+						StaticGraphView view(G);
+						node s = G.chooseNode();
+
+						NodeArray<int> bfsDistance(G);
+						std::vector<int> viewBfsDistance;
+						bfs_SPSS(s, G, bfsDistance, 1);
+						bfs_SPSS(s, view, viewBfsDistance, 1);
+
+						EdgeArray<int> cost(G);
+						std::vector<int> viewCost(G.numberOfEdges());
+						for (edge e : G.edges) {
+							cost[e] = randomNumber(1, 10);
+							viewCost[view.index(e)] = cost[e];
+						}
+						NodeArray<int> distance(G);
+						std::vector<int> viewDistance;
+						dijkstra_SPSS(s, G, distance, cost);
+						dijkstra_SPSS(s, view, viewDistance, viewCost);
+
+						for (node v : G.nodes) {
+							AssertThat(viewBfsDistance[view.index(v)], Equals(bfsDistance[v]));
+							AssertThat(viewDistance[view.index(v)], Equals(distance[v]));
+						}
+					},
+					GraphSizes(), 1);
+
+			it("leaves unreachable nodes at maximum distance", [] {
+				Graph G;
+				node s = G.newNode();
+				node t = G.newNode();
+				node u = G.newNode();
+				G.newEdge(s, t);
+				G.newEdge(u, s);
+				StaticGraphView view(G);
+
+				std::vector<double> distance;
+				dijkstra_SPSS(s, view, distance, std::vector<double>(2, 1.5), true);
+				AssertThat(distance[view.index(t)], Equals(1.5));
+				AssertThat(distance[view.index(u)], Equals(std::numeric_limits<double>::max()));
+			});
+		});
+	});
+});
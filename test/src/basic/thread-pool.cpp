@@ -0,0 +1,143 @@
+/** \file
+ * \brief Tests for ogdf::ThreadPool
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/ThreadPool.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include <testing.h>
+
+go_bandit([] {
+	describe("ThreadPool", [] {
+		it("restricts thread budgets to the pool size", [] {
+			ThreadPool pool(3);
+			AssertThat(pool.maxThreads(), Equals(pool.numberOfWorkers() + 1));
+			AssertThat(pool.threadBudget(0), Equals(1u));
+			AssertThat(pool.threadBudget(100), Equals(pool.maxThreads()));
+
+			ThreadPool::TaskGroup tasks(0, pool);
+			AssertThat(tasks.budget(), Equals(pool.maxThreads()));
+		});
+
+		it("executes all tasks of a group", [] {
+			ThreadPool pool(3);
+			std::atomic<int> sum(0);
+			ThreadPool::TaskGroup tasks(4, pool);
+			for (int i = 1; i <= 1000; ++i) {
+				tasks.run([&sum, i] { sum += i; });
+			}
+			tasks.wait();
+			AssertThat(sum.load(), Equals(500500));
+		});
+
+		it("executes tasks without any workers", [] {
+			ThreadPool pool(0);
+			int count = 0;
+			ThreadPool::TaskGroup tasks(4, pool);
+			AssertThat(tasks.budget(), Equals(1u));
+			for (int i = 0; i < 10; ++i) {
+				tasks.run([&count] { count++; });
+			}
+			tasks.wait();
+			AssertThat(count, Equals(10));
+		});
+
+		it("respects the thread budget of a group", [] {
+			ThreadPool pool(4);
+			std::atomic<int> running(0), maxRunning(0);
+			ThreadPool::TaskGroup tasks(2, pool);
+			for (int i = 0; i < 40; ++i) {
+				tasks.run([&] {
+					int now = ++running;
+					int seen = maxRunning;
+					while (now > seen && !maxRunning.compare_exchange_weak(seen, now)) { }
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+					--running;
+				});
+			}
+			tasks.wait();
+			AssertThat(maxRunning.load(), IsLessThanOrEqualTo(2));
+		});
+
+		it("supports nested groups", [] {
+			ThreadPool pool(2);
+			std::atomic<int> count(0);
+			ThreadPool::TaskGroup outer(0, pool);
+			for (int i = 0; i < 8; ++i) {
+				outer.run([&] {
+					ThreadPool::TaskGroup inner(0, pool);
+					for (int j = 0; j < 8; ++j) {
+						inner.run([&count] { count++; });
+					}
+					inner.wait();
+				});
+			}
+			outer.wait();
+			AssertThat(count.load(), Equals(64));
+		});
+
+		it("rethrows exceptions of tasks", [] {
+			ThreadPool pool(2);
+			std::atomic<int> count(0);
+			ThreadPool::TaskGroup tasks(0, pool);
+			for (int i = 0; i < 10; ++i) {
+				tasks.run([&count, i] {
+					count++;
+					if (i == 5) {
+						throw std::runtime_error("task failed");
+					}
+				});
+			}
+			AssertThrows(std::runtime_error, tasks.wait());
+			AssertThat(count.load(), Equals(10));
+		});
+
+		it("can change the number of workers", [] {
+			ThreadPool pool(1);
+			std::atomic<int> count(0);
+			{
+				ThreadPool::TaskGroup tasks(0, pool);
+				tasks.run([&count] { count++; });
+				tasks.wait();
+			}
+			pool.setNumberOfWorkers(3);
+			{
+				ThreadPool::TaskGroup tasks(0, pool);
+				for (int i = 0; i < 10; ++i) {
+					tasks.run([&count] { count++; });
+				}
+				tasks.wait();
+			}
+			AssertThat(count.load(), Equals(11));
+		});
+	});
+});
@@ -36,8 +36,13 @@
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/SList.h>
 #include <ogdf/basic/basic.h>
+#include <ogdf/basic/extended_graph_alg.h>
 #include <ogdf/basic/graph_generators.h>
 #include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/decomposition/DynamicSPQRTree.h>
+#include <ogdf/decomposition/PertinentGraph.h>
+#include <ogdf/decomposition/StaticPlanarSPQRTree.h>
+#include <ogdf/decomposition/StaticSPQRTree.h>
 #include <ogdf/graphalg/Triconnectivity.h>
 
 #include <algorithm>
@@ -527,6 +532,125 @@ go_bandit([]() {
 					GraphSizes(), 3, MAX_SIZE);
 		});
 
+		describe("for large sparse graphs", []() {
+			it("handles a cycle with 1,000,000 nodes", []() {
+				const int n = 1000000;
+				Graph G;
+				node v = G.newNode();
+				for (int i = 1; i < n; ++i) {
+					v = G.newEdge(v, G.newNode())->target();
+				}
+				G.newEdge(v, G.firstNode());
+
+				Triconnectivity T(G);
+				int comps = 0;
+				for (int i = 0; i < T.m_numComp; ++i) {
+					const Triconnectivity::CompStruct& C = T.m_component[i];
+					if (!C.m_edges.empty()) {
+						comps++;
+						AssertThat(C.m_type, Equals(Triconnectivity::CompType::polygon));
+						AssertThat(C.m_edges.size(), Equals(n));
+					}
+				}
+				AssertThat(comps, Equals(1));
+
+				bool isTric = true;
+				node s1 = nullptr;
+				node s2 = nullptr;
+				Triconnectivity _(G, isTric, s1, s2);
+				AssertThat(isTric, IsFalse());
+				AssertThat(s1, !IsNull());
+				AssertThat(s2, !IsNull());
+			});
+
+			it("handles a K4 with long subdivided edges", []() {
+				const int length = 200000;
+				Graph G;
+				completeGraph(G, 4);
+				for (edge e : std::vector<edge> {G.edges.begin(), G.edges.end()}) {
+					for (int i = 1; i < length; ++i) {
+						G.split(e);
+					}
+				}
+
+				Triconnectivity T(G);
+				int polygons = 0, rigids = 0;
+				for (int i = 0; i < T.m_numComp; ++i) {
+					const Triconnectivity::CompStruct& C = T.m_component[i];
+					if (C.m_edges.empty()) {
+						continue;
+					}
+					if (C.m_type == Triconnectivity::CompType::polygon) {
+						polygons++;
+						AssertThat(C.m_edges.size(), Equals(length + 1));
+					} else {
+						rigids++;
+						AssertThat(C.m_type, Equals(Triconnectivity::CompType::triconnected));
+						AssertThat(C.m_edges.size(), Equals(6));
+					}
+				}
+				AssertThat(polygons, Equals(6));
+				AssertThat(rigids, Equals(1));
+			});
+
+			// The SPQR-trees of the following graphs are paths with a node for every
+			// square or triangle, so traversing them recursively overflows the stack.
+			auto checkSPQRTrees = [](Graph& G, int numS, int numP) {
+				StaticSPQRTree spqr(G);
+				AssertThat(spqr.numberOfSNodes(), Equals(numS));
+				AssertThat(spqr.numberOfPNodes(), Equals(numP));
+				AssertThat(spqr.numberOfRNodes(), Equals(0));
+
+				// the pertinent graph of the root additionally contains the reference edge
+				PertinentGraph P;
+				spqr.pertinentGraph(spqr.rootNode(), P);
+				AssertThat(P.getGraph().numberOfEdges(), Equals(G.numberOfEdges() + 1));
+
+				planarEmbed(G);
+				StaticPlanarSPQRTree planarSpqr(G, true);
+				planarSpqr.embed(G);
+				AssertThat(G.representsCombEmbedding(), IsTrue());
+
+				DynamicSPQRTree dynamicSpqr(G);
+				AssertThat(dynamicSpqr.numberOfSNodes(), Equals(numS));
+				AssertThat(dynamicSpqr.numberOfPNodes(), Equals(numP));
+				PertinentGraph DP;
+				dynamicSpqr.pertinentGraph(dynamicSpqr.rootNode(), DP);
+				AssertThat(DP.getGraph().numberOfEdges(), Equals(G.numberOfEdges()));
+			};
+
+			it("handles a ladder with 100,000 rungs", [&]() {
+				const int rungs = 100000;
+				Graph G;
+				node u = G.newNode();
+				node v = G.newNode();
+				G.newEdge(u, v);
+				for (int i = 1; i < rungs; ++i) {
+					node u2 = G.newNode();
+					node v2 = G.newNode();
+					G.newEdge(u, u2);
+					G.newEdge(v, v2);
+					G.newEdge(u2, v2);
+					u = u2;
+					v = v2;
+				}
+				checkSPQRTrees(G, rungs - 1, rungs - 2);
+			});
+
+			it("handles a fan with 100,000 blades", [&]() {
+				const int n = 100000;
+				Graph G;
+				node hub = G.newNode();
+				node v = G.newNode();
+				G.newEdge(hub, v);
+				for (int i = 1; i < n; ++i) {
+					v = G.newEdge(v, G.newNode())->target();
+					G.newEdge(hub, v);
+				}
+				checkSPQRTrees(G, n - 1, n - 2);
+			});
+		});
+
 		// TODO check that random SPQR tree structure matches
 		// TODO check that separation pair occurs in random SPQR tree
 		// TODO fix and reenable parallel edges case
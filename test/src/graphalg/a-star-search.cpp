@@ -34,6 +34,7 @@
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/heap/MonotoneRadixHeap.h>
 #include <ogdf/graphalg/AStarSearch.h>
 #include <ogdf/graphalg/Dijkstra.h>
 
@@ -41,7 +42,9 @@
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <string>
+#include <type_traits>
 
 #include <testing.h>
 
@@ -104,6 +107,36 @@ void performSingleTest(const Graph& graph, const node source, const node target,
 	}
 }
 
+//! Compares the monotone radix heap with the default pairing heap (for integral costs).
+template<typename T>
+void performRadixHeapTest(const Graph& graph, const node source, const node target,
+		const EdgeArray<T>& cost, const double maxGap, const bool directed, long& ticksDijkstra,
+		long& ticksUninformedAStar) {
+	Dijkstra<T> dijkstra;
+	Dijkstra<T, MonotoneRadixHeap> dijkstraRadix;
+	AStarSearch<T, MonotoneRadixHeap> astar(directed, maxGap);
+	NodeArray<T> distance;
+	NodeArray<T> distanceRadix;
+	NodeArray<edge> pred;
+
+	dijkstra.call(graph, cost, source, pred, distance, directed);
+	auto start = std::chrono::system_clock::now();
+	dijkstraRadix.call(graph, cost, source, pred, distanceRadix, directed);
+	ticksDijkstra += (std::chrono::system_clock::now() - start).count();
+	AssertThat(distanceRadix, EqualsContainer(distance));
+
+	start = std::chrono::system_clock::now();
+	T result = astar.call(graph, cost, source, target, pred);
+	ticksUninformedAStar += (std::chrono::system_clock::now() - start).count();
+
+	if (distance[target] == std::numeric_limits<T>::max()) {
+		AssertThat(pred[target], IsNull());
+	} else {
+		validatePath(source, target, graph, cost, pred, result);
+		AssertThat(result, IsLessThan(distance[target] * maxGap + 1));
+	}
+}
+
 template<typename T>
 void performTests(const bool directed, const double maxGap, const bool pathLike) {
 	const int NUMBER_OF_GRAPHS = 10;
@@ -116,6 +149,8 @@ void performTests(const bool directed, const double maxGap, const bool pathLike)
 	long ticksDijkstra = 0;
 	long ticksUninformedAStar = 0;
 	long ticksAStarHeuristic = 0;
+	long ticksDijkstraRadix = 0;
+	long ticksUninformedAStarRadix = 0;
 
 	for (int i = 0; i < NUMBER_OF_GRAPHS; i++) {
 		Graph graph;
@@ -157,6 +192,10 @@ void performTests(const bool directed, const double maxGap, const bool pathLike)
 
 		performSingleTest(graph, source, target, cost, maxGap, directed, dijkstra, astar,
 				ticksDijkstra, ticksUninformedAStar, ticksAStarHeuristic);
+		if constexpr (std::is_integral<T>::value) {
+			performRadixHeapTest(graph, source, target, cost, maxGap, directed, ticksDijkstraRadix,
+					ticksUninformedAStarRadix);
+		}
 	}
 
 	std::cout << std::endl;
@@ -166,6 +205,12 @@ void performTests(const bool directed, const double maxGap, const bool pathLike)
 			  << ticksUninformedAStar << std::endl;
 	std::cout << std::left << "    A* perfect heuristic  : " << std::right << std::setw(16)
 			  << ticksAStarHeuristic << std::endl;
+	if (std::is_integral<T>::value) {
+		std::cout << std::left << "    Dijkstra (radix heap) : " << std::right << std::setw(16)
+				  << ticksDijkstraRadix << std::endl;
+		std::cout << std::left << "    A* uninf. (radix heap): " << std::right << std::setw(16)
+				  << ticksUninformedAStarRadix << std::endl;
+	}
 	std::cout << std::left;
 }
 
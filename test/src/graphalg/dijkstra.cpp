@@ -36,6 +36,7 @@
 #include <ogdf/basic/graph_generators/deterministic.h>
 #include <ogdf/basic/heap/PairingHeap.h>
 #include <ogdf/graphalg/Dijkstra.h>
+#include <ogdf/graphalg/DijkstraWorkspace.h>
 
 #include <functional>
 #include <limits>
@@ -362,6 +363,58 @@ void compareDijkstraAlgorithms(const Graph& G, bool testMultipleSource) {
 	AssertThat(distanceBasic, EqualsContainer(distanceNotEarlyTerminated));
 }
 
+//! Runs a workspace from every node of \p G and compares it with a fresh Dijkstra call.
+template<typename T>
+void compareWithWorkspace(const Graph& G) {
+	EdgeArray<T> weights(G);
+	for (edge e : G.edges) {
+		weights[e] = static_cast<T>(randomNumber(1, 10));
+	}
+
+	Dijkstra<T, PairingHeap> dij;
+	DijkstraWorkspace<T, PairingHeap> workspace(G);
+	NodeArray<edge> predecessor;
+	NodeArray<T> distance;
+	for (node s : G.nodes) {
+		dij.callUnbound(G, weights, s, predecessor, distance);
+
+		workspace.call(weights, s);
+		for (node v : G.nodes) {
+			AssertThat(workspace.distance(v), Equals(distance[v]));
+			AssertThat(workspace.reached(v), Equals(distance[v] != std::numeric_limits<T>::max()));
+			AssertThat(workspace.settled(v), Equals(workspace.reached(v)));
+			edge e = workspace.predecessor(v);
+			if (v == s || !workspace.reached(v)) {
+				AssertThat(e, IsNull());
+			} else {
+				AssertThat(e, !IsNull());
+				AssertThat(workspace.distance(e->opposite(v)) + weights[e], Equals(distance[v]));
+			}
+		}
+
+		NodeArray<edge> copiedPredecessor;
+		NodeArray<T> copiedDistance;
+		workspace.copyTo(copiedPredecessor, copiedDistance);
+		AssertThat(copiedDistance, EqualsContainer(distance));
+
+		List<node> targets;
+		targets.pushBack(G.chooseNode());
+		targets.pushBack(G.chooseNode());
+		workspace.call(weights, List<node>({s}), targets);
+		for (node t : targets) {
+			AssertThat(workspace.distance(t), Equals(distance[t]));
+		}
+		for (node v : workspace.reachedNodes()) {
+			AssertThat(workspace.reached(v), IsTrue());
+			if (workspace.settled(v)) {
+				AssertThat(workspace.distance(v), Equals(distance[v]));
+			} else {
+				AssertThat(workspace.distance(v), IsGreaterThanOrEqualTo(distance[v]));
+			}
+		}
+	}
+}
+
 template<typename T>
 void performTestsSingleSource() {
 	describe("Finding a shortest path tree on simple instances", [] {
@@ -391,6 +444,14 @@ void performTestsSingleSource() {
 			compareDijkstraAlgorithms<T>(G, false);
 		});
 	});
+	describe("Finding the same shortest paths with a reused workspace", [] {
+		forEachGraphItWorks({}, [&](const Graph& G) {
+			if (G.numberOfNodes() == 0) {
+				return;
+			}
+			compareWithWorkspace<T>(G);
+		});
+	});
 }
 
 template<typename T>
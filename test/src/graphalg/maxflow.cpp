@@ -34,6 +34,7 @@
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/List.h>
+#include <ogdf/basic/ThreadPool.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/extended_graph_alg.h>
 #include <ogdf/basic/graph_generators.h>
@@ -42,6 +43,7 @@
 #include <ogdf/graphalg/ConnectivityTester.h>
 #include <ogdf/graphalg/MaxFlowEdmondsKarp.h>
 #include <ogdf/graphalg/MaxFlowGoldbergTarjan.h> // IWYU pragma: keep
+#include <ogdf/graphalg/MaxFlowParallelPushRelabel.h> // IWYU pragma: keep
 #include <ogdf/graphalg/MaxFlowSTPlanarDigraph.h> // IWYU pragma: keep
 #include <ogdf/graphalg/MaxFlowSTPlanarItaiShiloach.h> // IWYU pragma: keep
 
@@ -351,6 +353,49 @@ void registerTestSuite(const string typeName) {
 			MFR_CONNECTED | MFR_ST_PLANAR);
 	describeMaxFlowModule<MaxFlowEdmondsKarp<T>, T>("MaxFlowEdmondsKarp" + suffix);
 	describeMaxFlowModule<MaxFlowGoldbergTarjan<T>, T>("MaxFlowGoldbergTarjan" + suffix);
+	describeMaxFlowModule<MaxFlowParallelPushRelabel<T>, T>("MaxFlowParallelPushRelabel" + suffix);
+}
+
+/**
+ * Compares the parallel push-relabel algorithm using several threads and
+ * different global relabel frequencies with Goldberg-Tarjan on large instances.
+ */
+template<typename T>
+void describeParallelPushRelabel(const string& typeName) {
+	describe("MaxFlowParallelPushRelabel<" + typeName + "> with several threads", [] {
+		unsigned int numberOfWorkers = 0;
+		before_each([&] {
+			numberOfWorkers = ThreadPool::global().numberOfWorkers();
+			ThreadPool::global().setNumberOfWorkers(3);
+		});
+		after_each([&] { ThreadPool::global().setNumberOfWorkers(numberOfWorkers); });
+
+		for (double frequency : {0.0, 0.5, 1.0, 4.0}) {
+			it("works on large random graphs with global relabel frequency " + to_string(frequency),
+					[&] {
+						Graph graph;
+						const int n = randomNumber(2000, 4000);
+						randomSimpleConnectedGraph(graph, n, 4 * n);
+						EdgeArray<T> caps(graph);
+						for (edge e : graph.edges) {
+							caps[e] = static_cast<T>(randomNumber(1, 100));
+						}
+						node s = graph.chooseNode();
+						node t = graph.chooseNode([&](node v) { return v != s; });
+
+						MaxFlowParallelPushRelabel<T> alg(graph);
+						alg.maxThreads(4);
+						alg.globalRelabelFrequency(frequency);
+						EdgeArray<T> flow(graph);
+						T value = alg.computeValue(caps, s, t);
+						alg.computeFlowAfterValue(flow);
+
+						MaxFlowGoldbergTarjan<T> reference(graph);
+						AssertThat(value, Equals(reference.computeValue(caps, s, t)));
+						validateFlow(graph, caps, s, t, flow, value);
+					});
+		}
+	});
 }
 
 /**
@@ -456,6 +501,8 @@ go_bandit([]() {
 		registerTestSuite<int>("int");
 		registerTestSuite<double>("double");
 		registerTestSuite<unsigned long long int>("unsigned long long int");
+		describeParallelPushRelabel<int>("int");
+		describeParallelPushRelabel<double>("double");
 	});
 
 	describe("Connectivity Tester", []() {
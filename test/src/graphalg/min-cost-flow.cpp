@@ -29,9 +29,21 @@
  * http://www.gnu.org/copyleft/gpl.html
  */
 
+#include <ogdf/basic/CombinatorialEmbedding.h>
 #include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphAttributes.h>
+#include <ogdf/basic/GridLayoutMapped.h>
+#include <ogdf/basic/extended_graph_alg.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/graphalg/MinCostFlowCostScaling.h>
 #include <ogdf/graphalg/MinCostFlowModule.h>
 #include <ogdf/graphalg/MinCostFlowReinelt.h>
+#include <ogdf/orthogonal/FlowCompaction.h>
+#include <ogdf/orthogonal/OrthoRep.h>
+#include <ogdf/orthogonal/OrthoShaper.h>
+#include <ogdf/orthogonal/internal/RoutingChannel.h>
+#include <ogdf/planarity/PlanRep.h>
 
 #include <functional>
 #include <string>
@@ -125,9 +137,218 @@ void testModule(const char* name, MinCostFlowModule<TCost>* alg, TCost base) {
 	delete alg;
 }
 
+//! Solves every instance with MinCostFlowReinelt and MinCostFlowCostScaling and
+//! checks that both yield flows of the same cost.
+/**
+ * The returned flow is the one of MinCostFlowReinelt unless \p returnCostScalingFlow is set.
+ */
+class ComparingMinCostFlow : public MinCostFlowModule<int> {
+public:
+	using MinCostFlowModule<int>::call;
+
+	explicit ComparingMinCostFlow(bool returnCostScalingFlow = false)
+		: m_returnCostScalingFlow(returnCostScalingFlow) { }
+
+	bool call(const Graph& G, const EdgeArray<int>& lowerBound, const EdgeArray<int>& upperBound,
+			const EdgeArray<int>& cost, const NodeArray<int>& supply, EdgeArray<int>& flow,
+			NodeArray<int>& dual) override {
+		EdgeArray<int> otherFlow(G);
+		NodeArray<int> otherDual(G);
+		EdgeArray<int>& reineltFlow = m_returnCostScalingFlow ? otherFlow : flow;
+		NodeArray<int>& reineltDual = m_returnCostScalingFlow ? otherDual : dual;
+		EdgeArray<int>& costScalingFlow = m_returnCostScalingFlow ? flow : otherFlow;
+		NodeArray<int>& costScalingDual = m_returnCostScalingFlow ? dual : otherDual;
+
+		bool feasible =
+				m_reinelt.call(G, lowerBound, upperBound, cost, supply, reineltFlow, reineltDual);
+		bool otherFeasible = m_costScaling.call(G, lowerBound, upperBound, cost, supply,
+				costScalingFlow, costScalingDual);
+		++numberOfCalls;
+
+		AssertThat(otherFeasible, Equals(feasible));
+		if (feasible) {
+			int value, otherValue;
+			AssertThat(checkComputedFlow(G, lowerBound, upperBound, cost, supply, flow, value),
+					IsTrue());
+			AssertThat(checkComputedFlow(G, lowerBound, upperBound, cost, supply, otherFlow,
+							   otherValue),
+					IsTrue());
+			AssertThat(otherValue, Equals(value));
+		}
+		return feasible;
+	}
+
+	int numberOfCalls = 0; //!< Number of networks compared so far.
+
+private:
+	bool m_returnCostScalingFlow;
+	MinCostFlowReinelt<int> m_reinelt;
+	MinCostFlowCostScaling<int> m_costScaling;
+};
+
+static void testCostScalingRandom() {
+	MinCostFlowReinelt<int> reinelt;
+	MinCostFlowCostScaling<int> costScaling;
+
+	for (int i = 0; i < 50; ++i) {
+		Graph G;
+		EdgeArray<int> lowerBound(G), upperBound(G), cost(G);
+		NodeArray<int> supply(G);
+		int n = randomNumber(3, 60);
+		MinCostFlowModule<int>::generateProblem(G, n, 3 * n, lowerBound, upperBound, cost, supply);
+		for (edge e : G.edges) {
+			if (randomNumber(0, 4) == 0) {
+				cost[e] = -cost[e];
+			}
+			if (randomNumber(0, 5) == 0) {
+				lowerBound[e] = randomNumber(0, upperBound[e]);
+			}
+			if (randomNumber(0, 10) == 0) {
+				upperBound[e] = std::numeric_limits<int>::max();
+			}
+		}
+		if (i % 3 == 0) {
+			// possibly infeasible
+			supply[G.firstNode()] += 5;
+			supply[G.lastNode()] -= 5;
+		}
+
+		EdgeArray<int> flow(G), costScalingFlow(G);
+		NodeArray<int> dual(G);
+		bool feasible = reinelt.call(G, lowerBound, upperBound, cost, supply, flow);
+		AssertThat(costScaling.call(G, lowerBound, upperBound, cost, supply, costScalingFlow, dual),
+				Equals(feasible));
+		if (!feasible) {
+			continue;
+		}
+
+		int value, costScalingValue;
+		MinCostFlowModule<int>::checkComputedFlow(G, lowerBound, upperBound, cost, supply, flow,
+				value);
+		AssertThat(MinCostFlowModule<int>::checkComputedFlow(G, lowerBound, upperBound, cost,
+						   supply, costScalingFlow, costScalingValue),
+				IsTrue());
+		AssertThat(costScalingValue, Equals(value));
+
+		// complementary slackness
+		for (edge e : G.edges) {
+			if (!e->isSelfLoop()) {
+				int reducedCost = cost[e] - dual[e->source()] + dual[e->target()];
+				AssertThat(reducedCost >= 0 || costScalingFlow[e] == upperBound[e], IsTrue());
+				AssertThat(reducedCost <= 0 || costScalingFlow[e] == lowerBound[e], IsTrue());
+			}
+		}
+
+		// solve again with some costs changed, reusing the previous prices
+		for (int j = 0; j < 3; ++j) {
+			cost[G.chooseEdge()] += randomNumber(-5, 5);
+		}
+		costScaling.warmStart(true);
+		reinelt.call(G, lowerBound, upperBound, cost, supply, flow);
+		AssertThat(costScaling.call(G, lowerBound, upperBound, cost, supply, costScalingFlow),
+				IsTrue());
+		costScaling.warmStart(false);
+		MinCostFlowModule<int>::checkComputedFlow(G, lowerBound, upperBound, cost, supply, flow,
+				value);
+		AssertThat(MinCostFlowModule<int>::checkComputedFlow(G, lowerBound, upperBound, cost,
+						   supply, costScalingFlow, costScalingValue),
+				IsTrue());
+		AssertThat(costScalingValue, Equals(value));
+	}
+}
+
+static void testOrthoShaperNetworks(int n) {
+	ComparingMinCostFlow* mcf = new ComparingMinCostFlow;
+	OrthoShaper shaper;
+	shaper.setMinCostFlowComputer(mcf);
+
+	for (int i = 0; i < 3; ++i) {
+		// the first phase of OrthoLayout
+		Graph G;
+		randomPlanarConnectedGraph(G, n, 2 * n);
+		makeSimpleUndirected(G);
+		PlanRep PG(G);
+		PG.initCC(0);
+		planarEmbed(PG);
+		adjEntry adjExternal = PG.firstEdge()->adjSource();
+		PG.expand();
+		CombinatorialEmbedding E(PG);
+		E.setExternalFace(E.rightFace(adjExternal));
+		OrthoRep OR;
+		shaper.call(PG, E, OR);
+	}
+
+	AssertThat(mcf->numberOfCalls, IsGreaterThan(0));
+}
+
+static void testFlowCompaction(int n) {
+	// the compactions continue with the flows of MinCostFlowCostScaling
+	ComparingMinCostFlow* constructiveMcf = new ComparingMinCostFlow(true);
+	ComparingMinCostFlow* improvementMcf = new ComparingMinCostFlow(true);
+	FlowCompaction fca, fc;
+	fca.setMinCostFlowComputer(constructiveMcf);
+	fc.setMinCostFlowComputer(improvementMcf);
+
+	for (int i = 0; i < 3; ++i) {
+		// the first two phases of OrthoLayout
+		Graph G;
+		randomPlanarConnectedGraph(G, n, 2 * n);
+		makeSimpleUndirected(G);
+		GraphAttributes GA(G,
+				GraphAttributes::nodeGraphics | GraphAttributes::nodeType
+						| GraphAttributes::edgeType);
+		PlanRep PG(GA);
+		PG.initCC(0);
+		planarEmbed(PG);
+		adjEntry adjExternal = PG.firstEdge()->adjSource();
+		PG.expand();
+		CombinatorialEmbedding E(PG);
+		E.setExternalFace(E.rightFace(adjExternal));
+		OrthoRep OR;
+		OrthoShaper shaper;
+		shaper.call(PG, E, OR);
+
+		PG.expandLowDegreeVertices(OR);
+		E.computeFaces();
+		E.setExternalFace(E.rightFace(adjExternal));
+		OR.normalize();
+		OR.dissect2(&PG);
+		OR.orientate(PG, OrthoDir::North);
+		OR.computeCageInfoUML(PG);
+
+		const double separation = 40;
+		const double cOverhang = 0.2;
+		GridLayoutMapped drawing(PG, OR, separation, cOverhang, 2);
+		RoutingChannel<int> rc(PG, drawing.toGrid(separation), cOverhang);
+		rc.computeRoutingChannels(OR);
+
+		fca.constructiveHeuristics(PG, OR, rc, drawing);
+		OR.undissect();
+		fc.improvementHeuristics(PG, OR, rc, drawing);
+	}
+
+	AssertThat(constructiveMcf->numberOfCalls, IsGreaterThan(0));
+	AssertThat(improvementMcf->numberOfCalls, IsGreaterThan(0));
+}
+
 go_bandit([]() {
 	describe("Min-Cost Flow algorithms", []() {
 		testModule<int>("MinCostFlowReinelt with integral cost", new MinCostFlowReinelt<int>(), 1);
+		testModule<int>("MinCostFlowCostScaling with integral cost", new MinCostFlowCostScaling<int>(), 1);
+		describe("MinCostFlowCostScaling", [] {
+			it("finds the same optimum as MinCostFlowReinelt on random instances",
+					[] { testCostScalingRandom(); });
+			for (int n : {100, 1000, 5000}) {
+				it("finds the same optimum as MinCostFlowReinelt on OrthoShaper networks with "
+								+ to_string(n) + " nodes",
+						[n] { testOrthoShaperNetworks(n); });
+			}
+			for (int n : {100, 1000}) {
+				it("finds the same optimum as MinCostFlowReinelt in FlowCompaction with "
+								+ to_string(n) + " nodes",
+						[n] { testFlowCompaction(n); });
+			}
+		});
 		testModule<double>("MinCostFlowReinelt wit real (double) cost [1]",
 				new MinCostFlowReinelt<double>(), 1.92);
 		testModule<double>("MinCostFlowReinelt wit real (double) cost [2]",
@@ -0,0 +1,117 @@
+/** \file
+ * \brief Tests for the all-pairs shortest path algorithms
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphAttributes.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/NodeMatrix.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/graphalg/ShortestPathAlgorithms.h>
+
+#include <initializer_list>
+#include <limits>
+#include <string>
+
+#include <graphs.h>
+
+#include <testing.h>
+
+//! Asserts that the flat matrix \p flat equals \p expected, where unreachable entries of
+//! \p expected are replaced by \p unreachable.
+template<typename T, bool Symmetric>
+static void assertSameDistances(const Graph& G, const NodeMatrix<T, Symmetric>& flat,
+		const NodeArray<NodeArray<T>>& expected, T unreachable) {
+	for (node v : G.nodes) {
+		for (node w : G.nodes) {
+			T d = expected[v][w];
+			if (d == std::numeric_limits<T>::max()) {
+				d = unreachable;
+			}
+			AssertThat(flat(v, w), Equals(d));
+		}
+	}
+}
+
+go_bandit([] {
+	describe("All-pairs shortest paths", [] {
+		for (unsigned int threads : {1u, 4u}) {
+			describe("using " + std::to_string(threads) + " thread(s)", [&] {
+				forEachGraphItWorks({}, [&](const Graph& G) {
+					NodeArray<NodeArray<double>> expected(G);
+					for (node v : G.nodes) {
+						expected[v].init(G, std::numeric_limits<double>::max());
+					}
+					bfs_SPAP(G, expected, 2.0);
+
+					NodeMatrix<double> distance;
+					bfs_SPAP(G, distance, 2.0, threads);
+					assertSameDistances(G, distance, expected,
+							std::numeric_limits<double>::infinity());
+
+					NodeMatrix<double, true> symmetricDistance;
+					bfs_SPAP(G, symmetricDistance, 2.0, threads);
+					assertSameDistances(G, symmetricDistance, expected,
+							std::numeric_limits<double>::infinity());
+
+					EdgeArray<int> cost(G);
+					for (edge e : G.edges) {
+						cost[e] = randomNumber(1, 10);
+					}
+					NodeArray<NodeArray<int>> expectedInt(G);
+					dijkstra_SPAP(G, expectedInt, cost);
+
+					NodeMatrix<int> distanceInt;
+					dijkstra_SPAP(G, distanceInt, cost, threads);
+					assertSameDistances(G, distanceInt, expectedInt, std::numeric_limits<int>::max());
+				});
+			});
+		}
+
+		forEachGraphItWorks({}, [](const Graph& G) {
+			NodeArray<NodeArray<double>> expected(G);
+			NodeMatrix<double, true> distance(G, std::numeric_limits<double>::infinity());
+			for (node v : G.nodes) {
+				expected[v].init(G, std::numeric_limits<double>::infinity());
+				expected[v][v] = distance(v, v) = 0;
+			}
+			for (edge e : G.edges) {
+				expected[e->source()][e->target()] = expected[e->target()][e->source()] =
+						distance(e->source(), e->target()) = randomDouble(1, 2);
+			}
+
+			floydWarshall_SPAP(expected, G);
+			floydWarshall_SPAP(distance, G);
+			for (node v : G.nodes) {
+				for (node w : G.nodes) {
+					AssertThat(distance(v, w), Equals(expected[v][w]));
+				}
+			}
+		});
+	});
+});
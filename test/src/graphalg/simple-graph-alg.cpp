@@ -30,6 +30,7 @@
  */
 
 #include <ogdf/basic/Array.h>
+#include <ogdf/basic/ArrayBuffer.h>
 #include <ogdf/basic/CombinatorialEmbedding.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphList.h>
@@ -373,6 +374,29 @@ static void describeIsBiconnected() {
 		randomBiconnectedGraph(G, 250000, 500000);
 		AssertThat(isBiconnected(G), IsTrue());
 	});
+
+	it("works on an extremely long path and cycle", [&]() {
+		const int n = 10000000;
+		Graph G;
+		node v = G.newNode();
+		for (int i = 1; i < n; ++i) {
+			v = G.newEdge(v, G.newNode())->target();
+		}
+
+		node cutVertex = nullptr;
+		AssertThat(isBiconnected(G, cutVertex), IsFalse());
+		AssertThat(cutVertex, !IsNull());
+		ArrayBuffer<node> cutVertices;
+		AssertThat(findCutVertices(G, cutVertices), IsTrue());
+		AssertThat(cutVertices.size(), Equals(n - 2));
+
+		G.newEdge(v, G.firstNode());
+		AssertThat(isBiconnected(G, cutVertex), IsTrue());
+		AssertThat(cutVertex, IsNull());
+		cutVertices.clear();
+		AssertThat(findCutVertices(G, cutVertices), IsFalse());
+		AssertThat(cutVertices.empty(), IsTrue());
+	});
 }
 
 static void describeMakeBiconnected() {
@@ -31,6 +31,7 @@
 
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphAttributes.h>
+#include <ogdf/basic/NodeMatrix.h>
 #include <ogdf/basic/System.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/graph_generators/randomized.h>
@@ -46,12 +47,19 @@
 #include <ogdf/energybased/SpringEmbedderGridVariant.h>
 #include <ogdf/energybased/SpringEmbedderKK.h>
 #include <ogdf/energybased/StressMinimization.h>
+#include <ogdf/energybased/fast_multipole_embedder/FMEKernel.h>
+#include <ogdf/energybased/fast_multipole_embedder/LinearQuadtree.h>
+#include <ogdf/energybased/fast_multipole_embedder/LinearQuadtreeExpansion.h>
 #include <ogdf/energybased/TutteLayout.h>
 #include <ogdf/energybased/fmmm/FMMMOptions.h>
+#include <ogdf/graphalg/ShortestPathAlgorithms.h>
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <initializer_list>
 #include <string>
+#include <vector>
 
 #include "layout_helpers.h"
 #include <graphs.h>
@@ -164,6 +172,24 @@ void describeFMMM() {
 	fmmm.tipOverCCs(FMMMOptions::TipOver::Always);
 	describeLayout("FMMMLayout with very specific configuration (using GridApproximation)", fmmm);
 
+	FMMMLayout parallelFmmm;
+	parallelFmmm.fixedIterations(50);
+	parallelFmmm.maxThreads(4);
+	describeLayout("FMMMLayout with multiple threads", parallelFmmm);
+
+	it("computes the same layout for a fixed seed and number of threads", [&]() {
+		Graph G;
+		randomSimpleGraph(G, 500, 1000);
+		GraphAttributes GA1(G), GA2(G);
+
+		parallelFmmm.call(GA1);
+		parallelFmmm.call(GA2);
+		for (node v : G.nodes) {
+			AssertThat(GA1.x(v), Equals(GA2.x(v)));
+			AssertThat(GA1.y(v), Equals(GA2.y(v)));
+		}
+	});
+
 	it("should not reset parameters to their default value when using high level options", [&]() {
 		Graph G;
 		randomSimpleGraph(G, 100, 200);
@@ -176,6 +202,177 @@ void describeFMMM() {
 	});
 }
 
+//! Asserts that \p actual equals \p expected up to the relative error \p eps.
+//! Returns the full stress of the layout \p GA of the connected graph \p G after optimal scaling.
+/**
+ * Pairs of nodes at graph distance \a d contribute (s * \a x - \a d)^2 / \a d^2, where \a x
+ * is their Euclidean distance and \a s the factor minimizing the stress.
+ */
+static double scaledStress(const Graph& G, const GraphAttributes& GA) {
+	NodeMatrix<double, true> distance;
+	bfs_SPAP(G, distance, 1.0);
+
+	double sumXD = 0, sumXX = 0, sumOne = 0;
+	for (node u : G.nodes) {
+		for (node v : G.nodes) {
+			if (u->index() < v->index()) {
+				double d = distance(u, v);
+				double x = std::hypot(GA.x(u) - GA.x(v), GA.y(u) - GA.y(v));
+				sumXD += x / d;
+				sumXX += x * x / (d * d);
+				sumOne += 1;
+			}
+		}
+	}
+	double s = sumXD / sumXX;
+	return sumXX * s * s - 2 * sumXD * s + sumOne;
+}
+
+static void describeSparseStress() {
+	it("approximates the full stress model", [] {
+		setSeed(42);
+		Graph G;
+		randomSimpleConnectedGraph(G, 400, 800);
+
+		GraphAttributes fullGA(G), sparseGA(G);
+		StressMinimization full;
+		full.call(fullGA);
+		StressMinimization sparse;
+		sparse.useSparseStress(true);
+		sparse.call(sparseGA);
+
+		double fullStress = scaledStress(G, fullGA);
+		double sparseStress = scaledStress(G, sparseGA);
+		AssertThat(fullStress, IsGreaterThan(0.0));
+		AssertThat(sparseStress, IsLessThan(1.5 * fullStress));
+	});
+}
+
+static void assertClose(double actual, double expected, double eps) {
+	AssertThat(actual, EqualsWithDelta(expected, eps * std::max(1.0, std::abs(expected))));
+}
+
+//! Asserts that the arrays \p actual and \p expected of length \p n are equal up to the
+//! error \p eps relative to the largest absolute value in \p expected.
+static void assertCloseArrays(const double* actual, const double* expected, uint32_t n,
+		double eps) {
+	double scale = 1.0;
+	for (uint32_t i = 0; i < n; ++i) {
+		scale = std::max(scale, std::abs(expected[i]));
+	}
+	for (uint32_t i = 0; i < n; ++i) {
+		AssertThat(actual[i], EqualsWithDelta(expected[i], eps * scale));
+	}
+}
+
+static void describeFMEKernels() {
+	using namespace fast_multipole_embedder;
+
+	// Runs every translation of the expansions on a fixed configuration of points and
+	// tree nodes, once with the kernels chosen for the CPU and once with the scalar ones.
+	for (uint32_t precision : {4, 9, 70}) {
+		it("computes the same expansions with the vectorized and the scalar kernels (precision "
+						+ to_string(precision) + ")",
+				[precision] {
+					const uint32_t n = 32;
+					std::vector<float> x(n), y(n), size(n);
+					LinearQuadtree tree(n, x.data(), y.data(), size.data());
+					// Nodes 0..7 are leaves containing the points, nodes 8 and 9 their parents
+					// and nodes 10..12 are far away. The points are close to their leaves such
+					// that the expansions are well-conditioned even for high precisions.
+					for (uint32_t v = 0; v < 2 * n; ++v) {
+						float offset = v >= 10 ? 4 : 0;
+						tree.setNodeX(v, offset + randomDouble(0, 1));
+						tree.setNodeY(v, offset + randomDouble(0, 1));
+					}
+					tree.setNodeX(8, 0.5);
+					tree.setNodeY(8, 0.5);
+					tree.setNodeX(9, 0.5);
+					tree.setNodeY(9, 0.5);
+					for (uint32_t i = 0; i < n; ++i) {
+						tree.setPoint(i, float(tree.nodeX(i % 8) + randomDouble(-0.1, 0.1)),
+								float(tree.nodeY(i % 8) + randomDouble(-0.1, 0.1)),
+								float(randomDouble(0.5, 1.5)));
+					}
+
+					LinearQuadtreeExpansion vectorized(precision, tree);
+					LinearQuadtreeExpansion scalar(precision, tree);
+					scalar.useScalarKernels();
+
+					std::vector<float> fx[2], fy[2];
+					LinearQuadtreeExpansion* expansions[2] = {&vectorized, &scalar};
+					for (int k = 0; k < 2; ++k) {
+						LinearQuadtreeExpansion& E = *expansions[k];
+						const uint32_t length = 2 * E.numCoeff() * E.m_numExp;
+						std::fill(E.multiExp(), E.multiExp() + length, 0.0);
+						std::fill(E.localExp(), E.localExp() + length, 0.0);
+						for (uint32_t i = 0; i < n; ++i) {
+							E.P2M(i, i % 8);
+						}
+						for (uint32_t v = 0; v < 8; ++v) {
+							E.M2M(v, 8 + v % 2);
+						}
+						E.M2L(8, 10);
+						E.M2L(9, 11);
+						E.L2L(10, 12);
+						E.L2L(11, 12);
+						fx[k].assign(n, 0);
+						fy[k].assign(n, 0);
+						for (uint32_t i = 0; i < n; ++i) {
+							E.L2P(12, i, fx[k][i], fy[k][i]);
+						}
+					}
+
+					const uint32_t length = 2 * precision * vectorized.m_numExp;
+					assertCloseArrays(vectorized.multiExp(), scalar.multiExp(), length, 1e-9);
+					assertCloseArrays(vectorized.localExp(), scalar.localExp(), length, 1e-9);
+					for (uint32_t i = 0; i < n; ++i) {
+						assertClose(fx[0][i], fx[1][i], 1e-4);
+						assertClose(fy[0][i], fy[1][i], 1e-4);
+					}
+				});
+	}
+
+#ifdef OGDF_AVX2_EXTENSIONS
+	it("computes the same direct forces with AVX2 as without", [] {
+		if (!eval_direct_use_avx2()) {
+			AssertThat(System::cpuSupports(CPUFeature::AVX2), IsFalse());
+			return;
+		}
+
+		// sizes that are not multiples of the vector width
+		const size_t n1 = 21, n2 = 13;
+		std::vector<float> x(n1 + n2), y(n1 + n2), size(n1 + n2);
+		for (size_t i = 0; i < n1 + n2; ++i) {
+			x[i] = randomDouble(0, 10);
+			y[i] = randomDouble(0, 10);
+			size[i] = randomDouble(0.5, 1.5);
+		}
+
+		std::vector<float> fx[2], fy[2];
+		for (int k = 0; k < 2; ++k) {
+			fx[k].assign(n1 + n2, 0);
+			fy[k].assign(n1 + n2, 0);
+		}
+		float* x2 = x.data() + n1;
+		float* y2 = y.data() + n1;
+		float* s2 = size.data() + n1;
+		eval_direct_avx2(x.data(), y.data(), size.data(), fx[0].data(), fy[0].data(), n1);
+		eval_direct_avx2(x.data(), y.data(), size.data(), fx[0].data(), fy[0].data(), n1, x2, y2,
+				s2, fx[0].data() + n1, fy[0].data() + n1, n2);
+		eval_direct(x.data(), y.data(), size.data(), fx[1].data(), fy[1].data(), n1);
+		eval_direct(x.data(), y.data(), size.data(), fx[1].data(), fy[1].data(), n1, x2, y2, s2,
+				fx[1].data() + n1, fy[1].data() + n1, n2);
+
+		for (size_t i = 0; i < n1 + n2; ++i) {
+			float tolerance = 1e-4f * std::max(1.0f, std::abs(fx[1][i]) + std::abs(fy[1][i]));
+			AssertThat(fx[0][i], EqualsWithDelta(fx[1][i], tolerance));
+			AssertThat(fy[0][i], EqualsWithDelta(fy[1][i], tolerance));
+		}
+	});
+#endif
+}
+
 go_bandit([] {
 	describe("Energy-based layouts", [] {
 		TEST_ENERGY_BASED_LAYOUT(DavidsonHarelLayout, 0);
@@ -187,6 +384,8 @@ go_bandit([] {
 		TEST_ENERGY_BASED_LAYOUT(FastMultipoleEmbedder, 0, GraphProperty::connected);
 		TEST_ENERGY_BASED_LAYOUT(FastMultipoleMultilevelEmbedder, 0, GraphProperty::connected);
 
+		describe("FastMultipoleEmbedder kernels", [] { describeFMEKernels(); });
+
 		describeFMMM();
 
 		TEST_ENERGY_BASED_LAYOUT(GEMLayout, 0);
@@ -205,6 +404,13 @@ go_bandit([] {
 
 		TEST_ENERGY_BASED_LAYOUT(StressMinimization, 0);
 
+		StressMinimization sparseStress;
+		sparseStress.setIterations(50);
+		sparseStress.useSparseStress(true);
+		sparseStress.setNumberOfSparsePivots(10);
+		describeLayout("StressMinimization with sparse stress model", sparseStress);
+		describe("Sparse stress model of StressMinimization", [] { describeSparseStress(); });
+
 		TEST_ENERGY_BASED_LAYOUT(TutteLayout, 0, GraphProperty::triconnected, GraphProperty::planar,
 				GraphProperty::simple);
 	});
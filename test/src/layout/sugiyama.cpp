@@ -29,8 +29,10 @@
  * http://www.gnu.org/copyleft/gpl.html
  */
 
+#include <ogdf/basic/System.h>
 #include <ogdf/basic/Thread.h>
 #include <ogdf/layered/BarycenterHeuristic.h>
+#include <ogdf/layered/BilayerCrossingCounter.h>
 #include <ogdf/layered/CoffmanGrahamRanking.h>
 #include <ogdf/layered/DfsAcyclicSubgraph.h>
 #include <ogdf/layered/FastHierarchyLayout.h>
@@ -39,8 +41,11 @@
 #include <ogdf/layered/GreedyInsertHeuristic.h>
 #include <ogdf/layered/GreedySwitchHeuristic.h>
 #include <ogdf/layered/GridSifting.h>
+#include <ogdf/layered/Hierarchy.h>
+#include <ogdf/layered/HierarchyLevels.h>
 #include <ogdf/layered/LongestPathRanking.h>
 #include <ogdf/layered/MedianHeuristic.h>
+#include <ogdf/layered/NetworkSimplexHierarchyLayout.h>
 #include <ogdf/layered/OptimalHierarchyLayout.h>
 #include <ogdf/layered/OptimalRanking.h>
 #include <ogdf/layered/SiftingHeuristic.h>
@@ -48,9 +53,13 @@
 #include <ogdf/layered/SugiyamaLayout.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <set>
 #include <string>
+#include <utility>
 
 #include "layout_helpers.h"
 #include <graphs.h>
@@ -109,11 +118,323 @@ void describeSugi(const std::string& name, const std::set<GraphProperty>& reqs)
 	});
 }
 
+template<class CrossMin>
+void describeParallelRun(const std::string& name) {
+	it("computes the same result in a single run with multiple threads using " + name, [] {
+		// Levels are split into chunks of at least 4096 nodes (LayerByLayerSweep) and
+		// crossings are only counted in parallel for hierarchies of at least 2^14 nodes
+		// (HierarchyLevelsBase), so use two chunks per level and three levels.
+		const int levelSize = 8192;
+		Graph G;
+		Array<node> previous(levelSize), current(levelSize);
+		for (node& v : previous) {
+			v = G.newNode();
+		}
+		for (int level = 1; level < 3; ++level) {
+			for (node& v : current) {
+				v = G.newNode();
+			}
+			for (int i = 0; i < 3 * levelSize; ++i) {
+				G.newEdge(previous[randomNumber(0, levelSize - 1)],
+						current[randomNumber(0, levelSize - 1)]);
+			}
+			std::swap(previous, current);
+		}
+
+		SugiyamaLayout sugi;
+		sugi.setCrossMin(new CrossMin);
+		sugi.setLayout(new FastSimpleHierarchyLayout);
+		sugi.runs(1);
+		sugi.transpose(false);
+
+		GraphAttributes GA(G);
+		setSeed(42);
+		sugi.maxThreads(1);
+		sugi.call(GA);
+		int sequentialCrossings = sugi.numberOfCrossings();
+		NodeArray<double> sequentialX(G);
+		for (node v : G.nodes) {
+			sequentialX[v] = GA.x(v);
+		}
+
+		setSeed(42);
+		sugi.maxThreads(4);
+		sugi.call(GA);
+		AssertThat(sugi.numberOfCrossings(), Equals(sequentialCrossings));
+		for (node v : G.nodes) {
+			AssertThat(GA.x(v), Equals(sequentialX[v]));
+		}
+	});
+}
+
+static void describeTimeLimit() {
+	describe("crossing minimization runs", [] {
+		Graph G;
+		GraphAttributes GA;
+		SugiyamaLayout sugi;
+
+		before_each([&] {
+			setSeed(23);
+			randomSimpleConnectedGraph(G, 60, 200);
+			GA.init(G, GraphAttributes::nodeGraphics | GraphAttributes::edgeGraphics);
+			sugi.arrangeCCs(false);
+			sugi.maxThreads(1);
+			sugi.timeLimit(-1.0);
+		});
+
+		it("reports the crossings of every run", [&] {
+			sugi.runs(6);
+			sugi.call(GA);
+
+			const ArrayBuffer<int>& crossings = sugi.crossingsPerRun();
+			AssertThat(crossings.size(), IsGreaterThan(0));
+			AssertThat(crossings.size(), IsLessThanOrEqualTo(6));
+			AssertThat(*std::min_element(crossings.begin(), crossings.end()),
+					Equals(sugi.numberOfCrossings()));
+		});
+
+		it("returns a result if the time limit is exceeded immediately", [&] {
+			sugi.timeLimit(0.0);
+			sugi.call(GA);
+
+			AssertThat(sugi.crossingsPerRun().size(), Equals(1));
+			AssertThat(sugi.crossingsPerRun()[0], Equals(sugi.numberOfCrossings()));
+		});
+
+		it("keeps starting runs until the time limit is reached", [&] {
+			sugi.runs(1);
+			sugi.maxThreads(2);
+			sugi.timeLimit(0.2);
+
+			int64_t t;
+			System::usedRealTime(t);
+			sugi.call(GA);
+			t = System::usedRealTime(t);
+
+			const ArrayBuffer<int>& crossings = sugi.crossingsPerRun();
+			if (sugi.numberOfCrossings() > 0) {
+				AssertThat(t, IsGreaterThanOrEqualTo(200));
+				AssertThat(crossings.size(), IsGreaterThan(1));
+			}
+			AssertThat(*std::min_element(crossings.begin(), crossings.end()),
+					Equals(sugi.numberOfCrossings()));
+		});
+	});
+}
+
+static void describeIncremental() {
+	describe("incremental layout", [] {
+		Graph G;
+		GraphAttributes GA;
+		NodeArray<int> rank;
+		SugiyamaLayout sugi;
+
+		before_each([&] {
+			setSeed(5);
+			randomSimpleConnectedGraph(G, 80, 160);
+			GA.init(G, GraphAttributes::nodeGraphics | GraphAttributes::edgeGraphics);
+			rank.init();
+			sugi.call(GA, rank);
+		});
+
+		it("keeps the levels and the order of existing nodes", [&] {
+			List<node> oldNodes;
+			G.allNodes(oldNodes);
+			NodeArray<double> oldX(G);
+			NodeArray<int> oldRank(rank);
+			for (node v : G.nodes) {
+				oldX[v] = GA.x(v);
+			}
+
+			for (int i = 0; i < 3; ++i) {
+				node v = G.newNode();
+				G.newEdge(G.chooseNode(), v);
+				G.newEdge(v, G.chooseNode());
+				rank[v] = -1;
+			}
+			sugi.callIncremental(GA, rank);
+
+			for (node v : oldNodes) {
+				AssertThat(rank[v] - rank[oldNodes.front()],
+						Equals(oldRank[v] - oldRank[oldNodes.front()]));
+				for (node w : oldNodes) {
+					if (rank[v] == rank[w] && oldX[v] < oldX[w]) {
+						AssertThat(GA.x(v), IsLessThan(GA.x(w)));
+					}
+				}
+			}
+		});
+
+		it("places new nodes on their own", [&] {
+			node v = G.newNode();
+			node w = G.newNode();
+			G.newEdge(v, w);
+			rank[v] = rank[w] = -1;
+			sugi.callIncremental(GA, rank);
+
+			AssertThat(rank[w], Equals(rank[v] + 1));
+		});
+	});
+}
+
+//! Makes the algorithm call of a HierarchyLayoutModule accessible.
+template<typename Layout>
+class ExposedLayout : public Layout {
+public:
+	using Layout::doCall;
+};
+
+//! Returns the objective of OptimalHierarchyLayout without balancing for the layout \p AGC.
+static double layoutObjective(const HierarchyLevels& levels, const GraphAttributes& AGC,
+		double weightSegments) {
+	const GraphCopy& GC = levels.hierarchy();
+	double objective = 0;
+	for (edge e : GC.edges) {
+		double weight = GC.chain(GC.original(e)).size() >= 3 ? weightSegments : 1.0;
+		objective += weight * std::fabs(AGC.x(e->source()) - AGC.x(e->target()));
+	}
+	return objective;
+}
+
+static void describeNetworkSimplexLayout() {
+	describe("NetworkSimplexHierarchyLayout", [] {
+		for (int seed = 1; seed <= 5; ++seed) {
+			it("computes optimal coordinates for a random hierarchy #" + to_string(seed), [seed] {
+				setSeed(seed);
+				Graph G;
+				randomSimpleGraph(G, 40, 80);
+				NodeArray<int> rank(G);
+				LongestPathRanking().call(G, rank);
+				Hierarchy H(G, rank);
+				HierarchyLevels levels(H);
+				levels.permute();
+
+				const GraphCopy& GC = H;
+				GraphAttributes nsAGC(GC), optAGC(GC);
+				ExposedLayout<NetworkSimplexHierarchyLayout> networkSimplex;
+				ExposedLayout<OptimalHierarchyLayout> optimal;
+				optimal.weightBalancing(0.0);
+				networkSimplex.doCall(levels, nsAGC);
+				optimal.doCall(levels, optAGC);
+
+				for (int i = 0; i < levels.size(); ++i) {
+					const Level& level = levels[i];
+					for (int j = 1; j < level.size(); ++j) {
+						node u = level[j - 1], v = level[j];
+						double minDist = networkSimplex.nodeDistance()
+								+ (GC.isDummy(u) ? 0.0 : nsAGC.width(u) / 2)
+								+ (GC.isDummy(v) ? 0.0 : nsAGC.width(v) / 2);
+						AssertThat(nsAGC.x(v) - nsAGC.x(u), IsGreaterThan(minDist - 1e-6));
+					}
+				}
+
+				double optimum = layoutObjective(levels, optAGC, optimal.weightSegments());
+				AssertThat(layoutObjective(levels, nsAGC, networkSimplex.weightSegments()),
+						EqualsWithDelta(optimum, 1e-6 * std::max(1.0, optimum)));
+			});
+		}
+	});
+}
+
+//! Counts the crossings between level \p i and \p i+1 by testing all pairs of edges.
+static int naiveCrossings(const HierarchyLevels& levels, int i,
+		const EdgeArray<uint32_t>* edgeSubGraphs = nullptr) {
+	const GraphCopy& GC = levels.hierarchy();
+	const Level& level = levels[i];
+	ArrayBuffer<edge> edges;
+	for (int j = 0; j < level.size(); ++j) {
+		for (adjEntry adj : level[j]->adjEntries) {
+			if (adj->isSource()) {
+				edges.push(adj->theEdge());
+			}
+		}
+	}
+
+	int nc = 0;
+	for (edge e : edges) {
+		for (edge f : edges) {
+			if (levels.pos(e->source()) < levels.pos(f->source())
+					&& levels.pos(e->target()) > levels.pos(f->target())) {
+				if (edgeSubGraphs == nullptr) {
+					nc++;
+				} else {
+					uint32_t common = (*edgeSubGraphs)[GC.original(e)] & (*edgeSubGraphs)[GC.original(f)];
+					for (; common != 0; common &= common - 1) {
+						nc++;
+					}
+				}
+			}
+		}
+	}
+	return nc;
+}
+
+static void describeBilayerCrossingCounter() {
+	describe("BilayerCrossingCounter", [] {
+		Graph G;
+		std::unique_ptr<Hierarchy> H;
+		std::unique_ptr<HierarchyLevels> levels;
+
+		before_each([&] {
+			setSeed(17);
+			randomSimpleGraph(G, 300, 900);
+			NodeArray<int> rank(G);
+			LongestPathRanking().call(G, rank);
+			H.reset(new Hierarchy(G, rank));
+			levels.reset(new HierarchyLevels(*H));
+			levels->permute();
+		});
+
+		it("counts crossings between levels", [&] {
+			BilayerCrossingCounter counter;
+			for (int i = 0; i < levels->high(); ++i) {
+				AssertThat(counter.count(*levels, i), Equals(naiveCrossings(*levels, i)));
+			}
+		});
+
+		it("counts crossings for simultaneous drawing", [&] {
+			EdgeArray<uint32_t> subGraphs(G);
+			for (edge e : G.edges) {
+				subGraphs[e] = randomNumber(1, 15);
+			}
+
+			BilayerCrossingCounter counter;
+			for (int i = 0; i < levels->high(); ++i) {
+				AssertThat(counter.countSimDraw(*levels, i, subGraphs),
+						Equals(naiveCrossings(*levels, i, &subGraphs)));
+			}
+		});
+
+		it("computes the gain of swapping neighbors", [&] {
+			for (int i = 0; i <= levels->high(); ++i) {
+				Level& level = (*levels)[i];
+				for (int j = 0; j + 1 < level.size(); j += 3) {
+					int before = levels->calculateCrossings();
+					int gain = BilayerCrossingCounter::swapGain(*levels, level[j], level[j + 1]);
+
+					level.swap(j, j + 1);
+					levels->buildAdjNodes();
+					AssertThat(levels->calculateCrossings(), Equals(before - gain));
+				}
+			}
+		});
+	});
+}
+
 go_bandit([] {
+	describeBilayerCrossingCounter();
+	describeNetworkSimplexLayout();
+
 	describe("SugiyamaLayout", [] {
 		DESCRIBE_SUGI_LAYOUT(FastHierarchyLayout, {GraphProperty::sparse});
 		DESCRIBE_SUGI_LAYOUT(FastSimpleHierarchyLayout, {GraphProperty::sparse});
 		describeSugi<OptimalHierarchyLayout>("OptimalHierarchyLayout",
 				{GraphProperty::simple, GraphProperty::sparse});
+		DESCRIBE_SUGI_LAYOUT(NetworkSimplexHierarchyLayout, {GraphProperty::sparse});
+
+		describeParallelRun<BarycenterHeuristic>("BarycenterHeuristic");
+		describeParallelRun<MedianHeuristic>("MedianHeuristic");
+		describeTimeLimit();
+		describeIncremental();
 	});
 });
@@ -348,6 +348,62 @@ void testSubgraphPlanarizer() {
 		testSPEdgeInserter(new MultiEdgeApproxInserter, "MultiEdgeApprox");
 		testSPEdgeInserter(new VariableEmbeddingInserter, "VariableEmbedding");
 		testSPEdgeInserter(new VariableEmbeddingInserterDyn, "VariableEmbeddingDyn");
+
+		describe("several non-planar blocks", [] {
+			// a chain of K5s and K3,3s sharing cut vertices, plus a planar block and a tree
+			Graph graph;
+			node cut = graph.newNode();
+			for (int i = 0; i < 6; ++i) {
+				Array<node> v(i % 2 == 0 ? 5 : 6);
+				v[0] = cut;
+				for (int j = 1; j < v.size(); ++j) {
+					v[j] = graph.newNode();
+				}
+				if (i % 2 == 0) {
+					for (int j = 0; j < 5; ++j) {
+						for (int k = j + 1; k < 5; ++k) {
+							graph.newEdge(v[j], v[k]);
+						}
+					}
+				} else {
+					for (int j = 0; j < 3; ++j) {
+						for (int k = 3; k < 6; ++k) {
+							graph.newEdge(v[j], v[k]);
+						}
+					}
+				}
+				cut = v[4];
+			}
+			node w = graph.newNode();
+			graph.newEdge(cut, w);
+			graph.newEdge(w, graph.newNode());
+			graph.newEdge(w, graph.newNode());
+			graph.newEdge(graph.lastNode(), graph.lastNode()->pred());
+
+			for (unsigned int threads : {1u, 4u}) {
+				it("works using " + std::to_string(threads) + " threads", [&graph, threads] {
+					SubgraphPlanarizer heuristic;
+					heuristic.maxThreads(threads);
+					testComputation(heuristic, graph, 6, false);
+
+					PlanRep planRep(graph);
+					planRep.initCC(0);
+					int crossingNumber;
+					heuristic.call(planRep, 0, crossingNumber);
+					AssertThat(crossingNumber, Equals(6));
+				});
+			}
+
+			it("works with edge costs", [&graph] {
+				EdgeArray<int> cost(graph);
+				for (edge e : graph.edges) {
+					cost[e] = randomNumber(1, 5);
+				}
+				SubgraphPlanarizer heuristic;
+				heuristic.permutations(4);
+				testComputation(heuristic, graph, 6, false, &cost);
+			});
+		});
 	});
 }
 
@@ -47,10 +47,12 @@
 #include <ogdf/planarity/BoyerMyrvold.h>
 #include <ogdf/planarity/CrossingMinimizationModule.h>
 #include <ogdf/planarity/ExtractKuratowskis.h>
+#include <ogdf/planarity/IncrementalPlanarityTester.h>
 #include <ogdf/planarity/KuratowskiSubdivision.h>
 #include <ogdf/planarity/NonPlanarCore.h>
 #include <ogdf/planarity/PlanRep.h>
 #include <ogdf/planarity/PlanarityModule.h>
+#include <ogdf/planarity/PlanarityTester.h>
 #include <ogdf/planarity/SubgraphPlanarizer.h>
 #include <ogdf/planarity/boyer_myrvold/BoyerMyrvoldPlanar.h>
 
@@ -140,6 +142,191 @@ void describeModule(const std::string& name, PlanarityModule& pm) {
 	});
 }
 
+void describePlanarityTester() {
+	describe("PlanarityTester", [] {
+		PlanarityTester tester;
+
+		forEachGraphItWorks({GraphProperty::planar},
+				[&](Graph& G) { AssertThat(tester.isPlanar(G), IsTrue()); });
+
+		forEachGraphItWorks({GraphProperty::nonPlanar},
+				[&](Graph& G) { AssertThat(tester.isPlanar(G), IsFalse()); });
+
+		it("agrees with Boyer-Myrvold on random graphs", [&] {
+			BoyerMyrvold bm;
+			for (int i = 0; i < 2000; ++i) {
+				Graph G;
+				int n = randomNumber(1, 40);
+				if (i % 2 == 0) {
+					randomGraph(G, n, randomNumber(0, 3 * n));
+				} else {
+					randomPlanarConnectedGraph(G, n, randomNumber(n, 3 * n));
+					for (int k = randomNumber(0, 2); k > 0; --k) {
+						G.newEdge(G.chooseNode(), G.chooseNode());
+					}
+				}
+				bool planar = bm.isPlanar(G);
+				AssertThat(tester.isPlanar(G), Equals(planar));
+
+				NodeArray<int> index(G);
+				int j = 0;
+				for (node v : G.nodes) {
+					index[v] = j++;
+				}
+				std::vector<std::pair<int, int>> edges;
+				for (edge e : G.edges) {
+					edges.emplace_back(index[e->source()], index[e->target()]);
+				}
+				AssertThat(tester.isPlanar(G.numberOfNodes(), edges), Equals(planar));
+			}
+		});
+
+		it("works on a long path", [&] {
+			Graph G;
+			std::vector<node> path {G.newNode()};
+			for (int i = 0; i < 100000; ++i) {
+				path.push_back(G.newNode());
+				G.newEdge(path[i], path[i + 1]);
+			}
+			G.newEdge(path.back(), path.front());
+
+			// a wheel with a long subdivided rim
+			node center = G.newNode();
+			for (int i = 0; i < 100000; i += 1000) {
+				G.newEdge(center, path[i]);
+			}
+			AssertThat(tester.isPlanar(G), IsTrue());
+
+			// a node adjacent to the center and to distant rim nodes
+			node v = G.newNode();
+			G.newEdge(v, center);
+			for (int i : {25000, 50000, 75000, 100000}) {
+				G.newEdge(v, path[i]);
+			}
+			AssertThat(tester.isPlanar(G), IsFalse());
+		});
+
+		it("tests batches of graphs", [] {
+			std::vector<Graph> graphs(200);
+			std::vector<const Graph*> pointers;
+			for (Graph& G : graphs) {
+				int n = randomNumber(5, 200);
+				randomPlanarConnectedGraph(G, n, 2 * n);
+				if (randomNumber(0, 1) == 1) {
+					G.newEdge(G.chooseNode(), G.chooseNode());
+				}
+				pointers.push_back(&G);
+			}
+
+			Array<bool> planar, planarFromPointers;
+			PlanarityTester::isPlanarBatch(graphs.begin(), graphs.end(), planar, 4);
+			PlanarityTester::isPlanarBatch(pointers.begin(), pointers.end(), planarFromPointers);
+			AssertThat(planar.size(), Equals(200));
+			for (int i = 0; i < 200; ++i) {
+				bool expected = isPlanar(graphs[i]);
+				AssertThat(planar[i], Equals(expected));
+				AssertThat(planarFromPointers[i], Equals(expected));
+			}
+		});
+	});
+}
+
+void describeIncrementalPlanarityTester() {
+	describe("IncrementalPlanarityTester", [] {
+		it("inserts edges like repeated Boyer-Myrvold tests", [] {
+			BoyerMyrvold bm;
+			IncrementalPlanarityTester tester;
+			for (int i = 0; i < 500; ++i) {
+				Graph G;
+				int n = randomNumber(3, i % 10 == 0 ? 80 : 20);
+				if (i % 2 == 0) {
+					randomGraph(G, n, randomNumber(0, 3 * n));
+				} else {
+					randomPlanarConnectedGraph(G, n, randomNumber(n, 3 * n - 6));
+					for (int k = randomNumber(0, 5); k > 0; --k) {
+						G.newEdge(G.chooseNode(), G.chooseNode());
+					}
+				}
+
+				List<edge> order, initial;
+				G.allEdges(order);
+				order.permute();
+				for (edge e : G.edges) {
+					if (e->index() < n / 2) {
+						initial.pushBack(e);
+					}
+				}
+				tester.init(G, initial, order);
+
+				GraphCopy copy(G);
+				for (edge e : G.edges) {
+					if (!tester.contains(e)) {
+						copy.delEdge(copy.copy(e));
+					}
+				}
+				AssertThat(bm.isPlanar(copy), IsTrue());
+
+				for (edge e : order) {
+					if (copy.copy(e) != nullptr) {
+						continue;
+					}
+					edge f = copy.newEdge(e);
+					bool planar = bm.isPlanar(copy);
+					if (!planar) {
+						copy.delEdge(f);
+					}
+					AssertThat(tester.isPlanarWith(e), Equals(planar));
+					AssertThat(tester.insert(e), Equals(planar));
+					AssertThat(tester.contains(e), Equals(planar));
+				}
+			}
+		});
+
+		it("handles disconnected graphs", [] {
+			Graph G;
+			completeGraph(G, 4);
+			List<edge> K5;
+			Graph H;
+			completeGraph(H, 5);
+			NodeArray<node> map(H);
+			for (node v : H.nodes) {
+				map[v] = G.newNode();
+			}
+			for (edge e : H.edges) {
+				K5.pushBack(G.newEdge(map[e->source()], map[e->target()]));
+			}
+			G.newNode();
+
+			IncrementalPlanarityTester tester;
+			tester.init(G);
+			int inserted = 0;
+			for (edge e : G.edges) {
+				if (tester.insert(e)) {
+					++inserted;
+				}
+			}
+			AssertThat(inserted, Equals(6 + 9));
+			AssertThat(tester.contains(K5.back()), IsFalse());
+		});
+
+		it("starts without the given edges", [] {
+			Graph G;
+			completeGraph(G, 5);
+			List<edge> deleted;
+			deleted.pushBack(G.lastEdge());
+			deleted.pushBack(G.firstEdge());
+
+			IncrementalPlanarityTester tester;
+			tester.initWithout(G, deleted);
+			for (edge e : G.edges) {
+				AssertThat(tester.contains(e), Equals(e != G.firstEdge() && e != G.lastEdge()));
+			}
+			AssertThat(tester.insert(G.lastEdge()), IsTrue());
+			AssertThat(tester.insert(G.firstEdge()), IsFalse());
+		});
+	});
+}
+
 void describeDestructiveBoyerMyrvold(bool bundles, bool limitStructures, bool randomDFSTree,
 		bool avoidE2Minors) {
 	// bundles on big non-planar graphs takes too long.
@@ -472,6 +659,10 @@ go_bandit([]() {
 		BoyerMyrvold bm;
 		describeModule("Boyer-Myrvold", bm);
 		describeDestructiveBoyerMyrvold();
+		describePlanarityTester();
+		IncrementalPlanarityTester incremental;
+		describeModule("Incremental", incremental);
+		describeIncrementalPlanarityTester();
 
 		it("transforms based on the right graph, when it's a GraphCopySimple", []() {
 			Graph G;